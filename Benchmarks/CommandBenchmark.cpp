@@ -0,0 +1,84 @@
+// Allocation benchmark for editor undo commands.
+//
+// Records 1M transform commands that all merge into one undo entry, the
+// pattern produced by a long gizmo drag, once with heap-allocated commands
+// (CreateScope) and once with pooled ones (MakeCommand). Prints the median
+// time per command and the pool's footprint after the run.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "Commands/BuiltinCommands.h"
+#include "Commands/CommandManager.h"
+#include "Commands/CommandPool.h"
+#include "Commands/TransformCommand.h"
+#include "Core/Log.h"
+#include "Scene/Scene.h"
+
+using namespace Vest;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int CommandCount = 1000000;
+constexpr int Repetitions = 5;
+
+double MedianMs(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+template <typename MakeFn>
+double RecordMergedCommands(MakeFn&& make) {
+    CommandManager manager;
+    auto start = Clock::now();
+    for (int i = 0; i < CommandCount; ++i) {
+        manager.RegisterExecutedCommand(make(static_cast<float>(i)));
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+int main() {
+    Log::Init();
+    Log::GetCoreLogger()->set_level(spdlog::level::warn);
+    RegisterBuiltinCommands();
+
+    Scene scene;
+    EntityHandle entity = scene.CreateEntity(SceneObject());
+
+    auto heap = [&](float x) -> CommandPtr {
+        return CreateScope<TransformCommand>(&scene, entity, TransformCommand::Type::Position, glm::vec3(0.0f),
+                                             glm::vec3(x));
+    };
+    auto pooled = [&](float x) -> CommandPtr {
+        return MakeCommand<TransformCommand>(&scene, entity, TransformCommand::Type::Position, glm::vec3(0.0f),
+                                             glm::vec3(x));
+    };
+
+    std::vector<double> heapMs;
+    std::vector<double> pooledMs;
+    for (int rep = 0; rep <= Repetitions; ++rep) {
+        double heapRun = RecordMergedCommands(heap);
+        double pooledRun = RecordMergedCommands(pooled);
+        // First iteration warms caches and the pool
+        if (rep > 0) {
+            heapMs.push_back(heapRun);
+            pooledMs.push_back(pooledRun);
+        }
+    }
+
+    const auto& pool = GetCommandPool<TransformCommand>();
+    std::printf("Merged transform commands: %d, median of %d runs\n\n", CommandCount, Repetitions);
+    std::printf("%8s %12s %12s\n", "", "total ms", "ns / cmd");
+    std::printf("%8s %12.2f %12.1f\n", "heap", MedianMs(heapMs), MedianMs(heapMs) * 1.0e6 / CommandCount);
+    std::printf("%8s %12.2f %12.1f\n", "pooled", MedianMs(pooledMs), MedianMs(pooledMs) * 1.0e6 / CommandCount);
+    std::printf("\nPool after run: %zu slab(s), %zu slots, %zu live\n", pool.GetSlabCount(), pool.GetCapacity(),
+                pool.GetLiveCount());
+    Log::Shutdown();
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Scaling benchmark for Vest::JobSystem.
+//
+// Runs a compute-bound ParallelFor and a burst of tiny jobs on 1..64
+// threads and prints wall time, speedup and parallel efficiency relative
+// to the single-thread run. Thread counts above the hardware concurrency
+// are still measured; expect them to flatten out.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "Core/JobSystem.h"
+
+using namespace Vest;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t ElementCount = 1u << 20;
+constexpr uint32_t TinyJobCount = 100000;
+constexpr int Repetitions = 5;
+
+double MedianMs(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+template <typename Fn>
+double TimeMs(Fn&& fn) {
+    auto start = Clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Roughly the per-entity cost of a transform update
+void Work(std::vector<float>& data, uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+        float x = data[i];
+        for (int k = 0; k < 32; ++k) {
+            x = std::sin(x) * 0.5f + std::cos(x * 1.3f);
+        }
+        data[i] = x;
+    }
+}
+
+struct Result {
+    uint32_t threads;
+    double parallelForMs;
+    double tinyJobsMs;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    uint32_t maxThreads = 64;
+    if (argc > 1) {
+        maxThreads = static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    }
+
+    std::printf("JobSystem scaling benchmark (hardware threads: %u)\n", std::thread::hardware_concurrency());
+    std::printf("ParallelFor: %u elements, tiny jobs: %u, median of %d runs\n\n", ElementCount, TinyJobCount,
+                Repetitions);
+
+    std::vector<float> data(ElementCount);
+    std::vector<Result> results;
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+        JobSystem jobs(threads - 1);
+
+        std::vector<double> parallelFor;
+        std::vector<double> tinyJobs;
+        for (int rep = 0; rep <= Repetitions; ++rep) {
+            for (uint32_t i = 0; i < ElementCount; ++i) {
+                data[i] = static_cast<float>(i % 1024) * 0.001f;
+            }
+
+            double forMs = TimeMs([&]() {
+                jobs.ParallelFor(ElementCount, [&data](uint32_t begin, uint32_t end) { Work(data, begin, end); });
+            });
+
+            std::atomic<uint32_t> sink{0};
+            double tinyMs = TimeMs([&]() {
+                JobCounter counter;
+                for (uint32_t i = 0; i < TinyJobCount; ++i) {
+                    jobs.Run([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }, &counter);
+                }
+                jobs.Wait(counter);
+            });
+
+            // First iteration warms caches and wakes workers
+            if (rep > 0) {
+                parallelFor.push_back(forMs);
+                tinyJobs.push_back(tinyMs);
+            }
+        }
+        results.push_back({threads, MedianMs(parallelFor), MedianMs(tinyJobs)});
+    }
+
+    const Result& baseline = results.front();
+    std::printf("%8s %14s %9s %11s %14s %12s\n", "threads", "parallel ms", "speedup", "efficiency", "tiny jobs ms",
+                "ns / job");
+    for (const Result& result : results) {
+        const double speedup = baseline.parallelForMs / result.parallelForMs;
+        std::printf("%8u %14.2f %8.2fx %10.0f%% %14.2f %12.1f\n", result.threads, result.parallelForMs, speedup,
+                    100.0 * speedup / result.threads, result.tinyJobsMs,
+                    result.tinyJobsMs * 1.0e6 / TinyJobCount);
+    }
+    return 0;
+}
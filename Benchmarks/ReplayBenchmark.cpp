@@ -0,0 +1,163 @@
+// Headless replay benchmark for the editor command system.
+//
+// Replays a session log written by SessionRecorder (Edit > Record Session in
+// the editor) at full speed against the scene it was recorded on, and
+// prints throughput and per-operation latency for CommandManager, scene
+// storage and undo/redo. Without an argument it records a synthetic session
+// first: gizmo drags, recolors, deletes, bulk moves and undo/redo bursts on
+// a 10k-entity scene.
+//
+// Usage: ReplayBenchmark [session.vsession]
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Commands/BuiltinCommands.h"
+#include "Commands/CommandManager.h"
+#include "Commands/SessionRecorder.h"
+#include "Commands/SessionReplay.h"
+#include "Core/Log.h"
+#include "Scene/Scene.h"
+
+using namespace Vest;
+
+namespace {
+
+constexpr int Repetitions = 5;
+constexpr int SyntheticEntityCount = 10000;
+constexpr int SyntheticRounds = 2000;
+
+double Median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+bool RecordSyntheticSession(const std::filesystem::path& path) {
+    Scene scene;
+    for (int i = 0; i < SyntheticEntityCount; ++i) {
+        SceneObject object;
+        object.name = "Entity " + std::to_string(i);
+        object.position = glm::vec3(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f);
+        scene.CreateEntity(object);
+    }
+
+    SessionRecorder recorder;
+    if (!recorder.Begin(path, scene)) {
+        return false;
+    }
+    CommandManager manager;
+    manager.SetSessionRecorder(&recorder);
+
+    std::mt19937 random(42);
+    auto pick = [&]() { return scene.GetHandleAt(random() % scene.Size()); };
+
+    for (int round = 0; round < SyntheticRounds; ++round) {
+        // A gizmo drag: 60 frames of registered steps that merge into one
+        const EntityHandle dragged = pick();
+        const glm::vec3 start = scene.TryGet(dragged)->position;
+        glm::vec3 previous = start;
+        for (int frame = 1; frame <= 60; ++frame) {
+            const glm::vec3 next = start + glm::vec3(0.1f * static_cast<float>(frame), 0.0f, 0.0f);
+            scene.TryGetMutable(dragged)->position = next;
+            manager.RegisterExecutedCommand(MakeCommand<TransformCommand>(
+                &scene, dragged, TransformCommand::Type::Position, previous, next));
+            previous = next;
+        }
+
+        const EntityHandle recolored = pick();
+        manager.ExecuteCommand(MakeCommand<ModifyColorCommand>(&scene, recolored, scene.TryGet(recolored)->color,
+                                                               glm::vec4(0.5f, 0.5f, 1.0f, 1.0f)));
+
+        if (round % 10 == 0) {
+            std::vector<EntityHandle> selection;
+            std::vector<glm::vec3> before;
+            std::vector<glm::vec3> after;
+            for (int i = 0; i < 500; ++i) {
+                const EntityHandle entity = pick();
+                selection.push_back(entity);
+                before.push_back(scene.TryGet(entity)->position);
+                after.push_back(before.back() + glm::vec3(0.0f, 1.0f, 0.0f));
+            }
+            manager.ExecuteCommand(MakeCommand<BulkTransformCommand>(&scene, TransformCommand::Type::Position,
+                                                                     selection, before, after));
+        }
+        if (round % 7 == 0) {
+            manager.ExecuteCommand(MakeCommand<DeleteEntityCommand>(&scene, pick()));
+        }
+        if (round % 25 == 0) {
+            for (int i = 0; i < 5; ++i) {
+                manager.Undo();
+            }
+            for (int i = 0; i < 3; ++i) {
+                manager.Redo();
+            }
+        }
+    }
+
+    manager.SetSessionRecorder(nullptr);
+    recorder.End();
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Log::Init();
+    Log::GetCoreLogger()->set_level(spdlog::level::warn);
+    RegisterBuiltinCommands();
+
+    std::filesystem::path path;
+    bool synthetic = argc < 2;
+    if (synthetic) {
+        path = std::filesystem::temp_directory_path() / "VestEngine" / "synthetic.vsession";
+        if (!RecordSyntheticSession(path)) {
+            return 1;
+        }
+    } else {
+        path = argv[1];
+    }
+
+    SessionLog log;
+    if (!log.Load(path)) {
+        return 1;
+    }
+    std::printf("Session: %s\n", path.string().c_str());
+    std::printf("  %zu entities, %zu events, %.1f s recorded\n\n", log.GetEntityCount(), log.GetEvents().size(),
+                log.GetDurationSeconds());
+
+    std::vector<double> totals;
+    SessionReplayStats stats;
+    for (int rep = 0; rep <= Repetitions; ++rep) {
+        Scene scene;
+        CommandManager manager;
+        if (!ReplaySession(log, scene, manager, &stats)) {
+            std::printf("Replay stopped early after %zu events\n", stats.events);
+        }
+        // First iteration warms caches and the command pools
+        if (rep > 0) {
+            totals.push_back(stats.totalMs);
+        }
+    }
+
+    const double totalMs = Median(totals);
+    std::printf("Replay, median of %d runs\n", Repetitions);
+    std::printf("  total        %10.2f ms\n", totalMs);
+    std::printf("  throughput   %10.0f events/s\n", stats.events * 1000.0 / totalMs);
+    std::printf("  commands     %10zu\n", stats.commands);
+    std::printf("  undo / redo  %10zu / %zu\n", stats.undos, stats.redos);
+    std::printf("  failures     %10zu\n\n", stats.failures);
+    std::printf("Latency (last run)\n");
+    std::printf("  p50          %10.2f us\n", stats.GetPercentileUs(50.0));
+    std::printf("  p99          %10.2f us\n", stats.GetPercentileUs(99.0));
+    std::printf("  max          %10.2f us\n", stats.GetPercentileUs(100.0));
+
+    if (synthetic) {
+        std::filesystem::remove(path);
+    }
+    Log::Shutdown();
+    return 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Commands/BulkCommands.h"
+#include "Commands/CommandRegistry.h"
+#include "Commands/EntityCommands.h"
+#include "Commands/MacroCommand.h"
+#include "Commands/TransformCommand.h"
+
+namespace Vest {
+
+/**
+ * @brief Register the editor's command types so spilled history can be read back
+ */
+inline void RegisterBuiltinCommands() {
+    CommandRegistry::Register<TransformCommand>();
+    CommandRegistry::Register<CreateEntityCommand>();
+    CommandRegistry::Register<DeleteEntityCommand>();
+    CommandRegistry::Register<ModifyColorCommand>();
+    CommandRegistry::Register<SetParentCommand>();
+    CommandRegistry::Register<MacroCommand>();
+    CommandRegistry::Register<BulkTransformCommand>();
+    CommandRegistry::Register<BulkSetColorCommand>();
+    CommandRegistry::Register<BulkDeleteCommand>();
+    CommandRegistry::Register<BulkCreateCommand>();
+}
+
+}  // namespace Vest
@@ -0,0 +1,446 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Commands/ICommand.h"
+#include "Commands/CommandPool.h"
+#include "Commands/TransformCommand.h"
+#include <Scene/Scene.h>
+
+namespace Vest {
+
+/**
+ * @brief Sort a bulk command's handles by slot index, permuting its value arrays alike
+ *
+ * Sorted payloads walk the scene's slot table forwards when applied and
+ * let two commands over the same selection be compared directly. A handle
+ * listed more than once keeps its first values.
+ */
+template <typename... Values>
+void SortBulkPayload(std::vector<EntityHandle>& entities, std::vector<Values>&... values) {
+    assert(((values.size() == entities.size()) && ...));
+
+    auto before = [&entities](size_t a, size_t b) {
+        if (entities[a].GetIndex() != entities[b].GetIndex()) {
+            return entities[a].GetIndex() < entities[b].GetIndex();
+        }
+        return entities[a].value < entities[b].value;
+    };
+    std::vector<size_t> order(entities.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), before);
+    order.erase(std::unique(order.begin(), order.end(),
+                            [&entities](size_t a, size_t b) { return entities[a] == entities[b]; }),
+                order.end());
+
+    auto permute = [&order](auto& array) {
+        std::remove_reference_t<decltype(array)> sorted;
+        sorted.reserve(order.size());
+        for (size_t index : order) {
+            sorted.push_back(array[index]);
+        }
+        array = std::move(sorted);
+    };
+    (permute(values), ...);
+    permute(entities);
+}
+
+/**
+ * @brief Transform many entities as one undo step
+ *
+ * The before/after values are packed arrays parallel to the sorted handle
+ * list, so a 10k-entity move is one command with three allocations rather
+ * than 10k TransformCommands.
+ */
+class BulkTransformCommand : public ICommand {
+public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("BulkTransformCommand");
+
+    BulkTransformCommand(Scene* scene,
+                         TransformCommand::Type type,
+                         std::vector<EntityHandle> entities,
+                         std::vector<glm::vec3> oldValues,
+                         std::vector<glm::vec3> newValues)
+        : m_Scene(scene)
+        , m_Type(type)
+        , m_Entities(std::move(entities))
+        , m_OldValues(std::move(oldValues))
+        , m_NewValues(std::move(newValues))
+    {
+        SortBulkPayload(m_Entities, m_OldValues, m_NewValues);
+        m_Name = MakeName(m_Type, m_Entities.size());
+    }
+
+    bool Execute() override { return Apply(m_NewValues); }
+    bool Undo() override { return Apply(m_OldValues); }
+
+    std::string_view GetName() const override { return m_Name.View(); }
+
+    size_t GetMemoryFootprint() const override {
+        return sizeof(*this) + m_Entities.capacity() * sizeof(EntityHandle) +
+               (m_OldValues.capacity() + m_NewValues.capacity()) * sizeof(glm::vec3);
+    }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(m_Type);
+        writer.WriteArray(m_Entities);
+        writer.WriteArray(m_OldValues);
+        writer.WriteArray(m_NewValues);
+        return true;
+    }
+
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        TransformCommand::Type type = TransformCommand::Type::Position;
+        std::vector<EntityHandle> entities;
+        std::vector<glm::vec3> oldValues;
+        std::vector<glm::vec3> newValues;
+        reader.ReadScene(scene);
+        reader.Read(type);
+        reader.ReadArray(entities);
+        reader.ReadArray(oldValues);
+        reader.ReadArray(newValues);
+        if (oldValues.size() != entities.size() || newValues.size() != entities.size()) {
+            reader.Fail();
+            return nullptr;
+        }
+        return MakeCommand<BulkTransformCommand>(scene, type, std::move(entities),
+                                                 std::move(oldValues), std::move(newValues));
+    }
+
+    /**
+     * @brief Fold a later drag of the same selection into this one; both handle lists are sorted
+     */
+    bool MergeWith(const BulkTransformCommand& next) {
+        if (m_Type != next.m_Type || m_Entities != next.m_Entities) return false;
+
+        m_NewValues = next.m_NewValues;
+        return true;
+    }
+
+    const std::vector<EntityHandle>& GetEntities() const { return m_Entities; }
+
+private:
+    static InternedString MakeName(TransformCommand::Type type, size_t count) {
+        const char* verb = "Transform ";
+        switch (type) {
+            case TransformCommand::Type::Position: verb = "Move "; break;
+            case TransformCommand::Type::Rotation: verb = "Rotate "; break;
+            case TransformCommand::Type::Scale:    verb = "Scale "; break;
+            case TransformCommand::Type::All:      break;
+        }
+        return std::string(verb).append(std::to_string(count)).append(" Entities");
+    }
+
+    bool Apply(const std::vector<glm::vec3>& values) {
+        if (!m_Scene) return false;
+
+        // Pick the component once so the loop body is a plain store
+        glm::vec3 SceneObject::*component = &SceneObject::position;
+        if (m_Type == TransformCommand::Type::Rotation) component = &SceneObject::rotation;
+        if (m_Type == TransformCommand::Type::Scale) component = &SceneObject::scale;
+
+        size_t applied = 0;
+        for (size_t i = 0; i < m_Entities.size(); ++i) {
+            if (SceneObject* object = m_Scene->TryGetMutable(m_Entities[i])) {
+                object->*component = values[i];
+                ++applied;
+            }
+        }
+        return applied == m_Entities.size();
+    }
+
+    Scene* m_Scene;
+    TransformCommand::Type m_Type;
+    std::vector<EntityHandle> m_Entities;
+    std::vector<glm::vec3> m_OldValues;
+    std::vector<glm::vec3> m_NewValues;
+    InternedString m_Name;
+};
+
+/**
+ * @brief Recolor many entities as one undo step
+ */
+class BulkSetColorCommand : public ICommand {
+public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("BulkSetColorCommand");
+
+    BulkSetColorCommand(Scene* scene,
+                        std::vector<EntityHandle> entities,
+                        std::vector<glm::vec4> oldColors,
+                        std::vector<glm::vec4> newColors)
+        : m_Scene(scene)
+        , m_Entities(std::move(entities))
+        , m_OldColors(std::move(oldColors))
+        , m_NewColors(std::move(newColors))
+    {
+        SortBulkPayload(m_Entities, m_OldColors, m_NewColors);
+        m_Name = MakeName(m_Entities.size());
+    }
+
+    /**
+     * @brief Give every entity the same color, capturing the current colors for undo
+     */
+    BulkSetColorCommand(Scene* scene, std::vector<EntityHandle> entities, const glm::vec4& color)
+        : m_Scene(scene)
+        , m_Entities(std::move(entities))
+    {
+        m_OldColors.reserve(m_Entities.size());
+        for (EntityHandle entity : m_Entities) {
+            const SceneObject* object = m_Scene ? m_Scene->TryGet(entity) : nullptr;
+            m_OldColors.push_back(object ? object->color : color);
+        }
+        m_NewColors.assign(m_Entities.size(), color);
+        SortBulkPayload(m_Entities, m_OldColors, m_NewColors);
+        m_Name = MakeName(m_Entities.size());
+    }
+
+    bool Execute() override { return Apply(m_NewColors); }
+    bool Undo() override { return Apply(m_OldColors); }
+
+    std::string_view GetName() const override { return m_Name.View(); }
+
+    size_t GetMemoryFootprint() const override {
+        return sizeof(*this) + m_Entities.capacity() * sizeof(EntityHandle) +
+               (m_OldColors.capacity() + m_NewColors.capacity()) * sizeof(glm::vec4);
+    }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.WriteArray(m_Entities);
+        writer.WriteArray(m_OldColors);
+        writer.WriteArray(m_NewColors);
+        return true;
+    }
+
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        std::vector<EntityHandle> entities;
+        std::vector<glm::vec4> oldColors;
+        std::vector<glm::vec4> newColors;
+        reader.ReadScene(scene);
+        reader.ReadArray(entities);
+        reader.ReadArray(oldColors);
+        reader.ReadArray(newColors);
+        if (oldColors.size() != entities.size() || newColors.size() != entities.size()) {
+            reader.Fail();
+            return nullptr;
+        }
+        return MakeCommand<BulkSetColorCommand>(scene, std::move(entities),
+                                                std::move(oldColors), std::move(newColors));
+    }
+
+private:
+    static InternedString MakeName(size_t count) {
+        return "Modify Color (" + std::to_string(count) + " Entities)";
+    }
+
+    bool Apply(const std::vector<glm::vec4>& colors) {
+        if (!m_Scene) return false;
+
+        size_t applied = 0;
+        for (size_t i = 0; i < m_Entities.size(); ++i) {
+            if (SceneObject* object = m_Scene->TryGetMutable(m_Entities[i])) {
+                object->color = colors[i];
+                ++applied;
+            }
+        }
+        return applied == m_Entities.size();
+    }
+
+    Scene* m_Scene;
+    std::vector<EntityHandle> m_Entities;
+    std::vector<glm::vec4> m_OldColors;
+    std::vector<glm::vec4> m_NewColors;
+    InternedString m_Name;
+};
+
+/**
+ * @brief Delete many entities as one undo step
+ *
+ * Execute and Undo each make a single pass over the scene
+ * (Scene::DestroyEntities / RestoreEntities) instead of one structural
+ * change per entity.
+ */
+class BulkDeleteCommand : public ICommand {
+public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("BulkDeleteCommand");
+
+    BulkDeleteCommand(Scene* scene, std::vector<EntityHandle> entities)
+        : m_Scene(scene)
+        , m_Entities(std::move(entities))
+    {
+        // Capture the entities before deletion; stale handles are dropped
+        std::erase_if(m_Entities, [this](EntityHandle entity) { return !m_Scene || !m_Scene->IsValid(entity); });
+        m_DeletedEntities.reserve(m_Entities.size());
+        for (EntityHandle entity : m_Entities) {
+            m_DeletedEntities.push_back(*m_Scene->TryGet(entity));
+        }
+        SortBulkPayload(m_Entities, m_DeletedEntities);
+        m_Name = MakeName(m_Entities.size());
+    }
+
+    bool Execute() override {
+        if (!m_Scene || m_Entities.empty()) return false;
+
+        return m_Scene->DestroyEntities(m_Entities) == m_Entities.size();
+    }
+
+    bool Undo() override {
+        if (!m_Scene) return false;
+
+        return m_Scene->RestoreEntities(m_Entities, m_DeletedEntities) == m_Entities.size();
+    }
+
+    std::string_view GetName() const override { return m_Name.View(); }
+
+    // SceneObject names are interned, so the captured copies own no heap memory
+    size_t GetMemoryFootprint() const override {
+        return sizeof(*this) + m_Entities.capacity() * sizeof(EntityHandle) +
+               m_DeletedEntities.capacity() * sizeof(SceneObject);
+    }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.WriteArray(m_Entities);
+        for (const SceneObject& object : m_DeletedEntities) {
+            writer.WriteSceneObject(object);
+        }
+        return true;
+    }
+
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        reader.ReadScene(scene);
+        // The entities are already gone from the scene; restore the captured copies directly
+        auto command = MakeCommand<BulkDeleteCommand>(nullptr, std::vector<EntityHandle>());
+        command->m_Scene = scene;
+        reader.ReadArray(command->m_Entities);
+        command->m_DeletedEntities.resize(command->m_Entities.size());
+        for (SceneObject& object : command->m_DeletedEntities) {
+            if (!reader.ReadSceneObject(object)) {
+                break;
+            }
+        }
+        command->m_Name = MakeName(command->m_Entities.size());
+        return command;
+    }
+
+    const std::vector<EntityHandle>& GetEntities() const { return m_Entities; }
+
+private:
+    static InternedString MakeName(size_t count) {
+        return "Delete " + std::to_string(count) + " Entities";
+    }
+
+    Scene* m_Scene;
+    std::vector<EntityHandle> m_Entities;
+    std::vector<SceneObject> m_DeletedEntities;
+    InternedString m_Name;
+};
+
+/**
+ * @brief Create many entities as one undo step
+ *
+ * Like CreateEntityCommand, the first execution allocates handles and redo
+ * revives those same handles. The handles are parallel to the objects
+ * passed in, so they are kept in creation order rather than sorted.
+ */
+class BulkCreateCommand : public ICommand {
+public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("BulkCreateCommand");
+
+    BulkCreateCommand(Scene* scene, std::vector<SceneObject> entities)
+        : m_Scene(scene)
+        , m_Entities(std::move(entities))
+        , m_Name("Create " + std::to_string(m_Entities.size()) + " Entities")
+    {
+    }
+
+    bool Execute() override {
+        if (!m_Scene || m_Entities.empty()) return false;
+
+        if (!m_Handles.empty()) {
+            return m_Scene->RestoreEntities(m_Handles, m_Entities) == m_Handles.size();
+        }
+
+        m_Handles.reserve(m_Entities.size());
+        for (const SceneObject& entity : m_Entities) {
+            EntityHandle handle = m_Scene->CreateEntity(entity);
+            if (handle.IsNull()) {
+                // Out of slots: leave the scene as it was
+                m_Scene->DestroyEntities(m_Handles);
+                m_Handles.clear();
+                return false;
+            }
+            m_Handles.push_back(handle);
+        }
+        return true;
+    }
+
+    bool Undo() override {
+        if (!m_Scene) return false;
+
+        return m_Scene->DestroyEntities(m_Handles) == m_Handles.size();
+    }
+
+    std::string_view GetName() const override { return m_Name.View(); }
+
+    size_t GetMemoryFootprint() const override {
+        return sizeof(*this) + m_Entities.capacity() * sizeof(SceneObject) +
+               m_Handles.capacity() * sizeof(EntityHandle);
+    }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(static_cast<uint32_t>(m_Entities.size()));
+        for (const SceneObject& object : m_Entities) {
+            writer.WriteSceneObject(object);
+        }
+        writer.WriteArray(m_Handles);
+        return true;
+    }
+
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        uint32_t count = 0;
+        reader.ReadScene(scene);
+        reader.Read(count);
+        std::vector<SceneObject> entities;
+        for (uint32_t i = 0; i < count && reader.IsOk(); ++i) {
+            reader.ReadSceneObject(entities.emplace_back());
+        }
+        auto command = MakeCommand<BulkCreateCommand>(scene, std::move(entities));
+        reader.ReadArray(command->m_Handles);
+        if (!command->m_Handles.empty() && command->m_Handles.size() != command->m_Entities.size()) {
+            reader.Fail();
+        }
+        return command;
+    }
+
+    /**
+     * @brief Handles of the created entities, parallel to the objects; empty before the first Execute()
+     */
+    const std::vector<EntityHandle>& GetCreatedEntities() const { return m_Handles; }
+
+private:
+    Scene* m_Scene;
+    std::vector<SceneObject> m_Entities;
+    std::vector<EntityHandle> m_Handles;
+    InternedString m_Name;
+};
+
+}  // namespace Vest
@@ -1,28 +1,66 @@
 #pragma once
 
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <string_view>
 #include <vector>
 #include <memory>
-#include <deque>
 
 #include "Core/Base.h"
 #include "Core/Log.h"
+#include "Core/MemoryTracker.h"
 #include "Commands/ICommand.h"
+#include "Commands/CommandPool.h"
+#include "Commands/CommandRegistry.h"
+#include "Commands/CommandSpillFile.h"
+#include "Commands/SessionRecorder.h"
 
 namespace Vest {
 
 /**
  * @brief Manages command execution, undo, and redo operations
- * 
+ *
  * The CommandManager maintains two stacks:
  * - Undo stack: commands that can be undone
  * - Redo stack: commands that can be redone
- * 
+ *
  * It also supports command merging for consecutive similar operations.
+ * Merges are dispatched through CommandRegistry::TryMerge(), so only
+ * registered command types merge (see RegisterBuiltinCommands()).
+ *
+ * History is bounded by a memory budget rather than a command count: the
+ * footprints reported by ICommand::GetMemoryFootprint() are summed over the
+ * undo stack and its oldest steps are evicted once the total exceeds the
+ * budget. The most recent command is always kept, even if it alone is over
+ * budget. An optional count limit can be set on top. The redo stack is not
+ * budgeted: it only holds steps that fit the undo history before they were
+ * undone, and it is cleared before a new command is added, so it never
+ * pushes out undo steps.
+ *
+ * With EnableSpilling(), old steps are written to an append-only spill file
+ * instead of being evicted: once more than the hot command limit are in
+ * memory (or the budget is exceeded), the oldest in-memory steps are
+ * serialized through CommandRegistry and handed to the file's I/O thread.
+ * Spilled steps are always the oldest ones. When undo gets within a few
+ * steps of them they are prefetched in the background, and the newest undo
+ * step is always kept in memory, so Undo() on recent history never waits
+ * for the disk.
+ *
+ * Commands are held as CommandPtr, so pooled commands (MakeCommand) go back
+ * to their pool when they are merged away or fall out of the history. The
+ * undo stack is a ring buffer and the redo stack a vector; neither
+ * allocates once it has grown to the history size.
  */
 class CommandManager {
 public:
-    explicit CommandManager(size_t maxHistorySize = 50)
-        : m_MaxHistorySize(maxHistorySize)
+    static constexpr size_t DefaultMemoryBudget = 16 * 1024 * 1024;
+    static constexpr size_t UnlimitedHistory = std::numeric_limits<size_t>::max();
+    static constexpr size_t DefaultHotCommandLimit = 256;
+    static constexpr size_t PrefetchDistance = 16;
+
+    explicit CommandManager(size_t memoryBudget = DefaultMemoryBudget)
+        : m_MemoryBudget(memoryBudget)
     {
     }
 
@@ -31,7 +69,8 @@ public:
      * @param command Command to execute
      * @return true if successful
      */
-    bool ExecuteCommand(Scope<ICommand> command) {
+    bool ExecuteCommand(CommandPtr command) {
+        VEST_MEMORY_TAG(Commands);
         if (!command) {
             VEST_CORE_WARN("Attempted to execute null command");
             return false;
@@ -43,62 +82,53 @@ public:
         }
 
         VEST_CORE_TRACE("Executed command: {0}", command->GetName());
+        if (m_Recorder) {
+            m_Recorder->RecordCommand(SessionOp::Execute, *command);
+        }
 
         // Try to merge with previous command
-        if (!m_UndoStack.empty() && m_UndoStack.back()->CanMergeWith(command.get())) {
-            if (m_UndoStack.back()->MergeWith(command.get())) {
-                VEST_CORE_TRACE("Merged with previous command");
-                return true;
-            }
+        if (TryMergeWithLast(command.get())) {
+            return true;
         }
 
-        // Add to undo stack
-        m_UndoStack.push_back(std::move(command));
+        // Clear redo stack (can't redo after new command) before the new step is budgeted
+        ClearRedo();
 
-        // Clear redo stack (can't redo after new command)
-        m_RedoStack.clear();
-
-        // Enforce history limit
-        while (m_UndoStack.size() > m_MaxHistorySize) {
-            m_UndoStack.pop_front();
-        }
+        // Add to undo stack
+        PushUndo(std::move(command));
 
         return true;
     }
 
     /**
      * @brief Register a command that has already been executed
-     * Useful for interactive operations like gizmo manipulation where the 
+     * Useful for interactive operations like gizmo manipulation where the
      * change is applied in real-time but needs to be added to undo history
      * @param command Already-executed command
      * @return true if successful
      */
-    bool RegisterExecutedCommand(Scope<ICommand> command) {
+    bool RegisterExecutedCommand(CommandPtr command) {
+        VEST_MEMORY_TAG(Commands);
         if (!command) {
             VEST_CORE_WARN("Attempted to register null command");
             return false;
         }
 
         VEST_CORE_TRACE("Registered executed command: {0}", command->GetName());
+        if (m_Recorder) {
+            m_Recorder->RecordCommand(SessionOp::Register, *command);
+        }
 
         // Try to merge with previous command
-        if (!m_UndoStack.empty() && m_UndoStack.back()->CanMergeWith(command.get())) {
-            if (m_UndoStack.back()->MergeWith(command.get())) {
-                VEST_CORE_TRACE("Merged with previous command");
-                return true;
-            }
+        if (TryMergeWithLast(command.get())) {
+            return true;
         }
 
-        // Add to undo stack without executing
-        m_UndoStack.push_back(std::move(command));
-
         // Clear redo stack
-        m_RedoStack.clear();
+        ClearRedo();
 
-        // Enforce history limit
-        while (m_UndoStack.size() > m_MaxHistorySize) {
-            m_UndoStack.pop_front();
-        }
+        // Add to undo stack without executing
+        PushUndo(std::move(command));
 
         return true;
     }
@@ -108,22 +138,34 @@ public:
      * @return true if successful
      */
     bool Undo() {
-        if (m_UndoStack.empty()) {
+        if (m_UndoCount == 0) {
             VEST_CORE_TRACE("Nothing to undo");
             return false;
         }
 
-        auto& command = m_UndoStack.back();
-        if (!command->Undo()) {
-            VEST_CORE_ERROR("Command undo failed: {0}", command->GetName());
+        HistoryEntry& entry = UndoBack();
+        if (!entry.command->Undo()) {
+            VEST_CORE_ERROR("Command undo failed: {0}", entry.command->GetName());
             return false;
         }
 
-        VEST_CORE_TRACE("Undid command: {0}", command->GetName());
+        VEST_CORE_TRACE("Undid command: {0}", entry.command->GetName());
+        if (m_Recorder) {
+            m_Recorder->RecordOp(SessionOp::Undo);
+        }
 
         // Move to redo stack
-        m_RedoStack.push_back(std::move(command));
-        m_UndoStack.pop_back();
+        m_UndoBytes -= entry.bytes;
+        m_RedoBytes += entry.bytes;
+        m_RedoStack.push_back(std::move(entry));
+        --m_UndoCount;
+
+        if (m_SpilledCount > 0) {
+            if (m_SpilledCount == m_UndoCount) {
+                FaultInNewestSpilled();
+            }
+            PrefetchSpilled();
+        }
 
         return true;
     }
@@ -138,16 +180,20 @@ public:
             return false;
         }
 
-        auto& command = m_RedoStack.back();
-        if (!command->Execute()) {
-            VEST_CORE_ERROR("Command redo failed: {0}", command->GetName());
+        HistoryEntry& entry = m_RedoStack.back();
+        if (!entry.command->Execute()) {
+            VEST_CORE_ERROR("Command redo failed: {0}", entry.command->GetName());
             return false;
         }
 
-        VEST_CORE_TRACE("Redid command: {0}", command->GetName());
+        VEST_CORE_TRACE("Redid command: {0}", entry.command->GetName());
+        if (m_Recorder) {
+            m_Recorder->RecordOp(SessionOp::Redo);
+        }
 
         // Move back to undo stack
-        m_UndoStack.push_back(std::move(command));
+        m_RedoBytes -= entry.bytes;
+        PushUndo(std::move(entry.command));
         m_RedoStack.pop_back();
 
         return true;
@@ -156,7 +202,7 @@ public:
     /**
      * @brief Check if undo is available
      */
-    bool CanUndo() const { return !m_UndoStack.empty(); }
+    bool CanUndo() const { return m_UndoCount > 0; }
 
     /**
      * @brief Check if redo is available
@@ -166,30 +212,42 @@ public:
     /**
      * @brief Get the name of the next command that would be undone
      */
-    std::string GetUndoCommandName() const {
-        return m_UndoStack.empty() ? "" : m_UndoStack.back()->GetName();
+    std::string_view GetUndoCommandName() const {
+        return m_UndoCount == 0 ? "" : UndoBack().command->GetName();
     }
 
     /**
      * @brief Get the name of the next command that would be redone
      */
-    std::string GetRedoCommandName() const {
-        return m_RedoStack.empty() ? "" : m_RedoStack.back()->GetName();
+    std::string_view GetRedoCommandName() const {
+        return m_RedoStack.empty() ? "" : m_RedoStack.back().command->GetName();
     }
 
     /**
      * @brief Clear all undo/redo history
      */
     void Clear() {
-        m_UndoStack.clear();
-        m_RedoStack.clear();
+        for (auto& entry : m_UndoStack) {
+            entry = HistoryEntry();
+        }
+        m_UndoBegin = 0;
+        m_UndoCount = 0;
+        m_UndoBytes = 0;
+        m_SpilledCount = 0;
+        if (m_Spill) {
+            m_Spill->Truncate();
+        }
+        ClearRedo();
+        if (m_Recorder) {
+            m_Recorder->RecordOp(SessionOp::Clear);
+        }
         VEST_CORE_INFO("Command history cleared");
     }
 
     /**
      * @brief Get the current size of the undo stack
      */
-    size_t GetUndoStackSize() const { return m_UndoStack.size(); }
+    size_t GetUndoStackSize() const { return m_UndoCount; }
 
     /**
      * @brief Get the current size of the redo stack
@@ -197,19 +255,233 @@ public:
     size_t GetRedoStackSize() const { return m_RedoStack.size(); }
 
     /**
-     * @brief Set maximum history size
+     * @brief Limit the number of undo steps in addition to the memory budget
      */
     void SetMaxHistorySize(size_t size) {
         m_MaxHistorySize = size;
-        while (m_UndoStack.size() > m_MaxHistorySize) {
-            m_UndoStack.pop_front();
+        EnforceLimits();
+    }
+
+    size_t GetMaxHistorySize() const { return m_MaxHistorySize; }
+
+    /**
+     * @brief Set the history memory budget in bytes, evicting the oldest undo steps if needed
+     */
+    void SetMemoryBudget(size_t bytes) {
+        m_MemoryBudget = bytes;
+        EnforceLimits();
+    }
+
+    size_t GetMemoryBudget() const { return m_MemoryBudget; }
+
+    /**
+     * @brief Spill the oldest undo steps to @p path instead of evicting them
+     * @param hotCommandLimit Undo steps kept in memory before older ones are spilled
+     * @return false if the file could not be created; history then stays memory-only
+     */
+    bool EnableSpilling(const std::filesystem::path& path, size_t hotCommandLimit = DefaultHotCommandLimit) {
+        auto spill = CreateScope<CommandSpillFile>();
+        if (!spill->Open(path)) {
+            return false;
         }
+        m_Spill = std::move(spill);
+        m_HotCommandLimit = std::max<size_t>(hotCommandLimit, 1);
+        EnforceLimits();
+        return true;
     }
 
+    /**
+     * @brief Log every history operation to @p recorder (null to stop); the recorder must outlive the attachment
+     */
+    void SetSessionRecorder(SessionRecorder* recorder) { m_Recorder = recorder; }
+    SessionRecorder* GetSessionRecorder() const { return m_Recorder; }
+
+    bool IsSpillingEnabled() const { return m_Spill != nullptr; }
+    size_t GetSpilledCommandCount() const { return m_SpilledCount; }
+    uint64_t GetSpillFileSize() const { return m_Spill ? m_Spill->GetSize() : 0; }
+
+    /**
+     * @brief Bytes held in memory by commands on both stacks; spilled steps are not counted
+     */
+    size_t GetMemoryUsage() const { return m_UndoBytes + m_RedoBytes; }
+    size_t GetUndoMemoryUsage() const { return m_UndoBytes; }
+    size_t GetRedoMemoryUsage() const { return m_RedoBytes; }
+
 private:
-    std::deque<Scope<ICommand>> m_UndoStack;
-    std::deque<Scope<ICommand>> m_RedoStack;
-    size_t m_MaxHistorySize;
+    struct HistoryEntry {
+        CommandPtr command;  // Null while spilled
+        size_t bytes = 0;    // Footprint when it entered the history, or after its last merge
+        CommandSpillFile::Record spill;  // Kept after a fault-in so an unchanged command is not rewritten
+        CommandSpillFile::ReadResult prefetch;
+    };
+
+    HistoryEntry& UndoAt(size_t index) { return m_UndoStack[(m_UndoBegin + index) % m_UndoStack.size()]; }
+    HistoryEntry& UndoBack() { return UndoAt(m_UndoCount - 1); }
+    const HistoryEntry& UndoBack() const { return m_UndoStack[(m_UndoBegin + m_UndoCount - 1) % m_UndoStack.size()]; }
+
+    size_t GetHotCount() const { return m_UndoCount - m_SpilledCount; }
+
+    bool TryMergeWithLast(const ICommand* command) {
+        if (m_UndoCount == 0) {
+            return false;
+        }
+
+        HistoryEntry& last = UndoBack();
+        if (!CommandRegistry::TryMerge(*last.command, *command)) {
+            return false;
+        }
+
+        // A merge can change what the surviving command holds
+        last.spill = CommandSpillFile::Record();
+        m_UndoBytes -= last.bytes;
+        last.bytes = last.command->GetMemoryFootprint();
+        m_UndoBytes += last.bytes;
+        VEST_CORE_TRACE("Merged with previous command");
+
+        EnforceLimits();
+        return true;
+    }
+
+    void ClearRedo() {
+        m_RedoStack.clear();
+        m_RedoBytes = 0;
+    }
+
+    void PopUndoFront() {
+        HistoryEntry& oldest = m_UndoStack[m_UndoBegin];
+        m_UndoBytes -= oldest.bytes;
+        oldest = HistoryEntry();
+        m_UndoBegin = (m_UndoBegin + 1) % m_UndoStack.size();
+        --m_UndoCount;
+        if (m_SpilledCount > 0) {
+            --m_SpilledCount;
+        }
+    }
+
+    // Spills or evicts the oldest in-memory steps, keeping the newest one regardless of the budget
+    void EnforceLimits() {
+        while (m_UndoCount > m_MaxHistorySize) {
+            PopUndoFront();
+        }
+
+        while (GetHotCount() > 1 && (m_UndoBytes > m_MemoryBudget ||
+                                     (m_Spill && GetHotCount() > m_HotCommandLimit))) {
+            if (!SpillOldestHot()) {
+                PopUndoFront();
+            }
+        }
+    }
+
+    bool SpillOldestHot() {
+        if (!m_Spill) {
+            return false;
+        }
+
+        HistoryEntry& entry = UndoAt(m_SpilledCount);
+        if (!entry.spill.IsValid()) {
+            if (!CommandRegistry::IsRegistered(entry.command->GetTypeId())) {
+                return false;
+            }
+            std::vector<std::byte> data;
+            if (!CommandRegistry::Serialize(*entry.command, data)) {
+                return false;
+            }
+            entry.spill = m_Spill->Append(std::move(data));
+        }
+
+        m_UndoBytes -= entry.bytes;
+        entry.bytes = 0;
+        entry.command.reset();
+        ++m_SpilledCount;
+        return true;
+    }
+
+    // Queue reads for the spilled steps undo is about to reach
+    void PrefetchSpilled() {
+        if (GetHotCount() > PrefetchDistance) {
+            return;
+        }
+
+        const size_t first = m_SpilledCount > PrefetchDistance ? m_SpilledCount - PrefetchDistance : 0;
+        for (size_t i = m_SpilledCount; i > first; --i) {
+            HistoryEntry& entry = UndoAt(i - 1);
+            if (!entry.prefetch.valid()) {
+                entry.prefetch = m_Spill->Read(entry.spill);
+            }
+        }
+    }
+
+    void FaultInNewestSpilled() {
+        HistoryEntry& entry = UndoAt(m_SpilledCount - 1);
+        if (!entry.prefetch.valid()) {
+            entry.prefetch = m_Spill->Read(entry.spill);
+        }
+
+        const std::vector<std::byte>& data = entry.prefetch.get();
+        CommandReader reader(data.data(), data.size());
+        CommandPtr command = data.empty() ? nullptr : CommandRegistry::Deserialize(reader);
+        entry.prefetch = CommandSpillFile::ReadResult();
+
+        if (!command) {
+            VEST_CORE_ERROR("Failed to restore spilled undo history; dropping {0} steps", m_SpilledCount);
+            while (m_SpilledCount > 0) {
+                PopUndoFront();
+            }
+            return;
+        }
+
+        entry.bytes = command->GetMemoryFootprint();
+        entry.command = std::move(command);
+        m_UndoBytes += entry.bytes;
+        --m_SpilledCount;
+    }
+
+    void PushUndo(CommandPtr command) {
+        if (m_MaxHistorySize == 0) {
+            return;
+        }
+        if (m_UndoCount == m_UndoStack.size()) {
+            GrowUndoStack();
+        }
+
+        HistoryEntry& entry = m_UndoStack[(m_UndoBegin + m_UndoCount) % m_UndoStack.size()];
+        entry = HistoryEntry();
+        entry.bytes = command->GetMemoryFootprint();
+        entry.command = std::move(command);
+        m_UndoBytes += entry.bytes;
+        ++m_UndoCount;
+
+        EnforceLimits();
+    }
+
+    // Re-linearizes the ring into a larger buffer
+    void GrowUndoStack() {
+        size_t capacity = m_UndoStack.empty() ? 16 : m_UndoStack.size() * 2;
+        capacity = std::min(capacity, std::max(m_MaxHistorySize, m_UndoCount + 1));
+
+        std::vector<HistoryEntry> grown(capacity);
+        for (size_t i = 0; i < m_UndoCount; ++i) {
+            grown[i] = std::move(m_UndoStack[(m_UndoBegin + i) % m_UndoStack.size()]);
+        }
+        m_UndoStack = std::move(grown);
+        m_UndoBegin = 0;
+    }
+
+    std::vector<HistoryEntry> m_UndoStack;  // Ring buffer of m_UndoCount entries starting at m_UndoBegin
+    size_t m_UndoBegin = 0;
+    size_t m_UndoCount = 0;
+    std::vector<HistoryEntry> m_RedoStack;
+
+    size_t m_UndoBytes = 0;
+    size_t m_RedoBytes = 0;
+    size_t m_MemoryBudget;
+    size_t m_MaxHistorySize = UnlimitedHistory;
+
+    Scope<CommandSpillFile> m_Spill;
+    size_t m_HotCommandLimit = DefaultHotCommandLimit;
+    size_t m_SpilledCount = 0;  // The oldest m_SpilledCount undo steps live in m_Spill
+
+    SessionRecorder* m_Recorder = nullptr;
 };
 
 }  // namespace Vest
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Core/MemoryTracker.h"
+#include "Core/ObjectPool.h"
+#include "Commands/ICommand.h"
+
+namespace Vest {
+
+/**
+ * @brief Deleter that returns a command to the allocator it came from
+ *
+ * Commands made with MakeCommand() go back to their type's pool. The
+ * converting constructor lets a heap-allocated Scope<T> be passed where a
+ * CommandPtr is expected, in which case the command is simply deleted.
+ */
+struct CommandDeleter {
+    using DestroyFn = void (*)(ICommand*);
+
+    CommandDeleter() = default;
+    explicit CommandDeleter(DestroyFn destroy) : destroy(destroy) {}
+
+    template <typename T, typename = std::enable_if_t<std::is_convertible_v<T*, ICommand*>>>
+    CommandDeleter(std::default_delete<T>) {}
+
+    void operator()(ICommand* command) const { destroy(command); }
+
+    static void HeapDestroy(ICommand* command) { delete command; }
+
+    DestroyFn destroy = &HeapDestroy;
+};
+
+using CommandPtr = std::unique_ptr<ICommand, CommandDeleter>;
+
+/**
+ * @brief Pool shared by every command of type T (main thread only)
+ */
+template <typename T>
+ObjectPool<T>& GetCommandPool() {
+    static ObjectPool<T> pool;
+    return pool;
+}
+
+/**
+ * @brief Construct a command in its type's pool
+ */
+template <typename T, typename... Args>
+std::unique_ptr<T, CommandDeleter> MakeCommand(Args&&... args) {
+    static_assert(std::is_base_of_v<ICommand, T>, "Commands must derive from ICommand");
+    VEST_MEMORY_TAG(Commands);
+    T* command = GetCommandPool<T>().Create(std::forward<Args>(args)...);
+    return std::unique_ptr<T, CommandDeleter>(command, CommandDeleter([](ICommand* pooled) {
+        GetCommandPool<T>().Destroy(static_cast<T*>(pooled));
+    }));
+}
+
+}  // namespace Vest
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "Commands/CommandPool.h"
+#include "Commands/CommandSerialization.h"
+#include "Commands/ICommand.h"
+
+namespace Vest {
+
+/**
+ * @brief Command type that can fold a later command of its own type into itself
+ */
+template <typename T>
+concept MergeableCommand = requires(T& last, const T& next) {
+    { last.MergeWith(next) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Per-type tables keyed by command type ID: deserializers for spilled
+ * commands and merge functions for CommandManager
+ *
+ * A command type is registered with Register<T>(), which requires
+ * T::TypeId and a static T::Deserialize(CommandReader&); types satisfying
+ * MergeableCommand are added to the merge table as well. The editor's own
+ * commands are registered by RegisterBuiltinCommands().
+ */
+class CommandRegistry {
+public:
+    using DeserializeFn = CommandPtr (*)(CommandReader&);
+    using MergeFn = bool (*)(ICommand& last, const ICommand& next);
+
+    template <typename T>
+    static void Register() {
+        GetDeserializers()[T::TypeId] = &T::Deserialize;
+        if constexpr (MergeableCommand<T>) {
+            GetMergers()[T::TypeId] = [](ICommand& last, const ICommand& next) {
+                return static_cast<T&>(last).MergeWith(static_cast<const T&>(next));
+            };
+        }
+    }
+
+    /**
+     * @brief Fold @p next into @p last if both are the same registered, mergeable type
+     *
+     * The type IDs are compared first and the merge function comes from the
+     * table, so the check costs no RTTI and no allocation.
+     */
+    static bool TryMerge(ICommand& last, const ICommand& next) {
+        const CommandTypeId typeId = last.GetTypeId();
+        if (typeId != next.GetTypeId()) {
+            return false;
+        }
+        auto it = GetMergers().find(typeId);
+        return it != GetMergers().end() && it->second(last, next);
+    }
+
+    static bool IsRegistered(CommandTypeId typeId) { return GetDeserializers().count(typeId) > 0; }
+
+    /**
+     * @brief Append the command's type ID and state to @p data
+     * @return false if the command type does not support serialization
+     */
+    static bool Serialize(const ICommand& command, std::vector<std::byte>& data) {
+        const size_t start = data.size();
+        CommandWriter writer(data);
+        writer.Write(command.GetTypeId());
+        if (!command.Serialize(writer)) {
+            data.resize(start);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Rebuild a command written by Serialize(); null if the type is unknown or the data is truncated
+     */
+    static CommandPtr Deserialize(CommandReader& reader) {
+        CommandTypeId typeId = 0;
+        if (!reader.Read(typeId)) {
+            return nullptr;
+        }
+
+        auto it = GetDeserializers().find(typeId);
+        if (it == GetDeserializers().end()) {
+            reader.Fail();  // Unknown size, nothing after this can be read
+            return nullptr;
+        }
+
+        CommandPtr command = it->second(reader);
+        return reader.IsOk() ? std::move(command) : nullptr;
+    }
+
+private:
+    static std::unordered_map<CommandTypeId, DeserializeFn>& GetDeserializers() {
+        static std::unordered_map<CommandTypeId, DeserializeFn> deserializers;
+        return deserializers;
+    }
+
+    static std::unordered_map<CommandTypeId, MergeFn>& GetMergers() {
+        static std::unordered_map<CommandTypeId, MergeFn> mergers;
+        return mergers;
+    }
+};
+
+}  // namespace Vest
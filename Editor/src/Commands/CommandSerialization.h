@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <Scene/SceneObject.h>
+
+namespace Vest {
+
+class Scene;
+
+/**
+ * @brief Stable identifier of a command type, written in front of every spilled command
+ */
+using CommandTypeId = uint32_t;
+
+/**
+ * @brief FNV-1a hash of a type name, usable in constant expressions
+ */
+constexpr CommandTypeId MakeCommandTypeId(std::string_view name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends a command's state to a byte buffer
+ *
+ * The encoding is raw and native-endian: spilled history is only read back
+ * by the process that wrote it, which is also why commands may write
+ * pointers to editor-owned objects such as their Scene as plain integers.
+ * A recorded session is read back by another process, so its reader
+ * substitutes the replay scene for the recorded pointer (see ReadScene).
+ */
+class CommandWriter {
+public:
+    explicit CommandWriter(std::vector<std::byte>& data) : m_Data(data) {}
+
+    template <typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write() takes trivially copyable values");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void* bytes, size_t size) {
+        const size_t offset = m_Data.size();
+        m_Data.resize(offset + size);
+        std::memcpy(m_Data.data() + offset, bytes, size);
+    }
+
+    /**
+     * @brief Element count followed by the packed elements
+     */
+    template <typename T>
+    void WriteArray(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "WriteArray() takes trivially copyable values");
+        Write(static_cast<uint32_t>(values.size()));
+        WriteBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void WriteString(std::string_view text) {
+        Write(static_cast<uint32_t>(text.size()));
+        WriteBytes(text.data(), text.size());
+    }
+
+    void WriteScene(const Scene* scene) { Write(reinterpret_cast<uintptr_t>(scene)); }
+
+    void WriteSceneObject(const SceneObject& object) {
+        WriteString(object.name.View());
+        Write(object.position);
+        Write(object.scale);
+        Write(object.rotation);
+        Write(object.color);
+        Write(object.textured);
+        Write(object.mesh);
+        Write(object.parent);
+    }
+
+private:
+    std::vector<std::byte>& m_Data;
+};
+
+/**
+ * @brief Reads back what a CommandWriter wrote; every call fails once the data runs out
+ */
+class CommandReader {
+public:
+    CommandReader(const std::byte* data, size_t size) : m_Data(data), m_Size(size) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Read() takes trivially copyable values");
+        if (!m_Ok || m_Size - m_Offset < sizeof(T)) {
+            m_Ok = false;
+            return false;
+        }
+        std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+        m_Offset += sizeof(T);
+        return true;
+    }
+
+    template <typename T>
+    bool ReadArray(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadArray() takes trivially copyable values");
+        uint32_t count = 0;
+        if (!Read(count) || (m_Size - m_Offset) / sizeof(T) < count) {
+            m_Ok = false;
+            return false;
+        }
+        values.resize(count);
+        std::memcpy(values.data(), m_Data + m_Offset, count * sizeof(T));
+        m_Offset += count * sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& text) {
+        uint32_t length = 0;
+        if (!Read(length) || m_Size - m_Offset < length) {
+            m_Ok = false;
+            return false;
+        }
+        text.assign(reinterpret_cast<const char*>(m_Data + m_Offset), length);
+        m_Offset += length;
+        return true;
+    }
+
+    /**
+     * @brief Read a scene pointer written by WriteScene(), or the substitute scene if one is set
+     */
+    bool ReadScene(Scene*& scene) {
+        uintptr_t value = 0;
+        if (!Read(value)) {
+            return false;
+        }
+        scene = m_SceneOverride ? m_SceneOverride : reinterpret_cast<Scene*>(value);
+        return true;
+    }
+
+    /**
+     * @brief Make every ReadScene() return @p scene, for replaying commands recorded in another process
+     */
+    void SetSceneOverride(Scene* scene) { m_SceneOverride = scene; }
+
+    bool ReadSceneObject(SceneObject& object) {
+        std::string name;
+        if (!ReadString(name)) {
+            return false;
+        }
+        object.name = name;
+        Read(object.position);
+        Read(object.scale);
+        Read(object.rotation);
+        Read(object.color);
+        Read(object.textured);
+        Read(object.mesh);
+        return Read(object.parent);
+    }
+
+    bool Skip(size_t size) {
+        if (!m_Ok || m_Size - m_Offset < size) {
+            m_Ok = false;
+            return false;
+        }
+        m_Offset += size;
+        return true;
+    }
+
+    void Fail() { m_Ok = false; }
+    size_t GetOffset() const { return m_Offset; }
+    bool IsOk() const { return m_Ok; }
+    bool AtEnd() const { return m_Offset == m_Size; }
+
+private:
+    const std::byte* m_Data;
+    size_t m_Size;
+    size_t m_Offset = 0;
+    bool m_Ok = true;
+    Scene* m_SceneOverride = nullptr;
+};
+
+}  // namespace Vest
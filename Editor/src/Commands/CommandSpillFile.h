@@ -0,0 +1,204 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+/**
+ * @brief Append-only file of serialized commands, written and read on a background thread
+ *
+ * Append() reserves the record's offset immediately and queues the write;
+ * Read() queues a read and returns a future for the bytes. Requests are
+ * processed in order, so a record can be read as soon as it is appended.
+ * The file is deleted when the spill file is closed.
+ */
+class CommandSpillFile {
+public:
+    struct Record {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+
+        bool IsValid() const { return size > 0; }
+    };
+
+    using ReadResult = std::shared_future<std::vector<std::byte>>;
+
+    CommandSpillFile() = default;
+    CommandSpillFile(const CommandSpillFile&) = delete;
+    CommandSpillFile& operator=(const CommandSpillFile&) = delete;
+
+    ~CommandSpillFile() { Close(); }
+
+    bool Open(const std::filesystem::path& path) {
+        Close();
+
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+        m_File.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!m_File.is_open()) {
+            VEST_CORE_ERROR("Failed to open undo spill file: {0}", path.string());
+            return false;
+        }
+
+        m_Path = path;
+        m_Size = 0;
+        m_Stop = false;
+        m_Thread = std::thread([this]() { ThreadLoop(); });
+        VEST_CORE_INFO("Undo history spills to: {0}", path.string());
+        return true;
+    }
+
+    /**
+     * @brief Finish queued requests, then close and delete the file
+     */
+    void Close() {
+        if (!m_Thread.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Condition.notify_all();
+        m_Thread.join();
+
+        m_File.close();
+        std::error_code error;
+        std::filesystem::remove(m_Path, error);
+    }
+
+    bool IsOpen() const { return m_Thread.joinable(); }
+    const std::filesystem::path& GetPath() const { return m_Path; }
+
+    /**
+     * @brief Bytes appended since the file was opened or last truncated
+     */
+    uint64_t GetSize() const { return m_Size; }
+
+    Record Append(std::vector<std::byte> data) {
+        Record record{m_Size, static_cast<uint32_t>(data.size())};
+        m_Size += data.size();
+
+        Request request;
+        request.kind = Request::Kind::Write;
+        request.record = record;
+        request.data = std::move(data);
+        Enqueue(std::move(request));
+        return record;
+    }
+
+    /**
+     * @brief Queue a read; the result is empty if the record could not be read
+     */
+    ReadResult Read(Record record) {
+        Request request;
+        request.kind = Request::Kind::Read;
+        request.record = record;
+        ReadResult result = request.result.get_future().share();
+        Enqueue(std::move(request));
+        return result;
+    }
+
+    /**
+     * @brief Discard every record; offsets handed out earlier become invalid
+     */
+    void Truncate() {
+        m_Size = 0;
+        Request request;
+        request.kind = Request::Kind::Truncate;
+        Enqueue(std::move(request));
+    }
+
+private:
+    struct Request {
+        enum class Kind { Write, Read, Truncate };
+
+        Kind kind = Kind::Write;
+        Record record;
+        std::vector<std::byte> data;
+        std::promise<std::vector<std::byte>> result;
+    };
+
+    void Enqueue(Request request) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Queue.push_back(std::move(request));
+        }
+        m_Condition.notify_one();
+    }
+
+    void ThreadLoop() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (true) {
+            m_Condition.wait(lock, [this]() { return m_Stop || !m_Queue.empty(); });
+            if (m_Queue.empty()) {
+                break;  // Stopped and drained
+            }
+
+            Request request = std::move(m_Queue.front());
+            m_Queue.pop_front();
+            lock.unlock();
+            Process(request);
+            lock.lock();
+        }
+    }
+
+    // I/O thread only
+    void Process(Request& request) {
+        switch (request.kind) {
+            case Request::Kind::Write:
+                m_File.seekp(static_cast<std::streamoff>(request.record.offset));
+                m_File.write(reinterpret_cast<const char*>(request.data.data()),
+                             static_cast<std::streamsize>(request.data.size()));
+                if (!m_File) {
+                    VEST_CORE_ERROR("Failed to write undo spill file: {0}", m_Path.string());
+                    m_File.clear();
+                }
+                break;
+
+            case Request::Kind::Read: {
+                std::vector<std::byte> data(request.record.size);
+                m_File.flush();
+                m_File.seekg(static_cast<std::streamoff>(request.record.offset));
+                m_File.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                if (!m_File) {
+                    VEST_CORE_ERROR("Failed to read undo spill file: {0}", m_Path.string());
+                    m_File.clear();
+                    data.clear();
+                }
+                request.result.set_value(std::move(data));
+                break;
+            }
+
+            case Request::Kind::Truncate:
+                m_File.close();
+                m_File.open(m_Path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+                break;
+        }
+    }
+
+    std::filesystem::path m_Path;
+    std::fstream m_File;  // Owned by the I/O thread while it runs
+    uint64_t m_Size = 0;
+
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Request> m_Queue;
+    bool m_Stop = false;
+};
+
+}  // namespace Vest
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <string>
+
 #include "Commands/ICommand.h"
-#include <Scene/SceneObject.h>
+#include "Commands/CommandPool.h"
+#include <Scene/Scene.h>
 
 namespace Vest {
 
@@ -10,40 +13,65 @@ namespace Vest {
  */
 class CreateEntityCommand : public ICommand {
 public:
-    CreateEntityCommand(std::vector<SceneObject>* scene, const SceneObject& entity)
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("CreateEntityCommand");
+
+    CreateEntityCommand(Scene* scene, const SceneObject& entity)
         : m_Scene(scene)
         , m_Entity(entity)
-        , m_Index(-1)
+        , m_Name(std::string("Create Entity: ").append(entity.name.View()))
     {
     }
 
     bool Execute() override {
         if (!m_Scene) return false;
         
-        m_Scene->push_back(m_Entity);
-        m_Index = static_cast<int>(m_Scene->size()) - 1;
-        return true;
+        // First execution allocates a handle; redo revives that same handle
+        // so later commands that reference it stay valid.
+        if (m_Handle.IsNull()) {
+            m_Handle = m_Scene->CreateEntity(m_Entity);
+            return !m_Handle.IsNull();
+        }
+        return m_Scene->RestoreEntity(m_Handle, m_Entity);
     }
 
     bool Undo() override {
-        if (!m_Scene || m_Index < 0 || m_Index >= static_cast<int>(m_Scene->size())) {
-            return false;
-        }
+        if (!m_Scene) return false;
         
-        m_Scene->erase(m_Scene->begin() + m_Index);
+        return m_Scene->DestroyEntity(m_Handle);
+    }
+
+    std::string_view GetName() const override {
+        return m_Name.View();
+    }
+
+    // SceneObject names are interned, so the stored copy owns no heap memory
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.WriteSceneObject(m_Entity);
+        writer.Write(m_Handle);
         return true;
     }
 
-    std::string GetName() const override {
-        return "Create Entity: " + m_Entity.name;
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        SceneObject entity;
+        reader.ReadScene(scene);
+        reader.ReadSceneObject(entity);
+        auto command = MakeCommand<CreateEntityCommand>(scene, entity);
+        reader.Read(command->m_Handle);
+        return command;
     }
 
-    int GetCreatedIndex() const { return m_Index; }
+    EntityHandle GetCreatedEntity() const { return m_Handle; }
 
 private:
-    std::vector<SceneObject>* m_Scene;
+    Scene* m_Scene;
     SceneObject m_Entity;
-    int m_Index;
+    EntityHandle m_Handle;
+    InternedString m_Name;
 };
 
 /**
@@ -51,43 +79,68 @@ private:
  */
 class DeleteEntityCommand : public ICommand {
 public:
-    DeleteEntityCommand(std::vector<SceneObject>* scene, int entityIndex)
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("DeleteEntityCommand");
+
+    DeleteEntityCommand(Scene* scene, EntityHandle entity)
         : m_Scene(scene)
-        , m_EntityIndex(entityIndex)
+        , m_Entity(entity)
     {
         // Store the entity before deletion
-        if (m_Scene && entityIndex >= 0 && entityIndex < static_cast<int>(m_Scene->size())) {
-            m_DeletedEntity = (*m_Scene)[entityIndex];
+        if (const SceneObject* object = m_Scene ? m_Scene->TryGet(entity) : nullptr) {
+            m_DeletedEntity = *object;
         }
+        m_Name = MakeName(m_DeletedEntity);
     }
 
     bool Execute() override {
-        if (!m_Scene || m_EntityIndex < 0 || m_EntityIndex >= static_cast<int>(m_Scene->size())) {
-            return false;
-        }
+        if (!m_Scene) return false;
         
-        m_Scene->erase(m_Scene->begin() + m_EntityIndex);
-        return true;
+        return m_Scene->DestroyEntity(m_Entity);
     }
 
     bool Undo() override {
-        if (!m_Scene || m_EntityIndex < 0 || m_EntityIndex > static_cast<int>(m_Scene->size())) {
-            return false;
-        }
+        if (!m_Scene) return false;
         
-        // Restore at original position
-        m_Scene->insert(m_Scene->begin() + m_EntityIndex, m_DeletedEntity);
+        // Restore under the original handle
+        return m_Scene->RestoreEntity(m_Entity, m_DeletedEntity);
+    }
+
+    std::string_view GetName() const override {
+        return m_Name.View();
+    }
+
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(m_Entity);
+        writer.WriteSceneObject(m_DeletedEntity);
         return true;
     }
 
-    std::string GetName() const override {
-        return "Delete Entity: " + m_DeletedEntity.name;
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        EntityHandle entity;
+        reader.ReadScene(scene);
+        reader.Read(entity);
+        // The entity is already gone from the scene; restore the captured copy directly
+        auto command = MakeCommand<DeleteEntityCommand>(nullptr, entity);
+        command->m_Scene = scene;
+        reader.ReadSceneObject(command->m_DeletedEntity);
+        command->m_Name = MakeName(command->m_DeletedEntity);
+        return command;
     }
 
 private:
-    std::vector<SceneObject>* m_Scene;
-    int m_EntityIndex;
+    static InternedString MakeName(const SceneObject& entity) {
+        return std::string("Delete Entity: ").append(entity.name.View());
+    }
+
+    Scene* m_Scene;
+    EntityHandle m_Entity;
     SceneObject m_DeletedEntity;
+    InternedString m_Name;
 };
 
 /**
@@ -95,43 +148,122 @@ private:
  */
 class ModifyColorCommand : public ICommand {
 public:
-    ModifyColorCommand(std::vector<SceneObject>* scene, 
-                       int entityIndex,
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("ModifyColorCommand");
+
+    ModifyColorCommand(Scene* scene, 
+                       EntityHandle entity,
                        const glm::vec4& oldColor,
                        const glm::vec4& newColor)
         : m_Scene(scene)
-        , m_EntityIndex(entityIndex)
+        , m_Entity(entity)
         , m_OldColor(oldColor)
         , m_NewColor(newColor)
     {
     }
 
     bool Execute() override {
-        if (!IsValid()) return false;
-        (*m_Scene)[m_EntityIndex].color = m_NewColor;
+        SceneObject* object = m_Scene ? m_Scene->TryGetMutable(m_Entity) : nullptr;
+        if (!object) return false;
+        object->color = m_NewColor;
         return true;
     }
 
     bool Undo() override {
-        if (!IsValid()) return false;
-        (*m_Scene)[m_EntityIndex].color = m_OldColor;
+        SceneObject* object = m_Scene ? m_Scene->TryGetMutable(m_Entity) : nullptr;
+        if (!object) return false;
+        object->color = m_OldColor;
         return true;
     }
 
-    std::string GetName() const override {
+    std::string_view GetName() const override {
         return "Modify Color";
     }
 
-private:
-    bool IsValid() const {
-        return m_Scene && m_EntityIndex >= 0 && 
-               m_EntityIndex < static_cast<int>(m_Scene->size());
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(m_Entity);
+        writer.Write(m_OldColor);
+        writer.Write(m_NewColor);
+        return true;
     }
 
-    std::vector<SceneObject>* m_Scene;
-    int m_EntityIndex;
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        EntityHandle entity;
+        glm::vec4 oldColor(1.0f);
+        glm::vec4 newColor(1.0f);
+        reader.ReadScene(scene);
+        reader.Read(entity);
+        reader.Read(oldColor);
+        reader.Read(newColor);
+        return MakeCommand<ModifyColorCommand>(scene, entity, oldColor, newColor);
+    }
+
+private:
+    Scene* m_Scene;
+    EntityHandle m_Entity;
     glm::vec4 m_OldColor;
     glm::vec4 m_NewColor;
 };
 
+/**
+ * @brief Command for re-parenting an entity in the scene hierarchy
+ */
+class SetParentCommand : public ICommand {
+public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("SetParentCommand");
+
+    SetParentCommand(Scene* scene, EntityHandle entity, EntityHandle newParent)
+        : m_Scene(scene)
+        , m_Entity(entity)
+        , m_OldParent(scene ? scene->GetParent(entity) : EntityHandle())
+        , m_NewParent(newParent)
+    {
+    }
+
+    bool Execute() override {
+        return m_Scene && m_Scene->SetParent(m_Entity, m_NewParent);
+    }
+
+    bool Undo() override {
+        return m_Scene && m_Scene->SetParent(m_Entity, m_OldParent);
+    }
+
+    std::string_view GetName() const override {
+        return m_NewParent.IsNull() ? "Unparent Entity" : "Parent Entity";
+    }
+
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(m_Entity);
+        writer.Write(m_OldParent);
+        writer.Write(m_NewParent);
+        return true;
+    }
+
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        EntityHandle entity;
+        reader.ReadScene(scene);
+        reader.Read(entity);
+        auto command = MakeCommand<SetParentCommand>(nullptr, entity, EntityHandle());
+        command->m_Scene = scene;
+        reader.Read(command->m_OldParent);
+        reader.Read(command->m_NewParent);
+        return command;
+    }
+
+private:
+    Scene* m_Scene;
+    EntityHandle m_Entity;
+    EntityHandle m_OldParent;
+    EntityHandle m_NewParent;
+};
+
 }  // namespace Vest
@@ -1,9 +1,11 @@
 #pragma once
 
-#include <string>
+#include <cstddef>
+#include <string_view>
 #include <memory>
 
 #include "Core/Base.h"
+#include "Commands/CommandSerialization.h"
 
 namespace Vest {
 
@@ -31,24 +33,37 @@ public:
 
     /**
      * @brief Get a human-readable name for this command
+     *
+     * Queried every frame by the Edit menu, so it must not allocate: return a
+     * literal, or a name interned once when the command is built.
      * @return Command name (e.g., "Move Entity", "Delete Entity")
      */
-    virtual std::string GetName() const = 0;
+    virtual std::string_view GetName() const = 0;
 
     /**
-     * @brief Check if this command can be merged with another
-     * 
-     * Allows consecutive similar commands to be combined
-     * (e.g., multiple small translations into one)
+     * @brief Bytes this command keeps alive while it sits in the history
+     *
+     * Include the object itself and any heap memory it owns; CommandManager
+     * uses the sum to enforce its memory budget.
      */
-    virtual bool CanMergeWith(const ICommand* other) const { return false; }
+    virtual size_t GetMemoryFootprint() const = 0;
 
     /**
-     * @brief Merge this command with another
-     * @param other Command to merge with
-     * @return true if merge was successful
+     * @brief Identifies the concrete command type (see MakeCommandTypeId)
      */
-    virtual bool MergeWith(const ICommand* other) { return false; }
+    virtual CommandTypeId GetTypeId() const = 0;
+
+    /**
+     * @brief Write the command's state so CommandRegistry can rebuild it
+     *
+     * Used to spill old undo history to disk. Commands that return false
+     * stay in memory and are evicted instead of spilled.
+     */
+    virtual bool Serialize([[maybe_unused]] CommandWriter& writer) const { return false; }
+
+    // Merging is not part of this interface: a command type opts in with a
+    // non-virtual `bool MergeWith(const T& next)`, which CommandRegistry
+    // dispatches to by type ID (see CommandRegistry::TryMerge).
 };
 
 }  // namespace Vest
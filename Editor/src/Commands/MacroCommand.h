@@ -5,6 +5,8 @@
 
 #include "Core/Base.h"
 #include "Commands/ICommand.h"
+#include "Commands/CommandPool.h"
+#include "Commands/CommandRegistry.h"
 
 namespace Vest {
 
@@ -16,6 +18,8 @@ namespace Vest {
  */
 class MacroCommand : public ICommand {
 public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("MacroCommand");
+
     explicit MacroCommand(std::string name = "Macro Command")
         : m_Name(std::move(name))
     {
@@ -24,7 +28,7 @@ public:
     /**
      * @brief Add a command to the group
      */
-    void AddCommand(Scope<ICommand> command) {
+    void AddCommand(CommandPtr command) {
         if (command) {
             m_Commands.push_back(std::move(command));
         }
@@ -62,19 +66,52 @@ public:
     /**
      * @brief Get the name of the macro command
      */
-    std::string GetName() const override {
-        return m_Name + " (" + std::to_string(m_Commands.size()) + " operations)";
+    std::string_view GetName() const override {
+        // Interned on the first request after the command count changes
+        if (m_DisplayNameCount != m_Commands.size()) {
+            m_DisplayName = m_Name + " (" + std::to_string(m_Commands.size()) + " operations)";
+            m_DisplayNameCount = m_Commands.size();
+        }
+        return m_DisplayName.View();
+    }
+
+    size_t GetMemoryFootprint() const override {
+        size_t bytes = sizeof(*this) + m_Name.capacity() + m_Commands.capacity() * sizeof(CommandPtr);
+        for (const auto& command : m_Commands) {
+            bytes += command->GetMemoryFootprint();
+        }
+        return bytes;
     }
 
+    CommandTypeId GetTypeId() const override { return TypeId; }
+
     /**
-     * @brief Macro commands cannot be merged
+     * @brief Serializes every child through CommandRegistry; fails if any child cannot be serialized
      */
-    bool CanMergeWith(const ICommand* other) const override {
-        return false;
+    bool Serialize(CommandWriter& writer) const override {
+        std::vector<std::byte> children;
+        for (const auto& command : m_Commands) {
+            if (!CommandRegistry::Serialize(*command, children)) {
+                return false;
+            }
+        }
+        writer.WriteString(m_Name);
+        writer.Write(static_cast<uint32_t>(m_Commands.size()));
+        writer.WriteBytes(children.data(), children.size());
+        return true;
     }
 
-    bool MergeWith(const ICommand* other) override {
-        return false;
+    static CommandPtr Deserialize(CommandReader& reader) {
+        std::string name;
+        uint32_t count = 0;
+        reader.ReadString(name);
+        reader.Read(count);
+
+        auto macro = MakeCommand<MacroCommand>(std::move(name));
+        for (uint32_t i = 0; i < count && reader.IsOk(); ++i) {
+            macro->AddCommand(CommandRegistry::Deserialize(reader));
+        }
+        return macro;
     }
 
     /**
@@ -88,8 +125,10 @@ public:
     bool IsEmpty() const { return m_Commands.empty(); }
 
 private:
-    std::vector<Scope<ICommand>> m_Commands;
+    std::vector<CommandPtr> m_Commands;
     std::string m_Name;
+    mutable InternedString m_DisplayName;
+    mutable size_t m_DisplayNameCount = static_cast<size_t>(-1);
 };
 
 }  // namespace Vest
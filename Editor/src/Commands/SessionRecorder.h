@@ -0,0 +1,179 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include "Core/Log.h"
+#include "Commands/CommandRegistry.h"
+#include "Commands/ICommand.h"
+#include <Scene/Scene.h>
+
+namespace Vest {
+
+/**
+ * @brief History operation stored in a session log
+ */
+enum class SessionOp : uint8_t {
+    Execute,   // ExecuteCommand(); payload is the command
+    Register,  // RegisterExecutedCommand(); payload is the already-applied command
+    Undo,
+    Redo,
+    Clear
+};
+
+/**
+ * @brief Records an editing session as a compact binary log for headless replay
+ *
+ * The log starts with the scene as it was when recording began, stored with
+ * entity handles so that replay reproduces them exactly, followed by every
+ * operation on the CommandManager it is attached to. Commands are written
+ * through CommandRegistry, so the log is as compact as the spill file and
+ * only as complete as the registry: a command type that cannot be
+ * serialized is logged as an empty payload and stops replay there. Scene
+ * edits made outside the command system are not captured.
+ *
+ * Layout, native-endian like the spill file:
+ *   header: magic, version, entity count
+ *   entity: handle, SceneObject (CommandWriter::WriteSceneObject)
+ *   event:  op, nanoseconds since Begin(), payload size, payload
+ *
+ * Events are buffered and written in blocks, so recording costs one
+ * serialization per command and no I/O on most operations.
+ */
+class SessionRecorder {
+public:
+    static constexpr uint32_t Magic = 0x53455356;  // "VSES"
+    static constexpr uint32_t Version = 1;
+    static constexpr size_t FlushThreshold = 64 * 1024;
+
+    SessionRecorder() = default;
+    SessionRecorder(const SessionRecorder&) = delete;
+    SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+    ~SessionRecorder() { End(); }
+
+    /**
+     * @brief Start a new log at @p path, capturing @p scene as the starting state
+     */
+    bool Begin(const std::filesystem::path& path, const Scene& scene) {
+        End();
+
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+        m_File.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!m_File.is_open()) {
+            VEST_CORE_ERROR("Failed to open session log: {0}", path.string());
+            return false;
+        }
+
+        m_Path = path;
+        m_EventCount = 0;
+        m_UnrecordedCount = 0;
+        m_BytesWritten = 0;
+        m_Start = std::chrono::steady_clock::now();
+
+        CommandWriter writer(m_Buffer);
+        writer.Write(Magic);
+        writer.Write(Version);
+        writer.Write(static_cast<uint32_t>(scene.Size()));
+        for (size_t i = 0; i < scene.Size(); ++i) {
+            writer.Write(scene.GetHandleAt(i));
+            writer.WriteSceneObject(scene.GetAt(i));
+        }
+        Flush();
+
+        VEST_CORE_INFO("Recording session to: {0}", path.string());
+        return true;
+    }
+
+    /**
+     * @brief Write any buffered events and close the log
+     */
+    void End() {
+        if (!m_File.is_open()) {
+            return;
+        }
+        Flush();
+        m_File.close();
+        VEST_CORE_INFO("Session recorded: {0} events, {1} bytes", m_EventCount, m_BytesWritten);
+        if (m_UnrecordedCount > 0) {
+            VEST_CORE_WARN("{0} commands could not be serialized; replay stops at the first one",
+                           m_UnrecordedCount);
+        }
+    }
+
+    bool IsRecording() const { return m_File.is_open(); }
+    const std::filesystem::path& GetPath() const { return m_Path; }
+
+    void RecordCommand(SessionOp op, const ICommand& command) {
+        if (!IsRecording()) {
+            return;
+        }
+
+        const size_t header = BeginEvent(op);
+        const size_t payloadStart = m_Buffer.size();
+        if (!CommandRegistry::Serialize(command, m_Buffer)) {
+            ++m_UnrecordedCount;
+        }
+        const uint32_t payloadSize = static_cast<uint32_t>(m_Buffer.size() - payloadStart);
+        std::memcpy(m_Buffer.data() + header, &payloadSize, sizeof(payloadSize));
+        EndEvent();
+    }
+
+    void RecordOp(SessionOp op) {
+        if (!IsRecording()) {
+            return;
+        }
+        BeginEvent(op);
+        EndEvent();
+    }
+
+    size_t GetEventCount() const { return m_EventCount; }
+    size_t GetUnrecordedCount() const { return m_UnrecordedCount; }
+    uint64_t GetBytesWritten() const { return m_BytesWritten + m_Buffer.size(); }
+
+private:
+    // Writes the op, timestamp and a zero payload size; returns the size's offset
+    size_t BeginEvent(SessionOp op) {
+        const auto elapsed = std::chrono::steady_clock::now() - m_Start;
+        CommandWriter writer(m_Buffer);
+        writer.Write(op);
+        writer.Write(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        const size_t sizeOffset = m_Buffer.size();
+        writer.Write(uint32_t{0});
+        return sizeOffset;
+    }
+
+    void EndEvent() {
+        ++m_EventCount;
+        if (m_Buffer.size() >= FlushThreshold) {
+            Flush();
+        }
+    }
+
+    void Flush() {
+        m_File.write(reinterpret_cast<const char*>(m_Buffer.data()), static_cast<std::streamsize>(m_Buffer.size()));
+        if (!m_File) {
+            VEST_CORE_ERROR("Failed to write session log: {0}", m_Path.string());
+            m_File.clear();
+        }
+        m_BytesWritten += m_Buffer.size();
+        m_Buffer.clear();
+    }
+
+    std::filesystem::path m_Path;
+    std::ofstream m_File;
+    std::vector<std::byte> m_Buffer;
+    std::chrono::steady_clock::time_point m_Start;
+    size_t m_EventCount = 0;
+    size_t m_UnrecordedCount = 0;
+    uint64_t m_BytesWritten = 0;
+};
+
+}  // namespace Vest
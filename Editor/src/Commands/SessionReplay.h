@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "Core/Log.h"
+#include "Commands/CommandManager.h"
+#include "Commands/CommandRegistry.h"
+#include "Commands/SessionRecorder.h"
+#include <Scene/Scene.h>
+
+namespace Vest {
+
+/**
+ * @brief A session log written by SessionRecorder, loaded into memory
+ */
+class SessionLog {
+public:
+    struct Event {
+        SessionOp op = SessionOp::Execute;
+        uint64_t timeNs = 0;  // Since recording began
+        size_t payloadOffset = 0;
+        uint32_t payloadSize = 0;
+    };
+
+    /**
+     * @brief Read and validate a log; fails on a bad header or truncated data
+     */
+    bool Load(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            VEST_CORE_ERROR("Failed to open session log: {0}", path.string());
+            return false;
+        }
+        std::vector<std::byte> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            VEST_CORE_ERROR("Failed to read session log: {0}", path.string());
+            return false;
+        }
+        return Parse(std::move(data));
+    }
+
+    /**
+     * @brief Parse a log from memory
+     */
+    bool Parse(std::vector<std::byte> data) {
+        m_Data = std::move(data);
+        m_Handles.clear();
+        m_Objects.clear();
+        m_Events.clear();
+
+        CommandReader reader(m_Data.data(), m_Data.size());
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t entityCount = 0;
+        reader.Read(magic);
+        reader.Read(version);
+        if (!reader.IsOk() || magic != SessionRecorder::Magic || version != SessionRecorder::Version) {
+            VEST_CORE_ERROR("Not a session log, or written by another version");
+            return false;
+        }
+
+        reader.Read(entityCount);
+        for (uint32_t i = 0; i < entityCount && reader.IsOk(); ++i) {
+            reader.Read(m_Handles.emplace_back());
+            reader.ReadSceneObject(m_Objects.emplace_back());
+        }
+
+        while (reader.IsOk() && !reader.AtEnd()) {
+            Event& event = m_Events.emplace_back();
+            reader.Read(event.op);
+            reader.Read(event.timeNs);
+            reader.Read(event.payloadSize);
+            event.payloadOffset = reader.GetOffset();
+            if (event.op > SessionOp::Clear) {
+                reader.Fail();
+            }
+            reader.Skip(event.payloadSize);
+        }
+
+        if (!reader.IsOk()) {
+            VEST_CORE_ERROR("Session log is truncated");
+            return false;
+        }
+        return true;
+    }
+
+    size_t GetEntityCount() const { return m_Handles.size(); }
+    const std::vector<Event>& GetEvents() const { return m_Events; }
+
+    /**
+     * @brief Wall-clock length of the recorded session in seconds
+     */
+    double GetDurationSeconds() const { return m_Events.empty() ? 0.0 : m_Events.back().timeNs * 1.0e-9; }
+
+    /**
+     * @brief Reset @p scene to the recorded starting state, with the recorded handles
+     */
+    bool RestoreScene(Scene& scene) const {
+        scene.Clear();
+        return scene.RestoreEntities(m_Handles, m_Objects) == m_Handles.size();
+    }
+
+    /**
+     * @brief Rebuild the command of an Execute or Register event against @p scene
+     * @return Null if the command was not serializable when recorded or its type is not registered
+     */
+    CommandPtr LoadCommand(const Event& event, Scene& scene) const {
+        if (event.payloadSize == 0) {
+            return nullptr;
+        }
+        CommandReader reader(m_Data.data() + event.payloadOffset, event.payloadSize);
+        reader.SetSceneOverride(&scene);
+        return CommandRegistry::Deserialize(reader);
+    }
+
+private:
+    std::vector<std::byte> m_Data;
+    std::vector<EntityHandle> m_Handles;
+    std::vector<SceneObject> m_Objects;
+    std::vector<Event> m_Events;
+};
+
+/**
+ * @brief Timing collected by ReplaySession()
+ */
+struct SessionReplayStats {
+    size_t events = 0;
+    size_t commands = 0;
+    size_t undos = 0;
+    size_t redos = 0;
+    size_t failures = 0;  // Operations that returned false; a faithful replay has none
+    double totalMs = 0.0;
+    std::vector<double> latenciesUs;  // One per replayed event, in event order
+
+    /**
+     * @brief Latency at @p percentile (0-100) in microseconds
+     */
+    double GetPercentileUs(double percentile) const {
+        if (latenciesUs.empty()) {
+            return 0.0;
+        }
+        std::vector<double> sorted = latenciesUs;
+        std::sort(sorted.begin(), sorted.end());
+        const size_t index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    double GetEventsPerSecond() const { return totalMs > 0.0 ? events * 1000.0 / totalMs : 0.0; }
+};
+
+/**
+ * @brief Replay a recorded session headlessly and as fast as possible
+ *
+ * Restores the recorded starting scene into @p scene, clears @p manager and
+ * feeds it every event. All commands are deserialized before the timed
+ * loop, so the timings cover CommandManager, scene storage and undo/redo
+ * only. Command types must be registered (RegisterBuiltinCommands()).
+ *
+ * @return false if the scene could not be restored or the log contains a
+ *         command that cannot be rebuilt; events before it are still replayed
+ */
+inline bool ReplaySession(const SessionLog& log, Scene& scene, CommandManager& manager,
+                          SessionReplayStats* stats = nullptr) {
+    using Clock = std::chrono::steady_clock;
+
+    bool complete = log.RestoreScene(scene);
+    if (!complete) {
+        VEST_CORE_ERROR("Failed to restore the recorded scene");
+        return false;
+    }
+    manager.Clear();
+
+    const std::vector<SessionLog::Event>& events = log.GetEvents();
+    std::vector<CommandPtr> commands(events.size());
+    size_t eventCount = events.size();
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (events[i].op != SessionOp::Execute && events[i].op != SessionOp::Register) {
+            continue;
+        }
+        commands[i] = log.LoadCommand(events[i], scene);
+        if (!commands[i]) {
+            VEST_CORE_ERROR("Session event {0} holds a command that cannot be rebuilt; replaying the {0} before it", i);
+            eventCount = i;
+            complete = false;
+            break;
+        }
+    }
+
+    SessionReplayStats local;
+    SessionReplayStats& result = stats ? *stats : local;
+    result = SessionReplayStats();
+    result.latenciesUs.reserve(eventCount);
+
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < eventCount; ++i) {
+        const Clock::time_point eventStart = Clock::now();
+        bool ok = true;
+        switch (events[i].op) {
+            case SessionOp::Execute:
+                ok = manager.ExecuteCommand(std::move(commands[i]));
+                ++result.commands;
+                break;
+            case SessionOp::Register:
+                // The editor applied the change before registering it; do the same
+                ok = commands[i]->Execute() && manager.RegisterExecutedCommand(std::move(commands[i]));
+                ++result.commands;
+                break;
+            case SessionOp::Undo:
+                ok = manager.Undo();
+                ++result.undos;
+                break;
+            case SessionOp::Redo:
+                ok = manager.Redo();
+                ++result.redos;
+                break;
+            case SessionOp::Clear:
+                manager.Clear();
+                break;
+        }
+        result.failures += ok ? 0 : 1;
+        result.latenciesUs.push_back(std::chrono::duration<double, std::micro>(Clock::now() - eventStart).count());
+    }
+    result.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.events = eventCount;
+    return complete;
+}
+
+}  // namespace Vest
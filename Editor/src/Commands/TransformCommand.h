@@ -3,7 +3,8 @@
 #include <glm/glm.hpp>
 
 #include "Commands/ICommand.h"
-#include <Scene/SceneObject.h>
+#include "Commands/CommandPool.h"
+#include <Scene/Scene.h>
 
 namespace Vest {
 
@@ -14,6 +15,8 @@ namespace Vest {
  */
 class TransformCommand : public ICommand {
 public:
+    static constexpr CommandTypeId TypeId = MakeCommandTypeId("TransformCommand");
+
     enum class Type {
         Position,
         Rotation,
@@ -21,13 +24,13 @@ public:
         All  // Position + Rotation + Scale
     };
 
-    TransformCommand(std::vector<SceneObject>* scene, 
-                     int entityIndex,
+    TransformCommand(Scene* scene, 
+                     EntityHandle entity,
                      Type type,
                      const glm::vec3& oldValue,
                      const glm::vec3& newValue)
         : m_Scene(scene)
-        , m_EntityIndex(entityIndex)
+        , m_Entity(entity)
         , m_Type(type)
         , m_OldValue(oldValue)
         , m_NewValue(newValue)
@@ -35,20 +38,22 @@ public:
     }
 
     bool Execute() override {
-        if (!IsValid()) return false;
+        SceneObject* object = m_Scene ? m_Scene->TryGetMutable(m_Entity) : nullptr;
+        if (!object) return false;
         
-        ApplyValue(m_NewValue);
+        ApplyValue(*object, m_NewValue);
         return true;
     }
 
     bool Undo() override {
-        if (!IsValid()) return false;
+        SceneObject* object = m_Scene ? m_Scene->TryGetMutable(m_Entity) : nullptr;
+        if (!object) return false;
         
-        ApplyValue(m_OldValue);
+        ApplyValue(*object, m_OldValue);
         return true;
     }
 
-    std::string GetName() const override {
+    std::string_view GetName() const override {
         switch (m_Type) {
             case Type::Position: return "Move Entity";
             case Type::Rotation: return "Rotate Entity";
@@ -58,32 +63,47 @@ public:
         return "Transform";
     }
 
-    bool CanMergeWith(const ICommand* other) const override {
-        auto* otherTransform = dynamic_cast<const TransformCommand*>(other);
-        if (!otherTransform) return false;
-        
-        // Can merge if same entity and same transform type
-        return m_EntityIndex == otherTransform->m_EntityIndex &&
-               m_Type == otherTransform->m_Type;
-    }
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return TypeId; }
 
-    bool MergeWith(const ICommand* other) override {
-        auto* otherTransform = dynamic_cast<const TransformCommand*>(other);
-        if (!otherTransform) return false;
-        
-        // Update to the newest value, keep original old value
-        m_NewValue = otherTransform->m_NewValue;
+    bool Serialize(CommandWriter& writer) const override {
+        writer.WriteScene(m_Scene);
+        writer.Write(m_Entity);
+        writer.Write(m_Type);
+        writer.Write(m_OldValue);
+        writer.Write(m_NewValue);
         return true;
     }
 
-private:
-    bool IsValid() const {
-        return m_Scene && m_EntityIndex >= 0 && 
-               m_EntityIndex < static_cast<int>(m_Scene->size());
+    static CommandPtr Deserialize(CommandReader& reader) {
+        Scene* scene = nullptr;
+        EntityHandle entity;
+        Type type = Type::Position;
+        glm::vec3 oldValue(0.0f);
+        glm::vec3 newValue(0.0f);
+        reader.ReadScene(scene);
+        reader.Read(entity);
+        reader.Read(type);
+        reader.Read(oldValue);
+        reader.Read(newValue);
+        return MakeCommand<TransformCommand>(scene, entity, type, oldValue, newValue);
     }
 
-    void ApplyValue(const glm::vec3& value) {
-        auto& obj = (*m_Scene)[m_EntityIndex];
+    /**
+     * @brief Fold a later step of the same drag into this one
+     *
+     * Only steps on the same entity and transform type merge; the original
+     * old value is kept and the newest value replaces ours.
+     */
+    bool MergeWith(const TransformCommand& next) {
+        if (m_Entity != next.m_Entity || m_Type != next.m_Type) return false;
+
+        m_NewValue = next.m_NewValue;
+        return true;
+    }
+
+private:
+    void ApplyValue(SceneObject& obj, const glm::vec3& value) {
         switch (m_Type) {
             case Type::Position: obj.position = value; break;
             case Type::Rotation: obj.rotation = value; break;
@@ -96,8 +116,8 @@ private:
         }
     }
 
-    std::vector<SceneObject>* m_Scene;
-    int m_EntityIndex;
+    Scene* m_Scene;
+    EntityHandle m_Entity;
     Type m_Type;
     glm::vec3 m_OldValue;
     glm::vec3 m_NewValue;
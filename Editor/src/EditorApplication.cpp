@@ -8,6 +8,7 @@ class VestEditorApplication : public Application {
 public:
     VestEditorApplication() : Application("VestEditor") {
         PushLayer(new EditorLayer());
+        SetIdleMode(true);
     }
 };
 
@@ -1,7 +1,9 @@
 #include "EditorLayer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <system_error>
 
 #include <GLFW/glfw3.h>
 #include <imgui.h>
@@ -11,7 +13,11 @@
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "Core/Application.h"
+#include "Core/FrameAllocator.h"
 #include "Core/Input.h"
+#include "Core/Profiler.h"
+#include "Commands/BuiltinCommands.h"
 #include "Rendering/RenderCommand.h"
 #include "Rendering/Buffer.h"
 
@@ -22,7 +28,8 @@ EditorLayer::EditorLayer()
       m_SceneHierarchyPanel("Scene Hierarchy"),
       m_PropertiesPanel("Properties"),
       m_ContentBrowserPanel("assets"),
-      m_StatsPanel("Stats") {}
+      m_StatsPanel("Stats"),
+      m_ProfilerPanel("Profiler") {}
 
 void EditorLayer::OnAttach() {
     FramebufferSpecification spec;
@@ -35,8 +42,19 @@ void EditorLayer::OnAttach() {
     float aspectRatio = static_cast<float>(spec.width) / static_cast<float>(spec.height);
     m_EditorCamera = EditorCamera(aspectRatio, 1.5f);
 
-    m_SceneHierarchyPanel.SetSceneContext(&m_SceneObjects, &m_SelectedEntityIndex);
-    m_PropertiesPanel.SetSceneContext(&m_SceneObjects, &m_SelectedEntityIndex);
+    // Long sessions keep unlimited undo by spilling old steps to disk
+    RegisterBuiltinCommands();
+    std::error_code tempError;
+    std::filesystem::path tempDirectory = std::filesystem::temp_directory_path(tempError);
+    if (!tempError) {
+        const auto session = std::chrono::system_clock::now().time_since_epoch().count();
+        m_CommandManager.EnableSpilling(tempDirectory / "VestEngine" / ("undo-" + std::to_string(session) + ".spill"));
+    }
+
+    m_SceneHierarchyPanel.SetSceneContext(&m_Scene, &m_SelectedEntity, &m_CommandManager);
+    m_StatsPanel.SetCommandHistory(&m_CommandManager);
+    m_StatsPanel.SetFrameStats(&Application::Get().GetFrameStats());
+    m_PropertiesPanel.SetSceneContext(&m_Scene, &m_SelectedEntity);
 
     float vertices[] = {
         -0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f,
@@ -147,7 +165,7 @@ void main() {
     }
     m_WhiteTexture = Texture2D::Create(whitePath.string());
 
-    m_SceneObjects.push_back(SceneObject{
+    m_SelectedEntity = m_Scene.CreateEntity(SceneObject{
         .name = "Triangle",
         .position = glm::vec3(-0.2f, -0.1f, 0.0f),
         .scale = glm::vec3(1.0f),
@@ -155,7 +173,7 @@ void main() {
         .color = glm::vec4(1.0f),
         .textured = false,
         .mesh = SceneObject::MeshType::Triangle});
-    m_SceneObjects.push_back(SceneObject{
+    m_Scene.CreateEntity(SceneObject{
         .name = "Textured Quad",
         .position = glm::vec3(0.6f, 0.0f, 0.0f),
         .scale = glm::vec3(0.75f),
@@ -163,72 +181,60 @@ void main() {
         .color = glm::vec4(1.0f),
         .textured = true,
         .mesh = SceneObject::MeshType::Quad});
-    m_SelectedEntityIndex = 0;
     
     // Initialize grid renderer
     m_GridRenderer.Init();
 }
 
 void EditorLayer::OnUpdate(Timestep ts) {
-    m_FPS = ts.GetSeconds() > 0.0f ? 1.0f / ts.GetSeconds() : 0.0f;
-    m_DrawCalls = 0;
-
     // Update camera and selection renderer
     if (m_ViewportFocused) {
         m_EditorCamera.OnUpdate(ts);
     }
+
+    // The selection pulse runs while the viewport is in use and briefly after the
+    // selection changes; otherwise it would keep the main loop from ever idling
+    constexpr float SelectionPulseDuration = 2.0f;
+    if (m_SelectedEntity != m_PulsedEntity) {
+        m_PulsedEntity = m_SelectedEntity;
+        m_SelectionPulseTimeLeft = SelectionPulseDuration;
+    }
+    m_SelectionPulseTimeLeft = std::max(m_SelectionPulseTimeLeft - ts.GetSeconds(), 0.0f);
+    const bool showPulse = m_ViewportHovered || m_ViewportFocused || m_SelectionPulseTimeLeft > 0.0f;
+    m_SelectionRenderer.SetPulseActive(m_Scene.IsValid(m_SelectedEntity) && showPulse);
     m_SelectionRenderer.Update(ts.GetSeconds());
 
-    if (m_Framebuffer && m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f) {
-        m_Framebuffer->Bind();
-        RenderCommand::SetClearColor({0.1f, 0.1f, 0.1f, 1.0f});
-        RenderCommand::Clear();
+    // Simulation and the selection pulse animate without input; keep the main loop from idling
+    if (m_EditorState == EditorState::Play || m_SelectionRenderer.IsPulseActive()) {
+        Application::Get().RequestFrame();
+    }
 
+    // Flatten hierarchy changes and propagate dirty world transforms once per frame
+    m_Scene.UpdateTransforms();
+
+    if (m_Framebuffer && m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f) {
         // Update camera aspect ratio if viewport changed
         float aspect = m_ViewportSize.x / m_ViewportSize.y;
         m_EditorCamera.SetAspectRatio(aspect);
 
-        // Render grid (only in Edit mode)
-        if (m_EditorState == EditorState::Edit) {
-            m_GridRenderer.RenderGrid(
-                m_EditorCamera.GetViewProjectionMatrix(),
-                m_EditorCamera.GetPosition(),
-                m_EditorCamera.GetZoom(),
-                m_ViewportSize
-            );
+        // Play mode simulates every frame; otherwise the cached image stays valid
+        // until the scene, camera, size or editor state changes
+        if (m_EditorState == EditorState::Play) {
+            InvalidateViewport();
         }
-
-        Renderer::BeginScene(m_EditorCamera.GetViewProjectionMatrix());
-        for (const auto& object : m_SceneObjects) {
-            glm::mat4 transform = CalculateTransform(object);
-
-            if (object.mesh == SceneObject::MeshType::Quad) {
-                if (m_TextureShader && m_TextureVA) {
-                    Ref<Texture2D> tex = object.textured ? m_CheckerTexture : m_WhiteTexture;
-                    if (tex) {
-                        m_TextureShader->Bind();
-                        m_TextureShader->SetFloat4("u_Color", object.color);
-                        tex->Bind();
-                        Renderer::Submit(m_TextureShader, m_TextureVA, transform);
-                        ++m_DrawCalls;
-                    }
-                }
-            } else {
-                if (m_TriangleShader && m_TriangleVA) {
-                    m_TriangleShader->Bind();
-                    m_TriangleShader->SetFloat4("u_Color", object.color);
-                    Renderer::Submit(m_TriangleShader, m_TriangleVA, transform);
-                    ++m_DrawCalls;
-                }
-            }
+        const ViewportRenderKey key{m_Scene.GetRevision(), m_EditorCamera.GetViewProjectionMatrix(), m_ViewportSize,
+                                    m_EditorState};
+        m_ViewportCached = !m_ViewportDirty && key == m_ViewportRenderKey;
+        if (!m_ViewportCached) {
+            RenderViewport();
+            m_ViewportRenderKey = key;
+            m_ViewportDirty = false;
         }
-        Renderer::EndScene();
 
         // Calculate selection outline
         m_DrawSelectionOutline = false;
-        if (m_SelectedEntityIndex >= 0 && m_SelectedEntityIndex < static_cast<int>(m_SceneObjects.size())) {
-            const SceneObject& selected = m_SceneObjects[static_cast<size_t>(m_SelectedEntityIndex)];
-            glm::mat4 outlineTransform = CalculateTransform(selected) * glm::scale(glm::mat4(1.0f), glm::vec3(1.05f));
+        if (m_Scene.IsValid(m_SelectedEntity)) {
+            glm::mat4 outlineTransform = m_Scene.GetWorldTransform(m_SelectedEntity) * glm::scale(glm::mat4(1.0f), glm::vec3(1.05f));
 
             glm::vec4 corners[4] = {
                 outlineTransform * glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f),
@@ -248,10 +254,8 @@ void EditorLayer::OnUpdate(Timestep ts) {
 
         // Calculate hovered outline
         m_DrawHoveredOutline = false;
-        if (m_HoveredEntityIndex >= 0 && m_HoveredEntityIndex < static_cast<int>(m_SceneObjects.size()) 
-            && m_HoveredEntityIndex != m_SelectedEntityIndex) {
-            const SceneObject& hovered = m_SceneObjects[static_cast<size_t>(m_HoveredEntityIndex)];
-            glm::mat4 outlineTransform = CalculateTransform(hovered) * glm::scale(glm::mat4(1.0f), glm::vec3(1.03f));
+        if (m_Scene.IsValid(m_HoveredEntity) && m_HoveredEntity != m_SelectedEntity) {
+            glm::mat4 outlineTransform = m_Scene.GetWorldTransform(m_HoveredEntity) * glm::scale(glm::mat4(1.0f), glm::vec3(1.03f));
 
             glm::vec4 corners[4] = {
                 outlineTransform * glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f),
@@ -268,11 +272,10 @@ void EditorLayer::OnUpdate(Timestep ts) {
             }
             m_DrawHoveredOutline = true;
         }
-
-        m_Framebuffer->Unbind();
     }
 
-    m_StatsPanel.Update(m_FPS, m_DrawCalls);
+    m_StatsPanel.Update(m_DrawCalls);
+    m_StatsPanel.SetViewportCached(m_ViewportCached);
 }
 
 void EditorLayer::OnImGuiRender() {
@@ -337,8 +340,14 @@ void EditorLayer::OnImGuiRender() {
             bool canUndo = m_CommandManager.CanUndo();
             bool canRedo = m_CommandManager.CanRedo();
             
-            std::string undoLabel = canUndo ? "Undo " + m_CommandManager.GetUndoCommandName() : "Undo";
-            std::string redoLabel = canRedo ? "Redo " + m_CommandManager.GetRedoCommandName() : "Redo";
+            FrameString undoLabel("Undo", FrameAllocator::GetResource());
+            FrameString redoLabel("Redo", FrameAllocator::GetResource());
+            if (canUndo) {
+                undoLabel.append(" ").append(m_CommandManager.GetUndoCommandName());
+            }
+            if (canRedo) {
+                redoLabel.append(" ").append(m_CommandManager.GetRedoCommandName());
+            }
             
             if (ImGui::MenuItem(undoLabel.c_str(), "Ctrl+Z", false, canUndo)) {
                 m_CommandManager.Undo();
@@ -347,14 +356,46 @@ void EditorLayer::OnImGuiRender() {
                 m_CommandManager.Redo();
             }
             ImGui::Separator();
-            if (ImGui::MenuItem("Duplicate", "Ctrl+D", false, m_SelectedEntityIndex >= 0)) {
+            if (ImGui::MenuItem("Duplicate", "Ctrl+D", false, m_Scene.IsValid(m_SelectedEntity))) {
                 DuplicateSelected();
             }
+            ImGui::Separator();
+            bool recording = m_SessionRecorder.IsRecording();
+            if (ImGui::MenuItem("Record Session", nullptr, recording, m_EditorState == EditorState::Edit)) {
+                if (recording) {
+                    StopSessionRecording();
+                } else {
+                    StartSessionRecording();
+                }
+            }
             ImGui::EndMenu();
         }
         if (ImGui::BeginMenu("View")) {
             ImGui::MenuItem("Viewport", nullptr, true, true);
             ImGui::MenuItem("Scene Hierarchy", nullptr, true, true);
+            ImGui::Separator();
+            Application& app = Application::Get();
+            if (ImGui::MenuItem("Idle When Inactive", nullptr, app.IsIdleModeEnabled())) {
+                app.SetIdleMode(!app.IsIdleModeEnabled());
+            }
+            if (ImGui::BeginMenu("Frame Pacing")) {
+                const FramePacingMode mode = app.GetFramePacer().GetMode();
+                const double targetFps = app.GetFramePacer().GetTargetFps();
+                if (ImGui::MenuItem("VSync", nullptr, mode == FramePacingMode::VSync)) {
+                    app.SetFramePacing(FramePacingMode::VSync);
+                }
+                if (ImGui::MenuItem("Uncapped", nullptr, mode == FramePacingMode::Uncapped)) {
+                    app.SetFramePacing(FramePacingMode::Uncapped);
+                }
+                for (double fps : {30.0, 60.0, 120.0}) {
+                    FrameString label("Limit to ", FrameAllocator::GetResource());
+                    label.append(std::to_string(static_cast<int>(fps))).append(" FPS");
+                    if (ImGui::MenuItem(label.c_str(), nullptr, mode == FramePacingMode::FixedRate && targetFps == fps)) {
+                        app.SetFramePacing(FramePacingMode::FixedRate, fps);
+                    }
+                }
+                ImGui::EndMenu();
+            }
             ImGui::EndMenu();
         }
         
@@ -407,6 +448,7 @@ void EditorLayer::OnImGuiRender() {
     bool gridEnabled = m_GridRenderer.GetGridSettings().enabled;
     if (ImGui::Checkbox("Grid", &gridEnabled)) {
         m_GridRenderer.GetGridSettings().enabled = gridEnabled;
+        InvalidateViewport();
     }
     
     ImGui::SameLine();
@@ -474,7 +516,7 @@ void EditorLayer::OnImGuiRender() {
     ImGui::PopStyleColor(3);
     
     ImGui::SameLine(0.0f, 20.0f);
-    bool hasSelection = m_SelectedEntityIndex >= 0;
+    bool hasSelection = m_Scene.IsValid(m_SelectedEntity);
     
     ImGui::BeginDisabled(!isEditing);
     if (ImGui::Button("Add")) {
@@ -505,6 +547,8 @@ void EditorLayer::OnImGuiRender() {
     
     // Only allow editing in Edit mode
     if (m_EditorState == EditorState::Edit) {
+        // Picks up entities created or moved by events since OnUpdate
+        m_Scene.UpdateTransforms();
         HandleViewportHover();
         HandleViewportPicking();
         HandleGizmos();
@@ -514,6 +558,7 @@ void EditorLayer::OnImGuiRender() {
     m_PropertiesPanel.OnImGuiRender();
     m_ContentBrowserPanel.OnImGuiRender();
     m_StatsPanel.OnImGuiRender();
+    m_ProfilerPanel.OnImGuiRender();
 
     // Draw selection and hover highlights
     const glm::vec2* bounds = m_ViewportPanel.GetBounds();
@@ -528,7 +573,7 @@ void EditorLayer::OnImGuiRender() {
         
         // Draw selected outline on top
         if (m_DrawSelectionOutline) {
-            SelectionState state = (m_HoveredEntityIndex == m_SelectedEntityIndex && m_HoveredEntityIndex >= 0)
+            SelectionState state = (m_HoveredEntity == m_SelectedEntity && !m_HoveredEntity.IsNull())
                 ? SelectionState::HoveredAndSelected
                 : SelectionState::Selected;
             m_SelectionRenderer.DrawOutline(drawList, m_SelectedOutline, bounds[0], state);
@@ -567,19 +612,14 @@ void EditorLayer::HandleViewportCameraControls() {
     }
 }
 
-static bool PointInEntity(const glm::vec2& point, const SceneObject& object) {
-    glm::mat4 transform =
-        glm::translate(glm::mat4(1.0f), object.position) *
-        glm::rotate(glm::mat4(1.0f), glm::radians(object.rotation.z), glm::vec3(0, 0, 1)) *
-        glm::scale(glm::mat4(1.0f), object.scale);
-
+static bool PointInEntity(const glm::vec2& point, const glm::mat4& transform) {
     glm::mat4 invTransform = glm::inverse(transform);
     glm::vec4 local = invTransform * glm::vec4(point, 0.0f, 1.0f);
     return local.x >= -0.5f && local.x <= 0.5f && local.y >= -0.5f && local.y <= 0.5f;
 }
 
 void EditorLayer::HandleViewportHover() {
-    m_HoveredEntityIndex = -1;
+    m_HoveredEntity = EntityHandle();
     
     if (!m_ViewportHovered || ImGuizmo::IsOver()) {
         return;
@@ -603,9 +643,9 @@ void EditorLayer::HandleViewportHover() {
     glm::vec2 worldPoint = m_EditorCamera.ScreenToWorld(viewportPoint, m_ViewportSize);
 
     // Check entities from front to back
-    for (int i = static_cast<int>(m_SceneObjects.size()) - 1; i >= 0; --i) {
-        if (PointInEntity(worldPoint, m_SceneObjects[static_cast<size_t>(i)])) {
-            m_HoveredEntityIndex = i;
+    for (size_t i = m_Scene.Size(); i-- > 0;) {
+        if (PointInEntity(worldPoint, m_Scene.GetWorldTransform(m_Scene.GetHandleAt(i)))) {
+            m_HoveredEntity = m_Scene.GetHandleAt(i);
             return;
         }
     }
@@ -634,19 +674,71 @@ void EditorLayer::HandleViewportPicking() {
     glm::vec2 worldPoint = m_EditorCamera.ScreenToWorld(viewportPoint, m_ViewportSize);
 
     // Check entities from front to back
-    for (int i = static_cast<int>(m_SceneObjects.size()) - 1; i >= 0; --i) {
-        if (PointInEntity(worldPoint, m_SceneObjects[static_cast<size_t>(i)])) {
-            m_SelectedEntityIndex = i;
+    for (size_t i = m_Scene.Size(); i-- > 0;) {
+        if (PointInEntity(worldPoint, m_Scene.GetWorldTransform(m_Scene.GetHandleAt(i)))) {
+            m_SelectedEntity = m_Scene.GetHandleAt(i);
             return;
         }
     }
 }
 
 
+void EditorLayer::RenderViewport() {
+    VEST_PROFILE_FUNCTION();
+    m_DrawCalls = 0;
+    m_Framebuffer->Bind();
+    RenderCommand::SetClearColor({0.1f, 0.1f, 0.1f, 1.0f});
+    RenderCommand::Clear();
+
+    // Render grid (only in Edit mode)
+    if (m_EditorState == EditorState::Edit) {
+        m_GridRenderer.RenderGrid(
+            m_EditorCamera.GetViewProjectionMatrix(),
+            m_EditorCamera.GetPosition(),
+            m_EditorCamera.GetZoom(),
+            m_ViewportSize
+        );
+    }
+
+    Renderer::BeginScene(m_EditorCamera.GetViewProjectionMatrix());
+    for (size_t i = 0; i < m_Scene.Size(); ++i) {
+        const SceneObject& object = m_Scene.GetAt(i);
+        const glm::mat4& transform = m_Scene.GetWorldTransform(m_Scene.GetHandleAt(i));
+
+        if (object.mesh == SceneObject::MeshType::Quad) {
+            if (m_TextureShader && m_TextureVA) {
+                Ref<Texture2D> tex = object.textured ? m_CheckerTexture : m_WhiteTexture;
+                if (tex) {
+                    m_TextureShader->Bind();
+                    m_TextureShader->SetFloat4("u_Color", object.color);
+                    tex->Bind();
+                    Renderer::Submit(m_TextureShader, m_TextureVA, transform);
+                    ++m_DrawCalls;
+                }
+            }
+        } else {
+            if (m_TriangleShader && m_TriangleVA) {
+                m_TriangleShader->Bind();
+                m_TriangleShader->SetFloat4("u_Color", object.color);
+                Renderer::Submit(m_TriangleShader, m_TriangleVA, transform);
+                ++m_DrawCalls;
+            }
+        }
+    }
+    Renderer::EndScene();
+    m_Framebuffer->Unbind();
+}
+
 void EditorLayer::RebuildFramebuffer(uint32_t width, uint32_t height) {
     m_ViewportSize = {static_cast<float>(width), static_cast<float>(height)};
+    InvalidateViewport();
+
+    if (m_Framebuffer) {
+        m_Framebuffer->Resize(width, height);
+        return;
+    }
 
-    FramebufferSpecification spec = m_Framebuffer ? m_Framebuffer->GetSpecification() : FramebufferSpecification{};
+    FramebufferSpecification spec;
     spec.width = width;
     spec.height = height;
     m_Framebuffer = Framebuffer::Create(spec);
@@ -659,7 +751,7 @@ void EditorLayer::SaveScene(const std::string& filepath) {
         path = std::filesystem::path(VEST_ASSET_DIR) / "scenes" / path;
     }
     std::filesystem::create_directories(path.parent_path());
-    SceneSerializer::Serialize(path.string(), m_SceneObjects);
+    SceneSerializer::Serialize(path.string(), m_Scene);
 }
 
 void EditorLayer::LoadScene(const std::string& filepath) {
@@ -667,52 +759,57 @@ void EditorLayer::LoadScene(const std::string& filepath) {
     if (!path.is_absolute()) {
         path = std::filesystem::path(VEST_ASSET_DIR) / "scenes" / path;
     }
-    std::vector<SceneObject> loaded;
+    Scene loaded;
     if (SceneSerializer::Deserialize(path.string(), loaded)) {
-        m_SceneObjects = std::move(loaded);
-        m_SelectedEntityIndex = m_SceneObjects.empty() ? -1 : 0;
+        m_Scene = std::move(loaded);
+        m_SelectedEntity = m_Scene.Empty() ? EntityHandle() : m_Scene.GetHandleAt(0);
+        m_HoveredEntity = EntityHandle();
+        // The recorded starting scene no longer applies
+        StopSessionRecording();
         m_CommandManager.Clear();
     }
 }
 
 void EditorLayer::AddEntity() {
     SceneObject entity;
-    entity.name = "Entity " + std::to_string(m_SceneObjects.size());
+    entity.name = "Entity " + std::to_string(m_Scene.Size());
     entity.mesh = SceneObject::MeshType::Quad;
     
-    auto cmd = CreateScope<CreateEntityCommand>(&m_SceneObjects, entity);
+    auto cmd = MakeCommand<CreateEntityCommand>(&m_Scene, entity);
+    CreateEntityCommand* create = cmd.get();
     if (m_CommandManager.ExecuteCommand(std::move(cmd))) {
-        m_SelectedEntityIndex = static_cast<int>(m_SceneObjects.size()) - 1;
+        m_SelectedEntity = create->GetCreatedEntity();
     }
 }
 
 void EditorLayer::DeleteSelected() {
-    if (m_SelectedEntityIndex < 0 || m_SelectedEntityIndex >= static_cast<int>(m_SceneObjects.size())) {
+    if (!m_Scene.IsValid(m_SelectedEntity)) {
         return;
     }
-    auto cmd = CreateScope<DeleteEntityCommand>(&m_SceneObjects, m_SelectedEntityIndex);
+    auto cmd = MakeCommand<DeleteEntityCommand>(&m_Scene, m_SelectedEntity);
     if (m_CommandManager.ExecuteCommand(std::move(cmd))) {
-        if (m_SelectedEntityIndex >= static_cast<int>(m_SceneObjects.size())) {
-            m_SelectedEntityIndex = static_cast<int>(m_SceneObjects.size()) - 1;
-        }
+        m_SelectedEntity = m_Scene.Empty() ? EntityHandle() : m_Scene.GetHandleAt(m_Scene.Size() - 1);
     }
 }
 
 void EditorLayer::DuplicateSelected() {
-    if (m_SelectedEntityIndex < 0 || m_SelectedEntityIndex >= static_cast<int>(m_SceneObjects.size())) {
+    const SceneObject* selected = m_Scene.TryGet(m_SelectedEntity);
+    if (!selected) {
         return;
     }
-    SceneObject copy = m_SceneObjects[static_cast<size_t>(m_SelectedEntityIndex)];
-    copy.name += " Copy";
+    SceneObject copy = *selected;
+    copy.name = copy.name.Str() + " Copy";
     
-    auto cmd = CreateScope<CreateEntityCommand>(&m_SceneObjects, copy);
+    auto cmd = MakeCommand<CreateEntityCommand>(&m_Scene, copy);
+    CreateEntityCommand* create = cmd.get();
     if (m_CommandManager.ExecuteCommand(std::move(cmd))) {
-        m_SelectedEntityIndex = static_cast<int>(m_SceneObjects.size()) - 1;
+        m_SelectedEntity = create->GetCreatedEntity();
     }
 }
 
 void EditorLayer::HandleGizmos() {
-    if (m_SelectedEntityIndex < 0 || m_SelectedEntityIndex >= static_cast<int>(m_SceneObjects.size())) {
+    const SceneObject* selected = m_Scene.TryGet(m_SelectedEntity);
+    if (!selected) {
         m_GizmoWasUsing = false;
         return;
     }
@@ -732,8 +829,8 @@ void EditorLayer::HandleGizmos() {
     ImGuizmo::SetDrawlist();
     ImGuizmo::SetRect(bounds[0].x, bounds[0].y, m_ViewportSize.x, m_ViewportSize.y);
 
-    SceneObject& object = m_SceneObjects[static_cast<size_t>(m_SelectedEntityIndex)];
-    glm::mat4 transform = CalculateTransform(object);
+    const SceneObject& object = *selected;
+    glm::mat4 transform = m_Scene.GetWorldTransform(m_SelectedEntity);
 
     glm::mat4 viewMatrix = m_EditorCamera.GetViewMatrix();
     glm::mat4 projectionMatrix = m_EditorCamera.GetProjectionMatrix();
@@ -759,29 +856,34 @@ void EditorLayer::HandleGizmos() {
         }
         m_GizmoWasUsing = true;
 
+        // The gizmo works in world space; stored values are parent-relative
+        glm::mat4 parentWorld = m_Scene.GetWorldTransform(m_Scene.GetParent(m_SelectedEntity));
+        glm::mat4 localTransform = glm::inverse(parentWorld) * transform;
+
         glm::vec3 translation;
         glm::vec3 rotation;
         glm::vec3 scale;
-        DecomposeTransform(transform, translation, rotation, scale);
-        object.position = translation;
-        object.rotation = glm::vec3(0.0f, 0.0f, rotation.z);
-        object.scale = scale;
+        DecomposeTransform(localTransform, translation, rotation, scale);
+        SceneObject& edited = *m_Scene.TryGetMutable(m_SelectedEntity);
+        edited.position = translation;
+        edited.rotation = glm::vec3(0.0f, 0.0f, rotation.z);
+        edited.scale = scale;
     } else if (m_GizmoWasUsing) {
         // End of drag - create command for undo history
         m_GizmoWasUsing = false;
         
-        Scope<ICommand> cmd = nullptr;
+        CommandPtr cmd;
         switch (m_GizmoOperation) {
             case ImGuizmo::TRANSLATE:
-                cmd = CreateScope<TransformCommand>(&m_SceneObjects, m_SelectedEntityIndex, 
+                cmd = MakeCommand<TransformCommand>(&m_Scene, m_SelectedEntity, 
                     TransformCommand::Type::Position, m_GizmoOldPosition, object.position);
                 break;
             case ImGuizmo::ROTATE:
-                cmd = CreateScope<TransformCommand>(&m_SceneObjects, m_SelectedEntityIndex, 
+                cmd = MakeCommand<TransformCommand>(&m_Scene, m_SelectedEntity, 
                     TransformCommand::Type::Rotation, m_GizmoOldRotation, object.rotation);
                 break;
             case ImGuizmo::SCALE:
-                cmd = CreateScope<TransformCommand>(&m_SceneObjects, m_SelectedEntityIndex, 
+                cmd = MakeCommand<TransformCommand>(&m_Scene, m_SelectedEntity, 
                     TransformCommand::Type::Scale, m_GizmoOldScale, object.scale);
                 break;
         }
@@ -793,12 +895,6 @@ void EditorLayer::HandleGizmos() {
     }
 }
 
-glm::mat4 EditorLayer::CalculateTransform(const SceneObject& object) const {
-    return glm::translate(glm::mat4(1.0f), object.position) *
-           glm::rotate(glm::mat4(1.0f), glm::radians(object.rotation.z), glm::vec3(0, 0, 1)) *
-           glm::scale(glm::mat4(1.0f), object.scale);
-}
-
 void EditorLayer::DecomposeTransform(const glm::mat4& transform, glm::vec3& translation, glm::vec3& rotation, glm::vec3& scale) {
     glm::vec3 skew;
     glm::vec4 perspective;
@@ -814,10 +910,12 @@ void EditorLayer::OnPlayButtonPressed() {
     
     VEST_CORE_INFO("Entering Play Mode");
     
-    // Backup current scene state
-    m_SceneBackup = m_SceneObjects;
+    // Snapshot current scene state (copy-on-write: shares every chunk until
+    // play mode writes to it)
+    m_SceneBackup = m_Scene;
     
     // Clear undo history (changes in play mode won't be saved)
+    StopSessionRecording();
     m_CommandManager.Clear();
     
     // Change state
@@ -840,14 +938,16 @@ void EditorLayer::OnStopButtonPressed() {
     
     VEST_CORE_INFO("Stopping Play Mode - Restoring scene state");
     
-    // Restore scene from backup
-    m_SceneObjects = m_SceneBackup;
-    m_SceneBackup.clear();
+    // Restore scene from snapshot by swapping chunk pointers
+    m_Scene = std::move(m_SceneBackup);
+    m_SceneBackup = Scene();
     
-    // Restore selection if still valid
-    if (m_SelectedEntityIndex >= static_cast<int>(m_SceneObjects.size())) {
-        m_SelectedEntityIndex = m_SceneObjects.empty() ? -1 : static_cast<int>(m_SceneObjects.size()) - 1;
+    // Handles are preserved by the backup, so only drop selection if the
+    // entity did not exist before entering play mode
+    if (!m_Scene.IsValid(m_SelectedEntity)) {
+        m_SelectedEntity = m_Scene.Empty() ? EntityHandle() : m_Scene.GetHandleAt(m_Scene.Size() - 1);
     }
+    m_HoveredEntity = EntityHandle();
     
     // Clear undo history
     m_CommandManager.Clear();
@@ -856,4 +956,24 @@ void EditorLayer::OnStopButtonPressed() {
     m_EditorState = EditorState::Edit;
 }
 
+void EditorLayer::StartSessionRecording() {
+    std::error_code tempError;
+    std::filesystem::path tempDirectory = std::filesystem::temp_directory_path(tempError);
+    if (tempError) {
+        VEST_CORE_ERROR("No temporary directory for the session log: {0}", tempError.message());
+        return;
+    }
+
+    const auto session = std::chrono::system_clock::now().time_since_epoch().count();
+    const std::filesystem::path path = tempDirectory / "VestEngine" / ("session-" + std::to_string(session) + ".vsession");
+    if (m_SessionRecorder.Begin(path, m_Scene)) {
+        m_CommandManager.SetSessionRecorder(&m_SessionRecorder);
+    }
+}
+
+void EditorLayer::StopSessionRecording() {
+    m_CommandManager.SetSessionRecorder(nullptr);
+    m_SessionRecorder.End();
+}
+
 }  // namespace Vest
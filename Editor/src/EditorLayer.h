@@ -22,17 +22,19 @@
 #include "Serialization/SceneSerializer.h"
 
 #include "Panels/ContentBrowserPanel.h"
+#include "Panels/ProfilerPanel.h"
 #include "Panels/PropertiesPanel.h"
 #include "Panels/SceneHierarchyPanel.h"
 #include "Panels/StatsPanel.h"
 #include "Panels/ViewportPanel.h"
-#include <Scene/SceneObject.h>
+#include <Scene/Scene.h>
 
 #include "EditorCamera.h"
 #include "Commands/CommandManager.h"
 #include "Commands/TransformCommand.h"
 #include "Commands/EntityCommands.h"
 #include "Commands/MacroCommand.h"
+#include "Commands/SessionRecorder.h"
 #include "Rendering/SelectionRenderer.h"
 #include "Rendering/GridRenderer.h"
 
@@ -56,6 +58,22 @@ public:
 
 private:
     void RebuildFramebuffer(uint32_t width, uint32_t height);
+    void RenderViewport();
+
+    /**
+     * @brief Force the viewport to re-render next frame, for changes the render key does not see
+     */
+    void InvalidateViewport() { m_ViewportDirty = true; }
+
+    // What the cached viewport image was rendered from; any difference re-renders it
+    struct ViewportRenderKey {
+        uint64_t sceneRevision = 0;
+        glm::mat4 viewProjection = glm::mat4(0.0f);
+        glm::vec2 size = glm::vec2(0.0f);
+        EditorState state = EditorState::Edit;
+
+        bool operator==(const ViewportRenderKey&) const = default;
+    };
 
     Ref<Framebuffer> m_Framebuffer;
     glm::vec2 m_ViewportSize = {0.0f, 0.0f};
@@ -65,9 +83,12 @@ private:
     PropertiesPanel m_PropertiesPanel;
     ContentBrowserPanel m_ContentBrowserPanel;
     StatsPanel m_StatsPanel;
+    ProfilerPanel m_ProfilerPanel;
 
-    float m_FPS = 0.0f;
-    uint32_t m_DrawCalls = 0;
+    uint32_t m_DrawCalls = 0;  // Of the last viewport render
+    ViewportRenderKey m_ViewportRenderKey;
+    bool m_ViewportDirty = true;
+    bool m_ViewportCached = false;
 
     Ref<Shader> m_TriangleShader;
     Ref<VertexArray> m_TriangleVA;
@@ -76,12 +97,14 @@ private:
     Ref<Texture2D> m_CheckerTexture;
     Ref<Texture2D> m_WhiteTexture;
 
-    std::vector<SceneObject> m_SceneObjects;
-    int m_SelectedEntityIndex = -1;
-    int m_HoveredEntityIndex = -1;
+    Scene m_Scene;
+    EntityHandle m_SelectedEntity;
+    EntityHandle m_HoveredEntity;
 
     EditorCamera m_EditorCamera;
     SelectionRenderer m_SelectionRenderer;
+    EntityHandle m_PulsedEntity;        // Selection the pulse last started for
+    float m_SelectionPulseTimeLeft = 0.0f;  // Of the pulse shown after the selection changes
     GridRenderer m_GridRenderer;
     bool m_ViewportFocused = false;
     bool m_ViewportHovered = false;
@@ -98,10 +121,11 @@ private:
     glm::vec3 m_GizmoOldScale;
 
     CommandManager m_CommandManager;
+    SessionRecorder m_SessionRecorder;
     
     // Play mode state
     EditorState m_EditorState = EditorState::Edit;
-    std::vector<SceneObject> m_SceneBackup;
+    Scene m_SceneBackup;
 
     void HandleViewportCameraControls();
     void HandleViewportPicking();
@@ -115,7 +139,8 @@ private:
     void OnPlayButtonPressed();
     void OnPauseButtonPressed();
     void OnStopButtonPressed();
-    glm::mat4 CalculateTransform(const SceneObject& object) const;
+    void StartSessionRecording();
+    void StopSessionRecording();
     void DecomposeTransform(const glm::mat4& transform, glm::vec3& translation, glm::vec3& rotation, glm::vec3& scale);
 };
 
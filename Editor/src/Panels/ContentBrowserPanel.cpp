@@ -3,12 +3,23 @@
 #include <imgui.h>
 #include <algorithm>
 #include <sstream>
+#include <cctype>
 #include <iomanip>
+#include <utility>
 
+#include "Core/FrameAllocator.h"
 #include "Core/Log.h"
 
 namespace Vest {
 
+namespace {
+
+char ToLower(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+}  // namespace
+
 ContentBrowserPanel::ContentBrowserPanel(const std::filesystem::path& assetsPath)
     : m_AssetsPath(assetsPath)
     , m_CurrentDirectory(assetsPath)
@@ -43,6 +54,11 @@ void ContentBrowserPanel::OnImGuiRender() {
     ImGui::BeginChild("Asset View", ImVec2(0, 0), true);
     RenderAssetGrid();
     ImGui::EndChild();
+
+    // Deferred: navigating rebuilds the lists the tree and grid were iterating
+    if (!m_PendingNavigation.empty()) {
+        NavigateToDirectory(std::exchange(m_PendingNavigation, {}));
+    }
     
     RenderContextMenu();
     
@@ -62,6 +78,7 @@ void ContentBrowserPanel::RenderTopBar() {
     ImGui::SameLine();
     
     if (ImGui::Button("Refresh")) {
+        RescanDirectoryTree();
         RefreshAssets();
     }
     ImGui::SameLine();
@@ -82,47 +99,43 @@ void ContentBrowserPanel::RenderTopBar() {
     // Thumbnail size slider
     ImGui::SliderFloat("Size", &m_ThumbnailSize, 50.0f, 150.0f);
     ImGui::SameLine();
-    ImGui::Checkbox("Show Hidden", &m_ShowHiddenFiles);
+    if (ImGui::Checkbox("Show Hidden", &m_ShowHiddenFiles)) {
+        RescanDirectoryTree();
+        RefreshAssets();
+    }
 }
 
 void ContentBrowserPanel::RenderDirectoryTree() {
     ImGui::Text("Directories");
     ImGui::Separator();
     
-    // Render directory tree recursively
-    std::function<void(const std::filesystem::path&)> renderTree = [&](const std::filesystem::path& path) {
-        if (!std::filesystem::exists(path) || !std::filesystem::is_directory(path)) {
-            return;
+    if (!m_DirectoryTree.scanned) {
+        m_DirectoryTree.path = m_AssetsPath;
+        ScanDirectory(m_DirectoryTree);
+    }
+    
+    for (auto& child : m_DirectoryTree.children) {
+        RenderDirectoryNode(child);
+    }
+}
+
+void ContentBrowserPanel::RenderDirectoryNode(DirectoryNode& node) {
+    bool isOpen = ImGui::TreeNodeEx(node.name.c_str(), 
+        ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick);
+    
+    if (ImGui::IsItemClicked()) {
+        m_PendingNavigation = node.path;
+    }
+    
+    if (isOpen) {
+        if (!node.scanned) {
+            ScanDirectory(node);
         }
-        
-        try {
-            for (const auto& entry : std::filesystem::directory_iterator(path)) {
-                if (!entry.is_directory()) continue;
-                
-                const auto& dirPath = entry.path();
-                std::string dirName = dirPath.filename().string();
-                
-                // Skip hidden directories if not showing them
-                if (!m_ShowHiddenFiles && dirName[0] == '.') continue;
-                
-                bool isOpen = ImGui::TreeNodeEx(dirName.c_str(), 
-                    ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick);
-                
-                if (ImGui::IsItemClicked()) {
-                    NavigateToDirectory(dirPath);
-                }
-                
-                if (isOpen) {
-                    renderTree(dirPath);
-                    ImGui::TreePop();
-                }
-            }
-        } catch (const std::filesystem::filesystem_error& e) {
-            VEST_CORE_ERROR("Error reading directory tree: {0}", e.what());
+        for (auto& child : node.children) {
+            RenderDirectoryNode(child);
         }
-    };
-    
-    renderTree(m_AssetsPath);
+        ImGui::TreePop();
+    }
 }
 
 void ContentBrowserPanel::RenderAssetGrid() {
@@ -133,15 +146,16 @@ void ContentBrowserPanel::RenderAssetGrid() {
     
     ImGui::Columns(columnCount, nullptr, false);
     
+    // Case-insensitive search without copying every asset name
+    FrameString lowerFilter(m_SearchFilter, FrameAllocator::GetResource());
+    std::transform(lowerFilter.begin(), lowerFilter.end(), lowerFilter.begin(), ToLower);
+    
     for (auto& asset : m_CurrentAssets) {
         // Apply search filter
-        if (!m_SearchFilter.empty()) {
-            std::string lowerName = asset.name;
-            std::string lowerFilter = m_SearchFilter;
-            std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-            std::transform(lowerFilter.begin(), lowerFilter.end(), lowerFilter.begin(), ::tolower);
-            
-            if (lowerName.find(lowerFilter) == std::string::npos) {
+        if (!lowerFilter.empty()) {
+            auto match = std::search(asset.name.begin(), asset.name.end(), lowerFilter.begin(), lowerFilter.end(),
+                [](char nameChar, char filterChar) { return ToLower(nameChar) == filterChar; });
+            if (match == asset.name.end()) {
                 continue;
             }
         }
@@ -154,7 +168,7 @@ void ContentBrowserPanel::RenderAssetGrid() {
 }
 
 void ContentBrowserPanel::RenderAssetItem(const AssetMetadata& asset) {
-    ImGui::PushID(asset.path.string().c_str());
+    ImGui::PushID(asset.name.c_str());
     
     // Icon/Thumbnail
     ImVec2 thumbnailSize(m_ThumbnailSize, m_ThumbnailSize);
@@ -181,7 +195,7 @@ void ContentBrowserPanel::RenderAssetItem(const AssetMetadata& asset) {
     
     if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
         if (asset.isDirectory) {
-            NavigateToDirectory(asset.path);
+            m_PendingNavigation = asset.path;
         } else {
             VEST_CORE_INFO("Opening asset: {0}", asset.path.string());
             // TODO: Open asset in appropriate editor
@@ -244,6 +258,7 @@ void ContentBrowserPanel::RenderContextMenu() {
         }
         
         if (ImGui::MenuItem("Refresh")) {
+            RescanDirectoryTree();
             RefreshAssets();
         }
         
@@ -311,6 +326,11 @@ void ContentBrowserPanel::NavigateUp() {
     }
 }
 
+void ContentBrowserPanel::RescanDirectoryTree() {
+    // Rebuilt lazily from m_AssetsPath by the next RenderDirectoryTree()
+    m_DirectoryTree = DirectoryNode();
+}
+
 void ContentBrowserPanel::RefreshAssets() {
     m_CurrentAssets.clear();
     
@@ -353,6 +373,35 @@ void ContentBrowserPanel::RefreshAssets() {
     }
 }
 
+void ContentBrowserPanel::ScanDirectory(DirectoryNode& node) {
+    node.scanned = true;
+    node.children.clear();
+    
+    if (!std::filesystem::exists(node.path) || !std::filesystem::is_directory(node.path)) {
+        return;
+    }
+    
+    try {
+        for (const auto& entry : std::filesystem::directory_iterator(node.path)) {
+            if (!entry.is_directory()) continue;
+            
+            DirectoryNode child;
+            child.path = entry.path();
+            child.name = child.path.filename().string();
+            
+            // Skip hidden directories if not showing them
+            if (!m_ShowHiddenFiles && child.name[0] == '.') continue;
+            
+            node.children.push_back(std::move(child));
+        }
+        
+        std::sort(node.children.begin(), node.children.end(),
+            [](const DirectoryNode& a, const DirectoryNode& b) { return a.name < b.name; });
+    } catch (const std::filesystem::filesystem_error& e) {
+        VEST_CORE_ERROR("Error reading directory tree: {0}", e.what());
+    }
+}
+
 void ContentBrowserPanel::SetCurrentDirectory(const std::filesystem::path& path) {
     NavigateToDirectory(path);
 }
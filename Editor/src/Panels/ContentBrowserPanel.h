@@ -19,6 +19,14 @@ struct AssetMetadata {
     std::string extension;
 };
 
+// Cached directory tree; a node's children are scanned the first time it is expanded
+struct DirectoryNode {
+    std::string name;
+    std::filesystem::path path;
+    std::vector<DirectoryNode> children;
+    bool scanned = false;
+};
+
 class ContentBrowserPanel {
 public:
     explicit ContentBrowserPanel(const std::filesystem::path& assetsPath = "assets");
@@ -31,6 +39,7 @@ public:
 private:
     void RenderTopBar();
     void RenderDirectoryTree();
+    void RenderDirectoryNode(DirectoryNode& node);
     void RenderAssetGrid();
     void RenderAssetItem(const AssetMetadata& asset);
     void RenderContextMenu();
@@ -39,6 +48,8 @@ private:
     void NavigateBack();
     void NavigateUp();
     void RefreshAssets();
+    void RescanDirectoryTree();
+    void ScanDirectory(DirectoryNode& node);
     
     Ref<Texture2D> GetIconForFileType(const std::string& extension);
     std::string FormatFileSize(uintmax_t bytes);
@@ -51,6 +62,8 @@ private:
     
     std::vector<AssetMetadata> m_CurrentAssets;
     AssetMetadata* m_SelectedAsset = nullptr;
+    DirectoryNode m_DirectoryTree;  // Rooted at m_AssetsPath, kept across navigation
+    std::filesystem::path m_PendingNavigation;  // Applied after the tree and grid are drawn
     
     // Icons
     Ref<Texture2D> m_FolderIcon;
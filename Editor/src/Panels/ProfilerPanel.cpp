@@ -0,0 +1,355 @@
+#include "Panels/ProfilerPanel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+// ImZoomSlider needs the ImVec2 operators and ImRect
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include "ImZoomSlider.h"
+
+namespace Vest {
+
+namespace {
+
+constexpr float FrameBudgetMs = 1000.0f / 60.0f;
+constexpr float ChartHeight = 80.0f;
+
+float ToMs(int64_t ns) {
+    return static_cast<float>(static_cast<double>(ns) * 1.0e-6);
+}
+
+ImU32 ScopeColor(const char* name) {
+    const size_t hash = std::hash<std::string_view>{}(name);
+    float r, g, b;
+    ImGui::ColorConvertHSVtoRGB(static_cast<float>(hash % 360) / 360.0f, 0.45f, 0.85f, r, g, b);
+    return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+}
+
+ImU32 FrameColor(float ms) {
+    if (ms <= FrameBudgetMs) {
+        return IM_COL32(90, 180, 90, 255);
+    }
+    return ms <= 2.0f * FrameBudgetMs ? IM_COL32(220, 180, 60, 255) : IM_COL32(220, 70, 60, 255);
+}
+
+// The label is drawn only where it fits
+void DrawBox(ImDrawList* drawList, const ImVec2& min, const ImVec2& max, ImU32 color, const char* label) {
+    drawList->AddRectFilled(min, max, color);
+    drawList->AddRect(min, max, IM_COL32(0, 0, 0, 80));
+    if (max.x - min.x > 24.0f) {
+        const ImVec4 clip(min.x, min.y, max.x - 2.0f, max.y);
+        drawList->AddText(nullptr, 0.0f, ImVec2(min.x + 3.0f, min.y), IM_COL32(20, 20, 20, 255), label, nullptr,
+                          0.0f, &clip);
+    }
+}
+
+}  // namespace
+
+void ProfilerPanel::OnImGuiRender() {
+    const bool visible = ImGui::Begin(m_Title.c_str());
+    if (visible) {
+        DrawToolbar();
+        DrawFrameChart();
+
+        if (const ProfileFrameRecord* record = FindSelectedFrame()) {
+            if (ImGui::CollapsingHeader("Timeline", ImGuiTreeNodeFlags_DefaultOpen)) {
+                DrawTimeline(*record);
+            }
+            if (ImGui::CollapsingHeader("Flame Graph", ImGuiTreeNodeFlags_DefaultOpen)) {
+                DrawFlameGraph(*record);
+            }
+        } else {
+            ImGui::TextDisabled("Click a frame to inspect its scopes");
+        }
+    }
+    ImGui::End();
+
+    // The history costs a copy of every scope per frame, so it only runs while someone is looking
+    const bool record = visible && !m_Frozen;
+    if (record != m_Recording) {
+        Profiler::SetHistoryEnabled(record);
+        m_Recording = record;
+    }
+}
+
+void ProfilerPanel::DrawToolbar() {
+    if (ImGui::Button(m_Frozen ? "Resume" : "Freeze")) {
+        m_Frozen = !m_Frozen;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Clear")) {
+        Profiler::ClearHistory();
+        m_HasSelection = false;
+        m_FlameValid = false;
+    }
+    ImGui::SameLine();
+    if (Profiler::IsCapturing()) {
+        if (ImGui::Button("Stop Capture")) {
+            Profiler::EndCapture();
+            const ProfileCapture& capture = Profiler::GetCapture();
+            if (capture.ExportChromeTrace(m_TracePath)) {
+                m_TraceStatus = "Wrote " + std::to_string(capture.frames.size()) + " frames to " + m_TracePath;
+            } else {
+                m_TraceStatus = "Export failed, see log";
+            }
+        }
+    } else if (ImGui::Button("Start Capture")) {
+        Profiler::BeginCapture();
+        m_TraceStatus = "Capturing...";
+    }
+    if (!m_TraceStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("%s", m_TraceStatus.c_str());
+    }
+#if !VEST_PROFILE
+    ImGui::TextDisabled("Scopes are compiled out (VEST_ENABLE_PROFILING=OFF)");
+#endif
+}
+
+void ProfilerPanel::DrawFrameChart() {
+    const size_t count = Profiler::GetHistoryCount();
+    const size_t capacity = Profiler::GetHistoryCapacity();
+
+    float maxMs = 0.0f;
+    double totalMs = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const ProfileFrame& frame = Profiler::GetHistoryFrame(i).frame;
+        const float ms = ToMs(frame.endNs - frame.startNs);
+        maxMs = std::max(maxMs, ms);
+        totalMs += ms;
+    }
+    ImGui::Text("%zu frames%s, avg %.2f ms, max %.2f ms", count, m_Frozen ? " (frozen)" : "",
+                count > 0 ? totalMs / static_cast<double>(count) : 0.0, maxMs);
+
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+    ImGui::InvisibleButton("##Frames", ImVec2(width, ChartHeight));
+    const bool hovered = ImGui::IsItemHovered();
+    const bool clicked = ImGui::IsItemClicked();
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 bottomRight = origin + ImVec2(width, ChartHeight);
+    drawList->AddRectFilled(origin, bottomRight, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+    const float barWidth = width / static_cast<float>(capacity);
+    const float scale = ChartHeight / std::max(maxMs, 2.0f * FrameBudgetMs);
+    for (size_t i = 0; i < count; ++i) {
+        const ProfileFrame& frame = Profiler::GetHistoryFrame(i).frame;
+        const float ms = ToMs(frame.endNs - frame.startNs);
+        const float x = origin.x + static_cast<float>(i) * barWidth;
+        const bool selected = m_HasSelection && frame.index == m_SelectedFrame;
+        drawList->AddRectFilled(ImVec2(x, bottomRight.y - ms * scale),
+                                ImVec2(x + std::max(barWidth - 1.0f, 1.0f), bottomRight.y),
+                                selected ? IM_COL32_WHITE : FrameColor(ms));
+    }
+    const float budgetY = bottomRight.y - FrameBudgetMs * scale;
+    drawList->AddLine(ImVec2(origin.x, budgetY), ImVec2(bottomRight.x, budgetY), IM_COL32(255, 255, 255, 80));
+
+    if (!hovered) {
+        return;
+    }
+    const size_t index = static_cast<size_t>((ImGui::GetIO().MousePos.x - origin.x) / barWidth);
+    if (index >= count) {
+        return;
+    }
+    const ProfileFrame& frame = Profiler::GetHistoryFrame(index).frame;
+    const float ms = ToMs(frame.endNs - frame.startNs);
+    ImGui::SetTooltip("Frame %llu: %.2f ms", static_cast<unsigned long long>(frame.index), ms);
+    if (clicked) {
+        m_HasSelection = true;
+        m_SelectedFrame = frame.index;
+        m_ViewStartMs = 0.0f;
+        m_ViewEndMs = ms;
+        // Keep the selected frame from scrolling out of the history
+        m_Frozen = true;
+    }
+}
+
+const ProfileFrameRecord* ProfilerPanel::FindSelectedFrame() const {
+    if (!m_HasSelection) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < Profiler::GetHistoryCount(); ++i) {
+        const ProfileFrameRecord& record = Profiler::GetHistoryFrame(i);
+        if (record.frame.index == m_SelectedFrame) {
+            return &record;
+        }
+    }
+    return nullptr;
+}
+
+void ProfilerPanel::DrawTimeline(const ProfileFrameRecord& record) {
+    const ProfileFrame& frame = record.frame;
+    const float frameMs = std::max(ToMs(frame.endNs - frame.startNs), 0.001f);
+    ImGui::Text("Frame %llu: %.2f ms, showing %.3f - %.3f ms", static_cast<unsigned long long>(frame.index), frameMs,
+                m_ViewStartMs, m_ViewEndMs);
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Fit") || m_ViewEndMs <= m_ViewStartMs || m_ViewEndMs > frameMs) {
+        m_ViewStartMs = 0.0f;
+        m_ViewEndMs = frameMs;
+    }
+    ImZoomSlider::ImZoomSlider(0.0f, frameMs, m_ViewStartMs, m_ViewEndMs);
+
+    const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+    const float pixelsPerMs = width / std::max(m_ViewEndMs - m_ViewStartMs, 0.001f);
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+
+    for (const ProfileThread& thread : record.threads) {
+        uint32_t minDepth = UINT32_MAX;
+        uint32_t maxDepth = 0;
+        for (const ProfileEvent& event : thread.events) {
+            minDepth = std::min(minDepth, event.depth);
+            maxDepth = std::max(maxDepth, event.depth);
+        }
+
+        ImGui::TextUnformatted(thread.name.c_str());
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImGui::PushID(static_cast<int>(thread.id));
+        ImGui::InvisibleButton("##Lane", ImVec2(width, static_cast<float>(maxDepth - minDepth + 1) * rowHeight));
+        const bool hovered = ImGui::IsItemHovered();
+        ImGui::PopID();
+
+        for (const ProfileEvent& event : thread.events) {
+            // Scopes that began in the previous frame are clipped to this one
+            float x0 = origin.x + (ToMs(event.startNs - frame.startNs) - m_ViewStartMs) * pixelsPerMs;
+            float x1 = origin.x + (ToMs(event.endNs - frame.startNs) - m_ViewStartMs) * pixelsPerMs;
+            if (x1 < origin.x || x0 > origin.x + width) {
+                continue;
+            }
+            x0 = std::max(x0, origin.x);
+            x1 = std::max(std::min(x1, origin.x + width), x0 + 1.0f);
+            const float y = origin.y + static_cast<float>(event.depth - minDepth) * rowHeight;
+            const ImVec2 min(x0, y);
+            const ImVec2 max(x1, y + rowHeight - 1.0f);
+            DrawBox(drawList, min, max, ScopeColor(event.name), event.name);
+
+            if (hovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y) {
+                ImGui::SetTooltip("%s\n%.3f ms, at %.3f ms", event.name, ToMs(event.endNs - event.startNs),
+                                  ToMs(event.startNs - frame.startNs));
+            }
+        }
+    }
+    if (record.threads.empty()) {
+        ImGui::TextDisabled("No scopes recorded in this frame");
+    }
+    // The renderer issues no timer queries yet
+    ImGui::TextDisabled("GPU scopes are not available on this backend");
+}
+
+void ProfilerPanel::DrawFlameGraph(const ProfileFrameRecord& record) {
+    const ProfileThread* thread = nullptr;
+    for (const ProfileThread& candidate : record.threads) {
+        if (candidate.id == m_FlameThread) {
+            thread = &candidate;
+        }
+    }
+    if (!thread && !record.threads.empty()) {
+        thread = &record.threads.front();
+    }
+
+    ImGui::SetNextItemWidth(200.0f);
+    if (ImGui::BeginCombo("Thread", thread ? thread->name.c_str() : "")) {
+        for (const ProfileThread& candidate : record.threads) {
+            ImGui::PushID(static_cast<int>(candidate.id));
+            if (ImGui::Selectable(candidate.name.c_str(), &candidate == thread)) {
+                m_FlameThread = candidate.id;
+                thread = &candidate;
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndCombo();
+    }
+    if (!thread) {
+        ImGui::TextDisabled("No scopes recorded in this frame");
+        return;
+    }
+
+    if (!m_FlameValid || m_FlameFrame != record.frame.index || m_FlameBuiltThread != thread->id) {
+        BuildFlameGraph(*thread);
+        m_FlameFrame = record.frame.index;
+        m_FlameBuiltThread = thread->id;
+        m_FlameValid = true;
+    }
+    if (m_FlameTotalNs <= 0) {
+        return;
+    }
+
+    const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##Flame", ImVec2(width, static_cast<float>(m_FlameLevels) * rowHeight));
+    const bool hovered = ImGui::IsItemHovered();
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+    const double pixelsPerNs = width / static_cast<double>(m_FlameTotalNs);
+    for (const FlameNode& node : m_FlameNodes) {
+        const float x0 = origin.x + static_cast<float>(static_cast<double>(node.offsetNs) * pixelsPerNs);
+        const float x1 = std::max(x0 + static_cast<float>(static_cast<double>(node.totalNs) * pixelsPerNs), x0 + 1.0f);
+        const float y = origin.y + static_cast<float>(node.level) * rowHeight;
+        const ImVec2 min(x0, y);
+        const ImVec2 max(x1, y + rowHeight - 1.0f);
+        DrawBox(drawList, min, max, ScopeColor(node.name), node.name);
+
+        if (hovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y) {
+            ImGui::SetTooltip("%s\n%.3f ms in %u calls (%.1f%%)", node.name, ToMs(node.totalNs), node.calls,
+                              100.0 * static_cast<double>(node.totalNs) / static_cast<double>(m_FlameTotalNs));
+        }
+    }
+}
+
+void ProfilerPanel::BuildFlameGraph(const ProfileThread& thread) {
+    m_FlameNodes.clear();
+    m_FlameStack.clear();
+    m_FlameLevels = 0;
+
+    // Events are ordered by start with parents first, so the innermost open
+    // scope with a smaller depth is the parent
+    for (const ProfileEvent& event : thread.events) {
+        while (!m_FlameStack.empty() && m_FlameStack.back().first >= event.depth) {
+            m_FlameStack.pop_back();
+        }
+        const size_t parent = m_FlameStack.empty() ? NoParent : m_FlameStack.back().second;
+
+        size_t node = NoParent;
+        for (size_t i = parent == NoParent ? 0 : parent + 1; i < m_FlameNodes.size(); ++i) {
+            if (m_FlameNodes[i].parent == parent && std::strcmp(m_FlameNodes[i].name, event.name) == 0) {
+                node = i;
+                break;
+            }
+        }
+        if (node == NoParent) {
+            node = m_FlameNodes.size();
+            FlameNode& added = m_FlameNodes.emplace_back();
+            added.name = event.name;
+            added.parent = parent;
+            added.level = parent == NoParent ? 0 : m_FlameNodes[parent].level + 1;
+            m_FlameLevels = std::max(m_FlameLevels, added.level + 1);
+        }
+        m_FlameNodes[node].calls++;
+        m_FlameNodes[node].totalNs += event.endNs - event.startNs;
+        m_FlameStack.emplace_back(event.depth, node);
+    }
+
+    // Parents precede their children, so one pass lays children out left to right inside them
+    m_FlameCursor.resize(m_FlameNodes.size());
+    m_FlameTotalNs = 0;
+    for (size_t i = 0; i < m_FlameNodes.size(); ++i) {
+        FlameNode& node = m_FlameNodes[i];
+        int64_t& cursor = node.parent == NoParent ? m_FlameTotalNs : m_FlameCursor[node.parent];
+        node.offsetNs = cursor;
+        cursor += node.totalNs;
+        m_FlameCursor[i] = node.offsetNs;
+    }
+}
+
+}  // namespace Vest
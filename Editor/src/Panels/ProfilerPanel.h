@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Core/Profiler.h"
+
+namespace Vest {
+
+/**
+ * @brief Frame-time history with a timeline and flame graph of a selected frame
+ *
+ * Reads the profiler's rolling history in place. The history records only
+ * while the panel is visible; freezing pauses it, so the frames on screen
+ * stay put without being copied and the scopes being measured are not
+ * touched. Also starts and stops full captures for export to Chrome traces.
+ */
+class ProfilerPanel {
+public:
+    explicit ProfilerPanel(std::string title = "Profiler") : m_Title(std::move(title)) {}
+
+    void OnImGuiRender();
+
+private:
+    // One call path of the selected thread, merged across calls
+    struct FlameNode {
+        const char* name = "";
+        size_t parent = 0;  // NoParent for roots
+        uint32_t level = 0;
+        uint32_t calls = 0;
+        int64_t totalNs = 0;
+        int64_t offsetNs = 0;  // From the left edge; siblings in first-call order
+    };
+
+    static constexpr size_t NoParent = static_cast<size_t>(-1);
+
+    void DrawToolbar();
+    void DrawFrameChart();
+    void DrawTimeline(const ProfileFrameRecord& record);
+    void DrawFlameGraph(const ProfileFrameRecord& record);
+    const ProfileFrameRecord* FindSelectedFrame() const;
+    void BuildFlameGraph(const ProfileThread& thread);
+
+    std::string m_Title;
+    bool m_Frozen = false;
+    bool m_Recording = false;
+    bool m_HasSelection = false;
+    uint64_t m_SelectedFrame = 0;
+    float m_ViewStartMs = 0.0f;
+    float m_ViewEndMs = 0.0f;
+    std::string m_TracePath = "VestEngine.trace.json";
+    std::string m_TraceStatus;
+
+    uint32_t m_FlameThread = 0;
+    std::vector<FlameNode> m_FlameNodes;
+    std::vector<std::pair<uint32_t, size_t>> m_FlameStack;  // Scope depth, node
+    std::vector<int64_t> m_FlameCursor;
+    int64_t m_FlameTotalNs = 0;
+    uint32_t m_FlameLevels = 0;
+    uint64_t m_FlameFrame = 0;
+    uint32_t m_FlameBuiltThread = 0;
+    bool m_FlameValid = false;
+};
+
+}  // namespace Vest
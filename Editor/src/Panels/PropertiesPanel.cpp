@@ -7,22 +7,25 @@ namespace Vest {
 void PropertiesPanel::OnImGuiRender() {
     ImGui::Begin(m_Title.c_str());
 
-    if (!m_SceneObjects || !m_SelectedIndex || *m_SelectedIndex < 0 ||
-        *m_SelectedIndex >= static_cast<int>(m_SceneObjects->size())) {
+    const SceneObject* selected = m_Scene && m_Selection ? m_Scene->TryGet(*m_Selection) : nullptr;
+    if (!selected) {
         ImGui::TextUnformatted("Select an entity from the hierarchy");
         ImGui::End();
         return;
     }
 
-    SceneObject& object = (*m_SceneObjects)[static_cast<size_t>(*m_SelectedIndex)];
+    // Edit a copy and write back only on change, so merely displaying an
+    // entity does not duplicate its storage chunk during Play mode.
+    SceneObject object = *selected;
+    bool changed = false;
 
-    ImGui::Text("Entity: %s", object.name.c_str());
+    ImGui::Text("Entity: %s", object.name.CStr());
     ImGui::Separator();
 
-    ImGui::DragFloat3("Position", &object.position.x, 0.01f);
-    ImGui::DragFloat3("Rotation", &object.rotation.x, 0.1f, -180.0f, 180.0f);
-    ImGui::DragFloat3("Scale", &object.scale.x, 0.01f, 0.1f, 10.0f);
-    ImGui::ColorEdit4("Color", &object.color.x);
+    changed |= ImGui::DragFloat3("Position", &object.position.x, 0.01f);
+    changed |= ImGui::DragFloat3("Rotation", &object.rotation.x, 0.1f, -180.0f, 180.0f);
+    changed |= ImGui::DragFloat3("Scale", &object.scale.x, 0.01f, 0.1f, 10.0f);
+    changed |= ImGui::ColorEdit4("Color", &object.color.x);
 
     const char* meshOptions[] = {"Triangle", "Quad"};
     int meshIndex = static_cast<int>(object.mesh);
@@ -31,13 +34,18 @@ void PropertiesPanel::OnImGuiRender() {
         if (object.mesh != SceneObject::MeshType::Quad) {
             object.textured = false;
         }
+        changed = true;
     }
 
     bool texturedEnabled = object.mesh == SceneObject::MeshType::Quad;
     ImGui::BeginDisabled(!texturedEnabled);
-    ImGui::Checkbox("Textured", &object.textured);
+    changed |= ImGui::Checkbox("Textured", &object.textured);
     ImGui::EndDisabled();
 
+    if (changed) {
+        *m_Scene->TryGetMutable(*m_Selection) = object;
+    }
+
     ImGui::End();
 }
 
@@ -6,7 +6,7 @@
 
 #include <glm/glm.hpp>
 
-#include <Scene/SceneObject.h>
+#include <Scene/Scene.h>
 
 namespace Vest {
 
@@ -14,17 +14,17 @@ class PropertiesPanel {
 public:
     explicit PropertiesPanel(std::string title = "Properties") : m_Title(std::move(title)) {}
 
-    void SetSceneContext(std::vector<SceneObject>* objects, int* selectedIndex) {
-        m_SceneObjects = objects;
-        m_SelectedIndex = selectedIndex;
+    void SetSceneContext(Scene* scene, EntityHandle* selection) {
+        m_Scene = scene;
+        m_Selection = selection;
     }
 
     void OnImGuiRender();
 
 private:
     std::string m_Title;
-    std::vector<SceneObject>* m_SceneObjects = nullptr;
-    int* m_SelectedIndex = nullptr;
+    Scene* m_Scene = nullptr;
+    EntityHandle* m_Selection = nullptr;
 };
 
 }  // namespace Vest
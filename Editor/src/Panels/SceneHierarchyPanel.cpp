@@ -2,45 +2,115 @@
 
 #include <imgui.h>
 
+#include "Commands/CommandManager.h"
+#include "Commands/EntityCommands.h"
+
 namespace Vest {
 
+static constexpr const char* ENTITY_PAYLOAD = "VEST_ENTITY";
+
 SceneHierarchyPanel::SceneHierarchyPanel(std::string title) : m_Title(std::move(title)) {}
 
-void SceneHierarchyPanel::SetSceneContext(std::vector<SceneObject>* objects, int* selectedIndex) {
-    m_SceneObjects = objects;
-    m_SelectedIndex = selectedIndex;
+void SceneHierarchyPanel::SetSceneContext(Scene* scene, EntityHandle* selection, CommandManager* commands) {
+    m_Scene = scene;
+    m_Selection = selection;
+    m_Commands = commands;
 }
 
 void SceneHierarchyPanel::OnImGuiRender() {
     ImGui::Begin(m_Title.c_str());
 
-    if (!m_SceneObjects || m_SceneObjects->empty()) {
+    if (!m_Scene || m_Scene->Empty()) {
         ImGui::TextUnformatted("No entities in scene");
     } else {
-        for (int i = 0; i < static_cast<int>(m_SceneObjects->size()); ++i) {
-            DrawEntityNode(i, (*m_SceneObjects)[static_cast<size_t>(i)]);
+        m_Scene->UpdateTransforms();
+
+        // Subtrees are contiguous in hierarchy order, so each root node
+        // consumes its whole range and the next position is the next root.
+        size_t position = 0;
+        while (position < m_Scene->GetHierarchySize()) {
+            position = DrawEntityNode(position);
+        }
+
+        // Dropping onto the empty area below the tree detaches to the root
+        ImVec2 available = ImGui::GetContentRegionAvail();
+        ImGui::Dummy(ImVec2(available.x, available.y > 20.0f ? available.y : 20.0f));
+        if (ImGui::BeginDragDropTarget()) {
+            if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(ENTITY_PAYLOAD)) {
+                Reparent(*static_cast<const EntityHandle*>(payload->Data), EntityHandle());
+            }
+            ImGui::EndDragDropTarget();
         }
     }
 
     ImGui::End();
 }
 
-void SceneHierarchyPanel::DrawEntityNode(int index, SceneObject& object) {
+size_t SceneHierarchyPanel::DrawEntityNode(size_t position) {
+    const EntityHandle entity = m_Scene->GetHierarchyHandleAt(position);
+    const size_t subtreeEnd = m_Scene->GetSubtreeEndAt(position);
+    const SceneObject* object = m_Scene->TryGet(entity);
+    if (!object) {
+        // Destroyed earlier this frame; the layout refreshes next frame
+        return subtreeEnd;
+    }
+
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
-    if (m_SelectedIndex && *m_SelectedIndex == index) {
+    if (subtreeEnd == position + 1) {
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    }
+    if (m_Selection && *m_Selection == entity) {
         flags |= ImGuiTreeNodeFlags_Selected;
     }
 
-    bool opened = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<intptr_t>(index)), flags, "%s", object.name.c_str());
+    // The handle is stable across removals, so it doubles as the ImGui ID.
+    bool opened = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<intptr_t>(entity.value)), flags, "%s", object->name.CStr());
     if (ImGui::IsItemClicked()) {
-        if (m_SelectedIndex) {
-            *m_SelectedIndex = index;
+        if (m_Selection) {
+            *m_Selection = entity;
         }
     }
 
+    if (ImGui::BeginDragDropSource()) {
+        ImGui::SetDragDropPayload(ENTITY_PAYLOAD, &entity, sizeof(EntityHandle));
+        ImGui::Text("%s", object->name.CStr());
+        ImGui::EndDragDropSource();
+    }
+    if (ImGui::BeginDragDropTarget()) {
+        if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(ENTITY_PAYLOAD)) {
+            Reparent(*static_cast<const EntityHandle*>(payload->Data), entity);
+        }
+        ImGui::EndDragDropTarget();
+    }
+
+    if (ImGui::BeginPopupContextItem()) {
+        if (ImGui::MenuItem("Unparent", nullptr, false, !m_Scene->GetParent(entity).IsNull())) {
+            Reparent(entity, EntityHandle());
+        }
+        ImGui::EndPopup();
+    }
+
     if (opened) {
+        size_t child = position + 1;
+        while (child < subtreeEnd) {
+            child = DrawEntityNode(child);
+        }
         ImGui::TreePop();
     }
+    return subtreeEnd;
+}
+
+void SceneHierarchyPanel::Reparent(EntityHandle entity, EntityHandle parent) {
+    if (entity == parent || m_Scene->GetParent(entity) == parent) {
+        return;
+    }
+    // The layout being drawn is immutable until the next UpdateTransforms,
+    // so changing the hierarchy mid-iteration is safe.
+    if (m_Commands) {
+        m_Commands->ExecuteCommand(MakeCommand<SetParentCommand>(m_Scene, entity, parent));
+    } else {
+        m_Scene->SetParent(entity, parent);
+    }
 }
 
 }  // namespace Vest
@@ -4,23 +4,31 @@
 #include <vector>
 #include <utility>
 
-#include <Scene/SceneObject.h>
+#include <Scene/Scene.h>
 
 namespace Vest {
 
+class CommandManager;
+
 class SceneHierarchyPanel {
 public:
     explicit SceneHierarchyPanel(std::string title = "Scene Hierarchy");
 
-    void SetSceneContext(std::vector<SceneObject>* objects, int* selectedIndex);
+    void SetSceneContext(Scene* scene, EntityHandle* selection, CommandManager* commands = nullptr);
     void OnImGuiRender();
 
 private:
-    void DrawEntityNode(int index, SceneObject& object);
+    /**
+     * @brief Draw the node at a hierarchy position and its subtree
+     * @return Position just past the subtree
+     */
+    size_t DrawEntityNode(size_t position);
+    void Reparent(EntityHandle entity, EntityHandle parent);
 
     std::string m_Title;
-    std::vector<SceneObject>* m_SceneObjects = nullptr;
-    int* m_SelectedIndex = nullptr;
+    Scene* m_Scene = nullptr;
+    EntityHandle* m_Selection = nullptr;
+    CommandManager* m_Commands = nullptr;
 };
 
 }  // namespace Vest
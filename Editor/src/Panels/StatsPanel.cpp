@@ -1,14 +1,297 @@
 #include "Panels/StatsPanel.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+
 #include <imgui.h>
 
+#include "Commands/CommandManager.h"
+#include "Core/FrameAllocator.h"
+#include "Core/FrameStats.h"
+#include "Core/MemoryTracker.h"
+#include "Rendering/GPUResourceRegistry.h"
+
 namespace Vest {
 
+namespace {
+
+constexpr float GraphHeight = 60.0f;
+
+struct MetricRow {
+    const char* label;
+    FrameMetric metric;
+    ImU32 color;
+};
+
+constexpr MetricRow MetricRows[] = {
+    {"Frame", FrameMetric::Frame, IM_COL32(200, 200, 200, 255)},
+    {"Update", FrameMetric::Update, IM_COL32(80, 140, 220, 255)},
+    {"ImGui", FrameMetric::ImGui, IM_COL32(170, 100, 210, 255)},
+    {"Present", FrameMetric::Present, IM_COL32(110, 110, 110, 255)},
+};
+
+}  // namespace
+
 void StatsPanel::OnImGuiRender() {
     ImGui::Begin(m_Title.c_str());
-    ImGui::Text("FPS: %.2f", m_FPS);
-    ImGui::Text("Draw Calls: %u", m_DrawCalls);
+    if (m_FrameStats) {
+        DrawFrameTimes();
+    }
+
+    ImGui::Separator();
+    if (m_ViewportCached) {
+        ImGui::Text("Draw Calls: 0 (viewport cached, %u when drawn)", m_DrawCalls);
+    } else {
+        ImGui::Text("Draw Calls: %u", m_DrawCalls);
+    }
+
+    ImGui::Separator();
+    DrawMemory();
+    ImGui::Text("Frame Arena: %.1f / %.1f KB",
+                FrameAllocator::GetBytesUsed() / 1024.0, FrameAllocator::GetBytesReserved() / 1024.0);
+
+    ImGui::Separator();
+    DrawGPUResources();
+
+    if (m_Commands) {
+        ImGui::Separator();
+        const size_t used = m_Commands->GetMemoryUsage();
+        const size_t budget = m_Commands->GetMemoryBudget();
+        ImGui::Text("Undo History: %zu undo / %zu redo steps",
+                    m_Commands->GetUndoStackSize(), m_Commands->GetRedoStackSize());
+        char overlay[64];
+        std::snprintf(overlay, sizeof(overlay), "%.1f / %.1f KB", used / 1024.0, budget / 1024.0);
+        ImGui::ProgressBar(budget > 0 ? static_cast<float>(used) / static_cast<float>(budget) : 0.0f,
+                           ImVec2(-1.0f, 0.0f), overlay);
+        if (m_Commands->IsSpillingEnabled()) {
+            ImGui::Text("Spilled: %zu steps, %.1f KB on disk", m_Commands->GetSpilledCommandCount(),
+                        m_Commands->GetSpillFileSize() / 1024.0);
+        }
+    }
     ImGui::End();
 }
 
+void StatsPanel::DrawFrameTimes() {
+    const FrameStats& stats = *m_FrameStats;
+    const FrameMetricSummary frame = stats.Summarize(FrameMetric::Frame);
+    ImGui::Text("FPS: %.1f (mean of %zu frames)", frame.meanMs > 0.0 ? 1000.0 / frame.meanMs : 0.0,
+                stats.GetCount());
+    if (stats.GetCount() > 0) {
+        const FrameTiming& last = stats.GetSample(stats.GetCount() - 1);
+        ImGui::Text("Last Frame: %.2f ms (CPU %.2f ms, wait %.2f ms)", last.frameMs, last.cpuMs, last.waitMs);
+    }
+
+    if (ImGui::BeginTable("Frame Times", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("ms");
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableSetupColumn("P50");
+        ImGui::TableSetupColumn("P95");
+        ImGui::TableSetupColumn("P99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableHeadersRow();
+        for (const MetricRow& row : MetricRows) {
+            const FrameMetricSummary summary = row.metric == FrameMetric::Frame ? frame : stats.Summarize(row.metric);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(row.color), "%s", row.label);
+            for (double value : {summary.meanMs, summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.maxMs}) {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", value);
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    DrawFrameGraph();
+    ImGui::Text("Spikes: %zu over the %.2f ms budget", stats.GetSpikeCount(), stats.GetBudgetMs());
+
+    if (m_FrameStats->IsRecording()) {
+        if (ImGui::Button("Stop Recording")) {
+            m_FrameStats->StopRecording();
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu frames", m_FrameStats->GetRecording().size());
+    } else {
+        if (ImGui::Button("Record Session")) {
+            m_FrameStats->StartRecording();
+            m_CsvStatus.clear();
+        }
+        if (!m_FrameStats->GetRecording().empty()) {
+            ImGui::SameLine();
+            if (ImGui::Button("Export CSV")) {
+                m_CsvStatus = m_FrameStats->ExportCsv(m_CsvPath)
+                                  ? "Wrote " + std::to_string(m_FrameStats->GetRecording().size()) + " frames to " +
+                                        m_CsvPath
+                                  : "Export failed, see log";
+            }
+        }
+    }
+    if (!m_CsvStatus.empty()) {
+        ImGui::TextDisabled("%s", m_CsvStatus.c_str());
+    }
+}
+
+void StatsPanel::DrawMemory() {
+    if (!MemoryTracker::IsEnabled()) {
+        ImGui::TextDisabled("Heap Allocations: tracking disabled (VEST_ENABLE_MEMORY_TRACKING=OFF)");
+        return;
+    }
+    ImGui::Text("Heap Allocations: %llu / frame",
+                static_cast<unsigned long long>(FrameAllocator::GetLastFrameHeapAllocations()));
+
+    if (ImGui::BeginTable("Memory", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn("Current KB");
+        ImGui::TableSetupColumn("Peak KB");
+        ImGui::TableSetupColumn("Allocs/Frame");
+        ImGui::TableSetupColumn("KB/Frame");
+        ImGui::TableHeadersRow();
+        auto drawRow = [](const char* name, const MemoryTagStats& stats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.currentBytes / 1024.0);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.peakBytes / 1024.0);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.frameAllocations));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", stats.frameBytes / 1024.0);
+        };
+        for (size_t i = 0; i < MemoryTracker::TagCount; ++i) {
+            const MemoryTag tag = static_cast<MemoryTag>(i);
+            drawRow(MemoryTracker::GetTagName(tag), MemoryTracker::GetStats(tag));
+        }
+        drawRow("Total", MemoryTracker::GetTotal());
+        ImGui::EndTable();
+    }
+
+    if (ImGui::Button("Export Memory CSV")) {
+        m_MemoryCsvStatus = MemoryTracker::ExportCsv(m_MemoryCsvPath) ? "Wrote " + m_MemoryCsvPath
+                                                                       : "Export failed, see log";
+    }
+    if (!m_MemoryCsvStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("%s", m_MemoryCsvStatus.c_str());
+    }
+}
+
+void StatsPanel::DrawGPUResources() {
+    const GPUResourceTotals total = GPUResourceRegistry::GetTotal();
+    ImGui::Text("GPU Memory: %.2f MB in %zu resources", total.bytes / (1024.0 * 1024.0), total.count);
+
+    if (ImGui::BeginTable("GPU Resources", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("Type");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("KB");
+        ImGui::TableHeadersRow();
+        for (size_t i = 0; i < GPUResourceRegistry::TypeCount; ++i) {
+            const GPUResourceType type = static_cast<GPUResourceType>(i);
+            const GPUResourceTotals totals = GPUResourceRegistry::GetTotals(type);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(GPUResourceRegistry::GetTypeName(type));
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", totals.count);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", totals.bytes / 1024.0);
+        }
+        ImGui::EndTable();
+    }
+
+    // 0 disables the budget
+    int budgetMB = static_cast<int>(GPUResourceRegistry::GetBudget() / (1024 * 1024));
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::InputInt("Budget (MB)", &budgetMB, 64, 256)) {
+        GPUResourceRegistry::SetBudget(static_cast<uint64_t>(std::max(budgetMB, 0)) * 1024 * 1024);
+    }
+    if (const uint64_t budget = GPUResourceRegistry::GetBudget(); budget > 0) {
+        const bool over = GPUResourceRegistry::IsOverBudget();
+        if (over) {
+            ImGui::PushStyleColor(ImGuiCol_PlotHistogram, IM_COL32(230, 60, 50, 255));
+        }
+        ImGui::ProgressBar(std::min(static_cast<float>(total.bytes) / static_cast<float>(budget), 1.0f),
+                           ImVec2(-1.0f, 0.0f), over ? "Over budget" : nullptr);
+        if (over) {
+            ImGui::PopStyleColor();
+        }
+    }
+
+    if (ImGui::TreeNode("Live GPU Resources")) {
+        if (ImGui::BeginTable("Live GPU Resources", 4,
+                              ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY,
+                              ImVec2(0.0f, 200.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Name");
+            ImGui::TableSetupColumn("Type");
+            ImGui::TableSetupColumn("KB");
+            ImGui::TableSetupColumn("Created At");
+            ImGui::TableHeadersRow();
+            for (const GPUResourceInfo& info : GPUResourceRegistry::GetResources()) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(info.name.c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(GPUResourceRegistry::GetTypeName(info.type));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", info.bytes / 1024.0);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(info.site.c_str());
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+}
+
+void StatsPanel::DrawFrameGraph() {
+    const FrameStats& stats = *m_FrameStats;
+    const size_t count = stats.GetCount();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+    ImGui::InvisibleButton("##Frame Graph", ImVec2(width, GraphHeight));
+    const bool hovered = ImGui::IsItemHovered();
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const float bottom = origin.y + GraphHeight;
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, bottom), ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+    double maxMs = 2.0 * stats.GetBudgetMs();
+    for (size_t i = 0; i < count; ++i) {
+        maxMs = std::max(maxMs, stats.GetSample(i).frameMs);
+    }
+    const float scale = GraphHeight / static_cast<float>(maxMs);
+    const float barWidth = width / static_cast<float>(stats.GetCapacity());
+
+    // Update, ImGui and present stacked from the bottom; spikes get a red cap
+    for (size_t i = 0; i < count; ++i) {
+        const FrameTiming& timing = stats.GetSample(i);
+        const float x0 = origin.x + static_cast<float>(i) * barWidth;
+        const float x1 = x0 + std::max(barWidth - 1.0f, 1.0f);
+        float y = bottom;
+        for (size_t row = 1; row < std::size(MetricRows); ++row) {
+            const float height = static_cast<float>(FrameStats::GetValue(timing, MetricRows[row].metric)) * scale;
+            drawList->AddRectFilled(ImVec2(x0, y - height), ImVec2(x1, y), MetricRows[row].color);
+            y -= height;
+        }
+        if (stats.IsSpike(timing)) {
+            drawList->AddRectFilled(ImVec2(x0, origin.y), ImVec2(x1, origin.y + 3.0f), IM_COL32(230, 60, 50, 255));
+        }
+    }
+    const float budgetY = bottom - static_cast<float>(stats.GetBudgetMs()) * scale;
+    drawList->AddLine(ImVec2(origin.x, budgetY), ImVec2(origin.x + width, budgetY), IM_COL32(255, 255, 255, 80));
+
+    if (hovered && barWidth > 0.0f) {
+        const size_t index = static_cast<size_t>((ImGui::GetIO().MousePos.x - origin.x) / barWidth);
+        if (index < count) {
+            const FrameTiming& timing = stats.GetSample(index);
+            ImGui::SetTooltip("%.2f ms%s\nUpdate %.2f ms\nImGui %.2f ms\nPresent %.2f ms", timing.frameMs,
+                              stats.IsSpike(timing) ? " (over budget)" : "", timing.updateMs, timing.imguiMs,
+                              timing.presentMs);
+        }
+    }
+}
+
 }  // namespace Vest
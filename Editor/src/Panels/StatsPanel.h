@@ -5,21 +5,40 @@
 
 namespace Vest {
 
+class CommandManager;
+class FrameStats;
+
 class StatsPanel {
 public:
     explicit StatsPanel(std::string title = "Stats") : m_Title(std::move(title)) {}
 
-    void Update(float fps, uint32_t drawCalls) {
-        m_FPS = fps;
-        m_DrawCalls = drawCalls;
-    }
+    void Update(uint32_t drawCalls) { m_DrawCalls = drawCalls; }
+
+    /**
+     * @brief Whether this frame reused the previous viewport image instead of rendering
+     */
+    void SetViewportCached(bool cached) { m_ViewportCached = cached; }
+
+    void SetCommandHistory(const CommandManager* commands) { m_Commands = commands; }
+    void SetFrameStats(FrameStats* stats) { m_FrameStats = stats; }
 
     void OnImGuiRender();
 
 private:
+    void DrawFrameTimes();
+    void DrawFrameGraph();
+    void DrawMemory();
+    void DrawGPUResources();
+
     std::string m_Title;
-    float m_FPS = 0.0f;
     uint32_t m_DrawCalls = 0;
+    bool m_ViewportCached = false;
+    const CommandManager* m_Commands = nullptr;
+    FrameStats* m_FrameStats = nullptr;
+    std::string m_CsvPath = "VestEngine.frames.csv";
+    std::string m_CsvStatus;
+    std::string m_MemoryCsvPath = "VestEngine.memory.csv";
+    std::string m_MemoryCsvStatus;
 };
 
 }  // namespace Vest
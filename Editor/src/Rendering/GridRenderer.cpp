@@ -1,4 +1,6 @@
 #include "GridRenderer.h"
+#include "Core/FrameAllocator.h"
+#include "Core/MemoryTracker.h"
 #include "Rendering/Buffer.h"
 #include "Rendering/RenderCommand.h"
 #include <cmath>
@@ -103,6 +105,7 @@ void GridRenderer::UpdateGridGeometry(const glm::vec3& cameraPosition,
                                        float visibleWidth,
                                        float visibleHeight,
                                        float actualSpacing) {
+    VEST_MEMORY_TAG(Rendering);
     m_GridVertices.clear();
     m_GridColors.clear();
     
@@ -200,7 +203,7 @@ void GridRenderer::RenderGrid(const glm::mat4& viewProjectionMatrix,
         
         // Update vertex buffer
         if (!m_GridVertices.empty()) {
-            std::vector<float> interleavedData;
+            FrameVector<float> interleavedData(FrameAllocator::GetResource());
             interleavedData.reserve(m_GridVertices.size() / 3 * 7); // 3 pos + 4 color
             
             for (size_t i = 0; i < m_GridVertices.size() / 3; ++i) {
@@ -8,11 +8,19 @@ SelectionRenderer::SelectionRenderer()
 }
 
 void SelectionRenderer::Update(float deltaTime) {
-    if (m_Style.animateSelection) {
+    if (IsPulseActive()) {
         m_AnimationTime += deltaTime * m_Style.pulseSpeed;
     }
 }
 
+void SelectionRenderer::SetPulseActive(bool active) {
+    if (!active) {
+        // Restart from the base color, sin(0), so resuming does not jump
+        m_AnimationTime = 0.0f;
+    }
+    m_PulseActive = active;
+}
+
 ImU32 SelectionRenderer::GetColor(SelectionState state, float alpha) const {
     glm::vec4 color;
     
@@ -27,7 +35,7 @@ ImU32 SelectionRenderer::GetColor(SelectionState state, float alpha) const {
         case SelectionState::Selected: {
             color = m_Style.selectedColor;
             // Animate pulse
-            if (m_Style.animateSelection) {
+            if (IsPulseActive()) {
                 float pulse = std::sin(m_AnimationTime) * m_Style.pulseAmount;
                 color.w = glm::clamp(color.w + pulse, 0.5f, 1.0f);
             }
@@ -36,6 +36,15 @@ public:
     ~SelectionRenderer() = default;
 
     void Update(float deltaTime);
+
+    /**
+     * @brief Run the selection pulse; while paused the outline is drawn at its base color
+     *
+     * The pulse needs a frame every frame, so callers pause it whenever
+     * nobody is looking to let the editor idle.
+     */
+    void SetPulseActive(bool active);
+    bool IsPulseActive() const { return m_Style.animateSelection && m_PulseActive; }
     
     // Dibuja outline en el viewport usando ImGui
     void DrawOutline(ImDrawList* drawList, 
@@ -61,6 +70,7 @@ public:
 private:
     SelectionStyle m_Style;
     float m_AnimationTime = 0.0f;
+    bool m_PulseActive = true;
     
     ImU32 GetColor(SelectionState state, float alpha = 1.0f) const;
     float GetThickness(SelectionState state) const;
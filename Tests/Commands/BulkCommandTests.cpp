@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include "Commands/BuiltinCommands.h"
+#include "Commands/BulkCommands.h"
+#include "Commands/CommandManager.h"
+#include "CommandTestUtils.h"
+#include "Scene/Scene.h"
+
+#include <vector>
+
+namespace Vest {
+
+class BulkCommandTests : public ::testing::Test {
+protected:
+    static constexpr int EntityCount = 10000;
+
+    Scene scene;
+    std::vector<EntityHandle> entities;
+
+    void SetUp() override {
+        RegisterBuiltinCommands();
+
+        for (int i = 0; i < EntityCount; ++i) {
+            SceneObject object;
+            object.name = "Bulk " + std::to_string(i);
+            object.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+            entities.push_back(scene.CreateEntity(object));
+        }
+    }
+
+    std::vector<glm::vec3> GetPositions(const std::vector<EntityHandle>& handles) const {
+        std::vector<glm::vec3> positions;
+        for (EntityHandle handle : handles) {
+            positions.push_back(scene.TryGet(handle)->position);
+        }
+        return positions;
+    }
+};
+
+TEST_F(BulkCommandTests, PayloadIsSortedAndDeduplicated) {
+    std::vector<EntityHandle> handles = {entities[5], entities[2], entities[5], entities[9]};
+    std::vector<glm::vec3> values = {glm::vec3(5.0f), glm::vec3(2.0f), glm::vec3(-1.0f), glm::vec3(9.0f)};
+    SortBulkPayload(handles, values);
+
+    ASSERT_EQ(handles.size(), 3u);
+    EXPECT_EQ(handles[0], entities[2]);
+    EXPECT_EQ(handles[1], entities[5]);
+    EXPECT_EQ(handles[2], entities[9]);
+    EXPECT_EQ(values[1], glm::vec3(5.0f));  // First value wins
+}
+
+TEST_F(BulkCommandTests, TransformAppliesAndUndoesAsOneStep) {
+    const std::vector<glm::vec3> before = GetPositions(entities);
+    std::vector<glm::vec3> after;
+    for (const glm::vec3& position : before) {
+        after.push_back(position + glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+
+    CommandManager manager;
+    auto move = MakeCommand<BulkTransformCommand>(&scene, TransformCommand::Type::Position, entities, before, after);
+    EXPECT_EQ(move->GetName(), "Move 10000 Entities");
+    ASSERT_TRUE(manager.ExecuteCommand(std::move(move)));
+    EXPECT_EQ(manager.GetUndoStackSize(), 1u);
+    EXPECT_EQ(GetPositions(entities), after);
+
+    ASSERT_TRUE(manager.Undo());
+    EXPECT_EQ(GetPositions(entities), before);
+    ASSERT_TRUE(manager.Redo());
+    EXPECT_EQ(GetPositions(entities), after);
+}
+
+TEST_F(BulkCommandTests, TransformsOfSameSelectionMerge) {
+    const std::vector<EntityHandle> selection = {entities[3], entities[1]};
+    const std::vector<glm::vec3> start = GetPositions(selection);
+
+    CommandManager manager;
+    for (int step = 1; step <= 3; ++step) {
+        std::vector<glm::vec3> from = GetPositions(selection);
+        std::vector<glm::vec3> to(selection.size(), glm::vec3(static_cast<float>(step)));
+        manager.ExecuteCommand(
+            MakeCommand<BulkTransformCommand>(&scene, TransformCommand::Type::Position, selection, from, to));
+    }
+    EXPECT_EQ(manager.GetUndoStackSize(), 1u);
+    EXPECT_EQ(scene.TryGet(entities[1])->position, glm::vec3(3.0f));
+
+    ASSERT_TRUE(manager.Undo());
+    EXPECT_EQ(GetPositions(selection), start);
+}
+
+TEST_F(BulkCommandTests, SetColorCapturesPreviousColors) {
+    scene.TryGetMutable(entities[0])->color = glm::vec4(0.5f);
+    const std::vector<EntityHandle> selection = {entities[0], entities[1]};
+
+    auto recolor = MakeCommand<BulkSetColorCommand>(&scene, selection, glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    ASSERT_TRUE(recolor->Execute());
+    EXPECT_EQ(scene.TryGet(entities[0])->color, glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(scene.TryGet(entities[1])->color, glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+
+    ASSERT_TRUE(recolor->Undo());
+    EXPECT_EQ(scene.TryGet(entities[0])->color, glm::vec4(0.5f));
+    EXPECT_EQ(scene.TryGet(entities[1])->color, glm::vec4(1.0f));
+}
+
+TEST_F(BulkCommandTests, DeleteAndRestoreEveryOtherEntity) {
+    std::vector<EntityHandle> doomed;
+    for (int i = 0; i < EntityCount; i += 2) {
+        doomed.push_back(entities[i]);
+    }
+
+    CommandManager manager;
+    ASSERT_TRUE(manager.ExecuteCommand(MakeCommand<BulkDeleteCommand>(&scene, doomed)));
+    EXPECT_EQ(scene.Size(), static_cast<size_t>(EntityCount / 2));
+    EXPECT_FALSE(scene.IsValid(entities[0]));
+    EXPECT_TRUE(scene.IsValid(entities[1]));
+
+    ASSERT_TRUE(manager.Undo());
+    EXPECT_EQ(scene.Size(), static_cast<size_t>(EntityCount));
+    for (int i = 0; i < EntityCount; ++i) {
+        ASSERT_TRUE(scene.IsValid(entities[i]));
+        EXPECT_EQ(scene.TryGet(entities[i])->position.x, static_cast<float>(i));
+    }
+    EXPECT_EQ(scene.FindEntityByName("Bulk 42"), entities[42]);
+
+    ASSERT_TRUE(manager.Redo());
+    EXPECT_EQ(scene.Size(), static_cast<size_t>(EntityCount / 2));
+}
+
+TEST_F(BulkCommandTests, CreateRevivesSameHandlesOnRedo) {
+    std::vector<SceneObject> objects(3);
+    objects[0].name = "New A";
+    objects[1].name = "New B";
+    objects[2].name = "New C";
+
+    auto cmd = MakeCommand<BulkCreateCommand>(&scene, objects);
+    BulkCreateCommand* create = cmd.get();
+    CommandManager manager;
+    ASSERT_TRUE(manager.ExecuteCommand(std::move(cmd)));
+    const std::vector<EntityHandle> created = create->GetCreatedEntities();
+    ASSERT_EQ(created.size(), 3u);
+    EXPECT_EQ(scene.TryGet(created[1])->name, "New B");
+
+    ASSERT_TRUE(manager.Undo());
+    EXPECT_EQ(scene.Size(), static_cast<size_t>(EntityCount));
+    EXPECT_FALSE(scene.IsValid(created[0]));
+
+    ASSERT_TRUE(manager.Redo());
+    EXPECT_EQ(create->GetCreatedEntities(), created);
+    EXPECT_EQ(scene.TryGet(created[2])->name, "New C");
+}
+
+TEST_F(BulkCommandTests, CommandsRoundTripThroughRegistry) {
+    const std::vector<EntityHandle> selection = {entities[7], entities[8]};
+
+    auto move = MakeCommand<BulkTransformCommand>(&scene, TransformCommand::Type::Scale, selection,
+                                                  std::vector<glm::vec3>(2, glm::vec3(1.0f)),
+                                                  std::vector<glm::vec3>(2, glm::vec3(4.0f)));
+    CommandPtr moveCopy = RoundTrip(*move);
+    ASSERT_TRUE(moveCopy);
+    EXPECT_EQ(moveCopy->GetName(), "Scale 2 Entities");
+    EXPECT_TRUE(moveCopy->Execute());
+    EXPECT_EQ(scene.TryGet(entities[8])->scale, glm::vec3(4.0f));
+
+    auto recolor = MakeCommand<BulkSetColorCommand>(&scene, selection, glm::vec4(0.25f));
+    CommandPtr recolorCopy = RoundTrip(*recolor);
+    ASSERT_TRUE(recolorCopy);
+    EXPECT_TRUE(recolorCopy->Execute());
+    EXPECT_EQ(scene.TryGet(entities[7])->color, glm::vec4(0.25f));
+
+    auto remove = MakeCommand<BulkDeleteCommand>(&scene, selection);
+    ASSERT_TRUE(remove->Execute());
+    CommandPtr removeCopy = RoundTrip(*remove);
+    ASSERT_TRUE(removeCopy);
+    EXPECT_TRUE(removeCopy->Undo());
+    EXPECT_EQ(scene.TryGet(entities[7])->name, "Bulk 7");
+
+    auto create = MakeCommand<BulkCreateCommand>(&scene, std::vector<SceneObject>(2));
+    ASSERT_TRUE(create->Execute());
+    CommandPtr createCopy = RoundTrip(*create);
+    ASSERT_TRUE(createCopy);
+    EXPECT_TRUE(createCopy->Undo());  // Knows the handles the original created
+    EXPECT_FALSE(scene.IsValid(create->GetCreatedEntities()[0]));
+}
+
+TEST_F(BulkCommandTests, MemoryFootprintCoversPayload) {
+    auto remove = MakeCommand<BulkDeleteCommand>(&scene, entities);
+    EXPECT_GE(remove->GetMemoryFootprint(),
+              entities.size() * (sizeof(EntityHandle) + sizeof(SceneObject)));
+}
+
+}  // namespace Vest
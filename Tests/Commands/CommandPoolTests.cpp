@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "Commands/BuiltinCommands.h"
+#include "Commands/CommandManager.h"
+#include "Commands/CommandPool.h"
+#include "Commands/TransformCommand.h"
+#include "Commands/EntityCommands.h"
+#include "Core/FrameAllocator.h"
+#include "Core/Log.h"
+#include "Core/ObjectPool.h"
+#include "Scene/Scene.h"
+
+#include <chrono>
+
+namespace Vest {
+
+class CommandPoolTests : public ::testing::Test {
+protected:
+    Scene scene;
+    EntityHandle entity;
+
+    void SetUp() override {
+        RegisterBuiltinCommands();
+
+        SceneObject object;
+        object.name = "Pooled";
+        entity = scene.CreateEntity(object);
+    }
+
+    CommandPtr MakeMove(float from, float to) {
+        return MakeCommand<TransformCommand>(&scene, entity, TransformCommand::Type::Position,
+                                             glm::vec3(from), glm::vec3(to));
+    }
+};
+
+TEST_F(CommandPoolTests, ObjectPoolReusesFreedSlots) {
+    ObjectPool<int, 4> pool;
+    int* a = pool.Create(1);
+    int* b = pool.Create(2);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+    EXPECT_EQ(pool.GetCapacity(), 4u);
+
+    pool.Destroy(a);
+    int* c = pool.Create(3);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(*b, 2);
+    EXPECT_EQ(*c, 3);
+
+    // Spills into a second slab
+    int* more[4];
+    for (int i = 0; i < 4; ++i) {
+        more[i] = pool.Create(i);
+    }
+    EXPECT_EQ(pool.GetSlabCount(), 2u);
+
+    for (int* value : more) {
+        pool.Destroy(value);
+    }
+    pool.Destroy(b);
+    pool.Destroy(c);
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST_F(CommandPoolTests, CommandsReturnToPoolWhenReleased) {
+    auto& pool = GetCommandPool<TransformCommand>();
+    const size_t live = pool.GetLiveCount();
+    {
+        CommandPtr command = MakeMove(0.0f, 1.0f);
+        EXPECT_EQ(pool.GetLiveCount(), live + 1);
+    }
+    EXPECT_EQ(pool.GetLiveCount(), live);
+}
+
+TEST_F(CommandPoolTests, HeapCommandsAreStillAccepted) {
+    CommandManager manager;
+    EXPECT_TRUE(manager.ExecuteCommand(CreateScope<ModifyColorCommand>(&scene, entity, glm::vec4(1.0f),
+                                                                       glm::vec4(0.5f))));
+    EXPECT_TRUE(manager.Undo());
+    EXPECT_TRUE(manager.Redo());
+    EXPECT_EQ(scene.TryGet(entity)->color, glm::vec4(0.5f));
+}
+
+TEST_F(CommandPoolTests, HistoryRingKeepsNewestCommands) {
+    CommandManager manager;
+    manager.SetMaxHistorySize(20);
+    auto& pool = GetCommandPool<CreateEntityCommand>();
+    const size_t live = pool.GetLiveCount();
+
+    SceneObject object;
+    for (int i = 0; i < 50; ++i) {
+        object.position.x = static_cast<float>(i);
+        manager.ExecuteCommand(MakeCommand<CreateEntityCommand>(&scene, object));
+    }
+    EXPECT_EQ(manager.GetUndoStackSize(), 20u);
+    EXPECT_EQ(pool.GetLiveCount(), live + 20);  // Trimmed commands went back to the pool
+
+    // Undo walks back through the newest 20 in order
+    for (int i = 49; i >= 30; --i) {
+        ASSERT_TRUE(manager.Undo());
+        EXPECT_EQ(scene.Size(), static_cast<size_t>(i + 1));  // Original entity + i remaining
+    }
+    EXPECT_FALSE(manager.Undo());
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(manager.Redo());
+    }
+    EXPECT_EQ(scene.Size(), 51u);
+
+    manager.SetMaxHistorySize(5);
+    EXPECT_EQ(manager.GetUndoStackSize(), 5u);
+    manager.Clear();
+    EXPECT_EQ(pool.GetLiveCount(), live);
+}
+
+TEST_F(CommandPoolTests, MillionMergedTransformsKeepMemoryStable) {
+    constexpr int CommandCount = 1000000;
+    CommandManager manager;
+    auto& pool = GetCommandPool<TransformCommand>();
+
+    // Two trace lines per command would dominate the measurement
+    const auto logLevel = Log::GetCoreLogger()->level();
+    Log::GetCoreLogger()->set_level(spdlog::level::warn);
+
+    // Warm up so the pool and the undo ring have their working set
+    manager.RegisterExecutedCommand(MakeMove(0.0f, 0.0f));
+    const size_t capacity = pool.GetCapacity();
+    const size_t live = pool.GetLiveCount();
+    const uint64_t heapBefore = FrameAllocator::GetHeapAllocationCount();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 1; i <= CommandCount; ++i) {
+        manager.RegisterExecutedCommand(MakeMove(0.0f, static_cast<float>(i)));
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Log::GetCoreLogger()->set_level(logLevel);
+
+    EXPECT_EQ(manager.GetUndoStackSize(), 1u);
+    EXPECT_EQ(pool.GetLiveCount(), live);
+    EXPECT_EQ(pool.GetCapacity(), capacity);
+    if (FrameAllocator::IsHeapTrackingEnabled()) {
+        EXPECT_EQ(FrameAllocator::GetHeapAllocationCount(), heapBefore);
+    }
+
+    ASSERT_TRUE(manager.Undo());
+    EXPECT_EQ(scene.TryGet(entity)->position, glm::vec3(0.0f));
+    ASSERT_TRUE(manager.Redo());
+    EXPECT_EQ(scene.TryGet(entity)->position, glm::vec3(static_cast<float>(CommandCount)));
+
+    RecordProperty("CommandsPerSecond", static_cast<int>(CommandCount / seconds));
+}
+
+}  // namespace Vest
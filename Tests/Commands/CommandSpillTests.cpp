@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "Commands/BuiltinCommands.h"
+#include "Commands/CommandManager.h"
+#include "CommandTestUtils.h"
+#include "Scene/Scene.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Vest {
+
+class CommandSpillTests : public ::testing::Test {
+protected:
+    Scene scene;
+    EntityHandle entity0;
+    EntityHandle entity1;
+    std::filesystem::path spillPath;
+
+    void SetUp() override {
+        RegisterBuiltinCommands();
+
+        SceneObject object;
+        object.name = "Spilled";
+        entity0 = scene.CreateEntity(object);
+        object.name = "Other";
+        entity1 = scene.CreateEntity(object);
+
+        spillPath = std::filesystem::path(::testing::TempDir()) / "VestTests" /
+                    (std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".spill");
+    }
+
+    CommandPtr MakeColorStep(int step) {
+        return MakeCommand<ModifyColorCommand>(&scene, entity0, glm::vec4(static_cast<float>(step)),
+                                               glm::vec4(static_cast<float>(step + 1)));
+    }
+
+    float GetColor() const { return scene.TryGet(entity0)->color.r; }
+};
+
+namespace {
+
+// Not registered with CommandRegistry, so it can never be spilled
+class LocalCommand : public ICommand {
+public:
+    bool Execute() override { return true; }
+    bool Undo() override { return true; }
+    std::string_view GetName() const override { return "Local"; }
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return MakeCommandTypeId("LocalCommand"); }
+};
+
+}  // namespace
+
+TEST_F(CommandSpillTests, CommandsRoundTripThroughRegistry) {
+    auto transform = MakeCommand<TransformCommand>(&scene, entity0, TransformCommand::Type::Scale,
+                                                   glm::vec3(1.0f), glm::vec3(4.0f));
+    CommandPtr transformCopy = RoundTrip(*transform);
+    ASSERT_TRUE(transformCopy);
+    EXPECT_TRUE(transformCopy->Execute());
+    EXPECT_EQ(scene.TryGet(entity0)->scale, glm::vec3(4.0f));
+
+    SceneObject object;
+    object.name = "Created";
+    object.position = glm::vec3(3.0f);
+    auto create = MakeCommand<CreateEntityCommand>(&scene, object);
+    ASSERT_TRUE(create->Execute());
+    CommandPtr createCopy = RoundTrip(*create);
+    ASSERT_TRUE(createCopy);
+    EXPECT_TRUE(createCopy->Undo());  // Knows the handle the original created
+    EXPECT_FALSE(scene.IsValid(create->GetCreatedEntity()));
+    EXPECT_TRUE(createCopy->Execute());
+    EXPECT_EQ(scene.TryGet(create->GetCreatedEntity())->name, "Created");
+
+    auto remove = MakeCommand<DeleteEntityCommand>(&scene, entity1);
+    ASSERT_TRUE(remove->Execute());
+    CommandPtr removeCopy = RoundTrip(*remove);
+    ASSERT_TRUE(removeCopy);
+    EXPECT_TRUE(removeCopy->Undo());
+    EXPECT_EQ(scene.TryGet(entity1)->name, "Other");
+
+    auto parent = MakeCommand<SetParentCommand>(&scene, entity1, entity0);
+    CommandPtr parentCopy = RoundTrip(*parent);
+    ASSERT_TRUE(parentCopy);
+    EXPECT_TRUE(parentCopy->Execute());
+    EXPECT_EQ(scene.GetParent(entity1), entity0);
+    EXPECT_TRUE(parentCopy->Undo());
+    EXPECT_TRUE(scene.GetParent(entity1).IsNull());
+
+    auto macro = MakeCommand<MacroCommand>("Batch");
+    macro->AddCommand(MakeColorStep(0));
+    macro->AddCommand(MakeColorStep(1));
+    CommandPtr macroCopy = RoundTrip(*macro);
+    ASSERT_TRUE(macroCopy);
+    EXPECT_EQ(macroCopy->GetName(), macro->GetName());
+    EXPECT_TRUE(macroCopy->Execute());
+    EXPECT_FLOAT_EQ(GetColor(), 2.0f);
+}
+
+TEST_F(CommandSpillTests, TruncatedDataIsRejected) {
+    auto transform = MakeCommand<TransformCommand>(&scene, entity0, TransformCommand::Type::Position,
+                                                   glm::vec3(0.0f), glm::vec3(1.0f));
+    std::vector<std::byte> data;
+    ASSERT_TRUE(CommandRegistry::Serialize(*transform, data));
+
+    CommandReader reader(data.data(), data.size() - 1);
+    EXPECT_FALSE(CommandRegistry::Deserialize(reader));
+}
+
+TEST_F(CommandSpillTests, OldStepsSpillAndFaultBackIn) {
+    constexpr int StepCount = 100;
+    constexpr size_t HotLimit = 8;
+    CommandManager manager;
+    ASSERT_TRUE(manager.EnableSpilling(spillPath, HotLimit));
+
+    for (int i = 0; i < StepCount; ++i) {
+        ASSERT_TRUE(manager.ExecuteCommand(MakeColorStep(i)));
+    }
+    EXPECT_FLOAT_EQ(GetColor(), static_cast<float>(StepCount));
+    EXPECT_EQ(manager.GetUndoStackSize(), static_cast<size_t>(StepCount));
+    EXPECT_EQ(manager.GetSpilledCommandCount(), StepCount - HotLimit);
+    EXPECT_EQ(manager.GetUndoMemoryUsage(), HotLimit * sizeof(ModifyColorCommand));
+    EXPECT_GT(manager.GetSpillFileSize(), 0u);
+
+    for (int i = StepCount; i > 0; --i) {
+        ASSERT_TRUE(manager.Undo()) << "step " << i;
+        EXPECT_FLOAT_EQ(GetColor(), static_cast<float>(i - 1));
+    }
+    EXPECT_FALSE(manager.CanUndo());
+    EXPECT_EQ(manager.GetSpilledCommandCount(), 0u);
+
+    for (int i = 0; i < StepCount; ++i) {
+        ASSERT_TRUE(manager.Redo());
+    }
+    EXPECT_FLOAT_EQ(GetColor(), static_cast<float>(StepCount));
+    EXPECT_EQ(manager.GetSpilledCommandCount(), StepCount - HotLimit);
+}
+
+TEST_F(CommandSpillTests, BudgetSpillsInsteadOfEvicting) {
+    CommandManager manager(4 * sizeof(ModifyColorCommand));
+    ASSERT_TRUE(manager.EnableSpilling(spillPath));
+
+    for (int i = 0; i < 20; ++i) {
+        manager.ExecuteCommand(MakeColorStep(i));
+    }
+    EXPECT_EQ(manager.GetUndoStackSize(), 20u);
+    EXPECT_LE(manager.GetMemoryUsage(), manager.GetMemoryBudget());
+
+    while (manager.Undo()) {
+    }
+    EXPECT_FLOAT_EQ(GetColor(), 0.0f);
+}
+
+TEST_F(CommandSpillTests, UnregisteredCommandsAreEvicted) {
+    CommandManager manager;
+    ASSERT_TRUE(manager.EnableSpilling(spillPath, 2));
+
+    for (int i = 0; i < 5; ++i) {
+        manager.ExecuteCommand(CreateScope<LocalCommand>());
+    }
+    EXPECT_EQ(manager.GetUndoStackSize(), 2u);
+    EXPECT_EQ(manager.GetSpilledCommandCount(), 0u);
+}
+
+TEST_F(CommandSpillTests, ClearAndDestructionRemoveSpilledHistory) {
+    {
+        CommandManager manager;
+        ASSERT_TRUE(manager.EnableSpilling(spillPath, 1));
+        for (int i = 0; i < 10; ++i) {
+            manager.ExecuteCommand(MakeColorStep(i));
+        }
+        EXPECT_TRUE(std::filesystem::exists(spillPath));
+
+        manager.Clear();
+        EXPECT_EQ(manager.GetSpilledCommandCount(), 0u);
+        EXPECT_EQ(manager.GetSpillFileSize(), 0u);
+
+        // The truncated file is reused
+        manager.ExecuteCommand(MakeColorStep(10));
+        manager.ExecuteCommand(MakeColorStep(11));
+        EXPECT_EQ(manager.GetSpilledCommandCount(), 1u);
+        ASSERT_TRUE(manager.Undo());
+        ASSERT_TRUE(manager.Undo());
+        EXPECT_FLOAT_EQ(GetColor(), 10.0f);
+    }
+    EXPECT_FALSE(std::filesystem::exists(spillPath));
+}
+
+}  // namespace Vest
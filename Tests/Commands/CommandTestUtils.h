@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "Commands/CommandRegistry.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Vest {
+
+/**
+ * @brief Serialize @p command through CommandRegistry and read it back; null if either step fails
+ *
+ * Expects the whole serialized record to be consumed.
+ */
+inline CommandPtr RoundTrip(const ICommand& command) {
+    std::vector<std::byte> data;
+    EXPECT_TRUE(CommandRegistry::Serialize(command, data));
+    CommandReader reader(data.data(), data.size());
+    CommandPtr copy = CommandRegistry::Deserialize(reader);
+    EXPECT_TRUE(reader.AtEnd());
+    return copy;
+}
+
+}  // namespace Vest
@@ -1,18 +1,24 @@
 #include <gtest/gtest.h>
+#include "Commands/BuiltinCommands.h"
 #include "Commands/CommandManager.h"
 #include "Commands/TransformCommand.h"
 #include "Commands/EntityCommands.h"
 #include "Commands/MacroCommand.h"
-#include "Scene/SceneObject.h"
+#include "Scene/Scene.h"
 
 namespace Vest {
 
 class CommandTests : public ::testing::Test {
 protected:
-    std::vector<SceneObject> scene;
+    Scene scene;
+    EntityHandle entity0;
+    EntityHandle entity1;
+    
+    const SceneObject& Get(EntityHandle entity) const { return *scene.TryGet(entity); }
     
     void SetUp() override {
-        scene.clear();
+        RegisterBuiltinCommands();
+        scene.Clear();
         
         // Create test objects
         SceneObject obj1;
@@ -21,89 +27,90 @@ protected:
         obj1.rotation = glm::vec3(0.0f, 0.0f, 0.0f);
         obj1.scale = glm::vec3(1.0f, 1.0f, 1.0f);
         obj1.color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
-        scene.push_back(obj1);
+        entity0 = scene.CreateEntity(obj1);
         
         SceneObject obj2;
         obj2.name = "Object2";
         obj2.position = glm::vec3(1.0f, 1.0f, 1.0f);
-        scene.push_back(obj2);
+        entity1 = scene.CreateEntity(obj2);
     }
 };
 
 // TransformCommand Tests
 TEST_F(CommandTests, TransformCommandPosition) {
-    glm::vec3 oldPos = scene[0].position;
+    glm::vec3 oldPos = Get(entity0).position;
     glm::vec3 newPos(5.0f, 5.0f, 5.0f);
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, oldPos, newPos);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_FLOAT_EQ(scene[0].position.x, newPos.x);
-    EXPECT_FLOAT_EQ(scene[0].position.y, newPos.y);
-    EXPECT_FLOAT_EQ(scene[0].position.z, newPos.z);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, newPos.x);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, newPos.y);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, newPos.z);
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_FLOAT_EQ(scene[0].position.x, oldPos.x);
-    EXPECT_FLOAT_EQ(scene[0].position.y, oldPos.y);
-    EXPECT_FLOAT_EQ(scene[0].position.z, oldPos.z);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, oldPos.x);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, oldPos.y);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, oldPos.z);
 }
 
 TEST_F(CommandTests, TransformCommandRotation) {
-    glm::vec3 oldRot = scene[0].rotation;
+    glm::vec3 oldRot = Get(entity0).rotation;
     glm::vec3 newRot(0.0f, 45.0f, 0.0f);
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Rotation, oldRot, newRot);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_FLOAT_EQ(scene[0].rotation.x, newRot.x);
-    EXPECT_FLOAT_EQ(scene[0].rotation.y, newRot.y);
-    EXPECT_FLOAT_EQ(scene[0].rotation.z, newRot.z);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.x, newRot.x);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.y, newRot.y);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.z, newRot.z);
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_FLOAT_EQ(scene[0].rotation.x, oldRot.x);
-    EXPECT_FLOAT_EQ(scene[0].rotation.y, oldRot.y);
-    EXPECT_FLOAT_EQ(scene[0].rotation.z, oldRot.z);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.x, oldRot.x);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.y, oldRot.y);
+    EXPECT_FLOAT_EQ(Get(entity0).rotation.z, oldRot.z);
 }
 
 TEST_F(CommandTests, TransformCommandScale) {
-    glm::vec3 oldScale = scene[0].scale;
+    glm::vec3 oldScale = Get(entity0).scale;
     glm::vec3 newScale(2.0f, 2.0f, 2.0f);
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Scale, oldScale, newScale);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_FLOAT_EQ(scene[0].scale.x, newScale.x);
-    EXPECT_FLOAT_EQ(scene[0].scale.y, newScale.y);
-    EXPECT_FLOAT_EQ(scene[0].scale.z, newScale.z);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.x, newScale.x);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.y, newScale.y);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.z, newScale.z);
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_FLOAT_EQ(scene[0].scale.x, oldScale.x);
-    EXPECT_FLOAT_EQ(scene[0].scale.y, oldScale.y);
-    EXPECT_FLOAT_EQ(scene[0].scale.z, oldScale.z);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.x, oldScale.x);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.y, oldScale.y);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.z, oldScale.z);
 }
 
 TEST_F(CommandTests, TransformCommandMerge) {
-    auto cmd1 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd1 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
     
-    auto cmd2 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd2 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f));
     
-    EXPECT_TRUE(cmd1->CanMergeWith(cmd2.get()));
-    EXPECT_TRUE(cmd1->MergeWith(cmd2.get()));
+    EXPECT_TRUE(cmd1->MergeWith(*cmd2));
+    EXPECT_TRUE(CommandRegistry::TryMerge(*cmd1, *cmd2));
 }
 
 TEST_F(CommandTests, TransformCommandNoMergeDifferentTypes) {
-    auto cmd1 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd1 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f));
     
-    auto cmd2 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd2 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Rotation, glm::vec3(0.0f), glm::vec3(45.0f, 0.0f, 0.0f));
     
-    EXPECT_FALSE(cmd1->CanMergeWith(cmd2.get()));
+    EXPECT_FALSE(cmd1->MergeWith(*cmd2));
+    EXPECT_FALSE(CommandRegistry::TryMerge(*cmd1, *cmd2));
 }
 
 // CreateEntityCommand Tests
@@ -111,62 +118,102 @@ TEST_F(CommandTests, CreateEntityCommand) {
     SceneObject newObj;
     newObj.name = "NewObject";
     
-    size_t originalSize = scene.size();
-    auto cmd = CreateScope<CreateEntityCommand>(&scene, newObj);
+    size_t originalSize = scene.Size();
+    auto cmd = MakeCommand<CreateEntityCommand>(&scene, newObj);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_EQ(scene.size(), originalSize + 1);
-    EXPECT_EQ(scene.back().name, "NewObject");
+    EXPECT_EQ(scene.Size(), originalSize + 1);
+    ASSERT_TRUE(scene.IsValid(cmd->GetCreatedEntity()));
+    EXPECT_EQ(Get(cmd->GetCreatedEntity()).name, "NewObject");
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_EQ(scene.size(), originalSize);
+    EXPECT_EQ(scene.Size(), originalSize);
+    EXPECT_FALSE(scene.IsValid(cmd->GetCreatedEntity()));
+}
+
+TEST_F(CommandTests, CreateEntityCommandRedoKeepsHandle) {
+    SceneObject newObj;
+    newObj.name = "NewObject";
+    
+    auto cmd = MakeCommand<CreateEntityCommand>(&scene, newObj);
+    ASSERT_TRUE(cmd->Execute());
+    EntityHandle created = cmd->GetCreatedEntity();
+    
+    ASSERT_TRUE(cmd->Undo());
+    ASSERT_TRUE(cmd->Execute());
+    EXPECT_EQ(cmd->GetCreatedEntity(), created);
+    EXPECT_TRUE(scene.IsValid(created));
 }
 
 // DeleteEntityCommand Tests
 TEST_F(CommandTests, DeleteEntityCommand) {
-    size_t originalSize = scene.size();
-    std::string deletedName = scene[0].name;
+    size_t originalSize = scene.Size();
+    InternedString deletedName = Get(entity0).name;
     
-    auto cmd = CreateScope<DeleteEntityCommand>(&scene, 0);
+    auto cmd = MakeCommand<DeleteEntityCommand>(&scene, entity0);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_EQ(scene.size(), originalSize - 1);
+    EXPECT_EQ(scene.Size(), originalSize - 1);
+    EXPECT_FALSE(scene.IsValid(entity0));
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_EQ(scene.size(), originalSize);
-    EXPECT_EQ(scene[0].name, deletedName);
+    EXPECT_EQ(scene.Size(), originalSize);
+    ASSERT_TRUE(scene.IsValid(entity0));
+    EXPECT_EQ(Get(entity0).name, deletedName);
 }
 
-TEST_F(CommandTests, DeleteEntityCommandInvalidIndex) {
-    auto cmd = CreateScope<DeleteEntityCommand>(&scene, 999);
+TEST_F(CommandTests, DeleteEntityCommandInvalidHandle) {
+    auto cmd = MakeCommand<DeleteEntityCommand>(&scene, EntityHandle::Make(999, 0));
     EXPECT_FALSE(cmd->Execute());
 }
 
+TEST_F(CommandTests, CommandsSurviveReordering) {
+    CommandManager manager;
+    
+    // Deleting entity0 swaps entity1 into its dense slot
+    manager.ExecuteCommand(MakeCommand<DeleteEntityCommand>(&scene, entity0));
+    manager.ExecuteCommand(MakeCommand<TransformCommand>(&scene, entity1, 
+        TransformCommand::Type::Position, glm::vec3(1.0f), glm::vec3(7.0f)));
+    EXPECT_FLOAT_EQ(Get(entity1).position.x, 7.0f);
+    
+    EXPECT_TRUE(manager.Undo());
+    EXPECT_FLOAT_EQ(Get(entity1).position.x, 1.0f);
+    EXPECT_TRUE(manager.Undo());
+    ASSERT_TRUE(scene.IsValid(entity0));
+    EXPECT_EQ(Get(entity0).name, "Object1");
+    EXPECT_EQ(Get(entity1).name, "Object2");
+    
+    EXPECT_TRUE(manager.Redo());
+    EXPECT_TRUE(manager.Redo());
+    EXPECT_FALSE(scene.IsValid(entity0));
+    EXPECT_FLOAT_EQ(Get(entity1).position.x, 7.0f);
+}
+
 // ModifyColorCommand Tests
 TEST_F(CommandTests, ModifyColorCommand) {
-    glm::vec4 oldColor = scene[0].color;
+    glm::vec4 oldColor = Get(entity0).color;
     glm::vec4 newColor(0.0f, 1.0f, 0.0f, 1.0f);
     
-    auto cmd = CreateScope<ModifyColorCommand>(&scene, 0, oldColor, newColor);
+    auto cmd = MakeCommand<ModifyColorCommand>(&scene, entity0, oldColor, newColor);
     
     EXPECT_TRUE(cmd->Execute());
-    EXPECT_FLOAT_EQ(scene[0].color.r, newColor.r);
-    EXPECT_FLOAT_EQ(scene[0].color.g, newColor.g);
-    EXPECT_FLOAT_EQ(scene[0].color.b, newColor.b);
-    EXPECT_FLOAT_EQ(scene[0].color.a, newColor.a);
+    EXPECT_FLOAT_EQ(Get(entity0).color.r, newColor.r);
+    EXPECT_FLOAT_EQ(Get(entity0).color.g, newColor.g);
+    EXPECT_FLOAT_EQ(Get(entity0).color.b, newColor.b);
+    EXPECT_FLOAT_EQ(Get(entity0).color.a, newColor.a);
     
     EXPECT_TRUE(cmd->Undo());
-    EXPECT_FLOAT_EQ(scene[0].color.r, oldColor.r);
-    EXPECT_FLOAT_EQ(scene[0].color.g, oldColor.g);
-    EXPECT_FLOAT_EQ(scene[0].color.b, oldColor.b);
-    EXPECT_FLOAT_EQ(scene[0].color.a, oldColor.a);
+    EXPECT_FLOAT_EQ(Get(entity0).color.r, oldColor.r);
+    EXPECT_FLOAT_EQ(Get(entity0).color.g, oldColor.g);
+    EXPECT_FLOAT_EQ(Get(entity0).color.b, oldColor.b);
+    EXPECT_FLOAT_EQ(Get(entity0).color.a, oldColor.a);
 }
 
 // CommandManager Tests
 TEST_F(CommandTests, CommandManagerExecute) {
     CommandManager manager;
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(5.0f));
     
     EXPECT_TRUE(manager.ExecuteCommand(std::move(cmd)));
@@ -176,35 +223,35 @@ TEST_F(CommandTests, CommandManagerExecute) {
 
 TEST_F(CommandTests, CommandManagerUndoRedo) {
     CommandManager manager;
-    glm::vec3 original = scene[0].position;
+    glm::vec3 original = Get(entity0).position;
     glm::vec3 modified(5.0f, 5.0f, 5.0f);
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, original, modified);
     
     manager.ExecuteCommand(std::move(cmd));
-    EXPECT_FLOAT_EQ(scene[0].position.x, modified.x);
-    EXPECT_FLOAT_EQ(scene[0].position.y, modified.y);
-    EXPECT_FLOAT_EQ(scene[0].position.z, modified.z);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, modified.x);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, modified.y);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, modified.z);
     
     EXPECT_TRUE(manager.Undo());
-    EXPECT_FLOAT_EQ(scene[0].position.x, original.x);
-    EXPECT_FLOAT_EQ(scene[0].position.y, original.y);
-    EXPECT_FLOAT_EQ(scene[0].position.z, original.z);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, original.x);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, original.y);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, original.z);
     EXPECT_TRUE(manager.CanRedo());
     
     EXPECT_TRUE(manager.Redo());
-    EXPECT_FLOAT_EQ(scene[0].position.x, modified.x);
-    EXPECT_FLOAT_EQ(scene[0].position.y, modified.y);
-    EXPECT_FLOAT_EQ(scene[0].position.z, modified.z);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, modified.x);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, modified.y);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, modified.z);
 }
 
 TEST_F(CommandTests, CommandManagerMultipleCommands) {
     CommandManager manager;
     
-    auto cmd1 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd1 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f));
-    auto cmd2 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd2 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Scale, glm::vec3(1.0f), glm::vec3(2.0f));
     
     manager.ExecuteCommand(std::move(cmd1));
@@ -213,16 +260,16 @@ TEST_F(CommandTests, CommandManagerMultipleCommands) {
     EXPECT_EQ(manager.GetUndoStackSize(), 2);
     
     manager.Undo();
-    EXPECT_FLOAT_EQ(scene[0].scale.x, 1.0f);
+    EXPECT_FLOAT_EQ(Get(entity0).scale.x, 1.0f);
     
     manager.Undo();
-    EXPECT_FLOAT_EQ(scene[0].position.x, 0.0f);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, 0.0f);
 }
 
 TEST_F(CommandTests, CommandManagerClearHistory) {
     CommandManager manager;
     
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f));
     
     manager.ExecuteCommand(std::move(cmd));
@@ -234,12 +281,13 @@ TEST_F(CommandTests, CommandManagerClearHistory) {
 }
 
 TEST_F(CommandTests, CommandManagerHistoryLimit) {
-    CommandManager manager(3);  // Limit to 3 commands
+    CommandManager manager;
+    manager.SetMaxHistorySize(3);  // Limit to 3 commands
     
     // Create commands that WON'T merge (different entities)
     for (int i = 0; i < 5; i++) {
-        int entityIndex = i % 2;  // Alternate between entities to prevent merging
-        auto cmd = CreateScope<TransformCommand>(&scene, entityIndex, 
+        EntityHandle entity = i % 2 ? entity1 : entity0;  // Alternate between entities to prevent merging
+        auto cmd = MakeCommand<TransformCommand>(&scene, entity, 
             TransformCommand::Type::Position, 
             glm::vec3(static_cast<float>(i)), 
             glm::vec3(static_cast<float>(i + 1)));
@@ -252,9 +300,9 @@ TEST_F(CommandTests, CommandManagerHistoryLimit) {
 TEST_F(CommandTests, CommandManagerRedoClearedAfterNewCommand) {
     CommandManager manager;
     
-    auto cmd1 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd1 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f));
-    auto cmd2 = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd2 = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(2.0f));
     
     manager.ExecuteCommand(std::move(cmd1));
@@ -271,72 +319,221 @@ TEST_F(CommandTests, CommandManagerRegisterExecuted) {
     glm::vec3 newPos(5.0f, 5.0f, 5.0f);
     
     // Manually change position
-    scene[0].position = newPos;
+    scene.TryGetMutable(entity0)->position = newPos;
     
     // Register the change without executing
-    auto cmd = CreateScope<TransformCommand>(&scene, 0, 
+    auto cmd = MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), newPos);
     
     EXPECT_TRUE(manager.RegisterExecutedCommand(std::move(cmd)));
     EXPECT_TRUE(manager.CanUndo());
     
     manager.Undo();
-    EXPECT_FLOAT_EQ(scene[0].position.x, 0.0f);
-    EXPECT_FLOAT_EQ(scene[0].position.y, 0.0f);
-    EXPECT_FLOAT_EQ(scene[0].position.z, 0.0f);
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, 0.0f);
+    EXPECT_FLOAT_EQ(Get(entity0).position.y, 0.0f);
+    EXPECT_FLOAT_EQ(Get(entity0).position.z, 0.0f);
+}
+
+TEST_F(CommandTests, CommandManagerMergesConsecutiveDragSteps) {
+    CommandManager manager;
+    for (int step = 1; step <= 5; ++step) {
+        manager.ExecuteCommand(MakeCommand<TransformCommand>(&scene, entity0, TransformCommand::Type::Position,
+                                                             glm::vec3(static_cast<float>(step - 1)),
+                                                             glm::vec3(static_cast<float>(step))));
+    }
+    // A different entity breaks the run
+    manager.ExecuteCommand(MakeCommand<TransformCommand>(&scene, entity1, TransformCommand::Type::Position,
+                                                         glm::vec3(1.0f), glm::vec3(2.0f)));
+    EXPECT_EQ(manager.GetUndoStackSize(), 2u);
+    EXPECT_EQ(manager.GetUndoCommandName(), "Move Entity");
+
+    manager.Undo();
+    manager.Undo();
+    EXPECT_FLOAT_EQ(Get(entity0).position.x, 0.0f);
+}
+
+TEST_F(CommandTests, CommandManagerMemoryBudgetEvictsOldest) {
+    const size_t commandBytes = MakeCommand<TransformCommand>(&scene, entity0,
+        TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f))->GetMemoryFootprint();
+    CommandManager manager(commandBytes * 3);
+    
+    for (int i = 0; i < 10; i++) {
+        EntityHandle entity = i % 2 ? entity1 : entity0;  // Alternate to prevent merging
+        manager.ExecuteCommand(MakeCommand<TransformCommand>(&scene, entity, 
+            TransformCommand::Type::Position, glm::vec3(static_cast<float>(i)), glm::vec3(static_cast<float>(i + 1))));
+    }
+    
+    EXPECT_EQ(manager.GetUndoStackSize(), 3);
+    EXPECT_EQ(manager.GetMemoryUsage(), commandBytes * 3);
+    EXPECT_LE(manager.GetMemoryUsage(), manager.GetMemoryBudget());
+    
+    manager.SetMemoryBudget(commandBytes);
+    EXPECT_EQ(manager.GetUndoStackSize(), 1);
+}
+
+TEST_F(CommandTests, CommandManagerKeepsNewestCommandOverBudget) {
+    CommandManager manager(1);
+    
+    manager.ExecuteCommand(MakeCommand<DeleteEntityCommand>(&scene, entity0));
+    EXPECT_EQ(manager.GetUndoStackSize(), 1);
+    EXPECT_GT(manager.GetMemoryUsage(), manager.GetMemoryBudget());
+    
+    EXPECT_TRUE(manager.Undo());
+    EXPECT_TRUE(scene.IsValid(entity0));
+}
+
+namespace {
+
+// Reports a fixed footprint, to drive the memory budget exactly
+class SizedCommand : public ICommand {
+public:
+    explicit SizedCommand(size_t bytes) : m_Bytes(bytes) {}
+
+    bool Execute() override { return true; }
+    bool Undo() override { return true; }
+    std::string_view GetName() const override { return "Sized"; }
+    size_t GetMemoryFootprint() const override { return m_Bytes; }
+    CommandTypeId GetTypeId() const override { return MakeCommandTypeId("SizedCommand"); }
+
+private:
+    size_t m_Bytes;
+};
+
+}  // namespace
+
+TEST_F(CommandTests, CommandManagerDiscardedRedoDoesNotEvictUndo) {
+    CommandManager manager(16000);
+    manager.ExecuteCommand(MakeCommand<SizedCommand>(3000));
+    manager.ExecuteCommand(MakeCommand<SizedCommand>(3000));
+    manager.ExecuteCommand(MakeCommand<SizedCommand>(9000));
+    ASSERT_TRUE(manager.Undo());
+
+    // The 9000-byte redo step is discarded, so 3000 + 3000 + 2000 fits
+    manager.ExecuteCommand(MakeCommand<SizedCommand>(2000));
+    EXPECT_EQ(manager.GetUndoStackSize(), 3);
+    EXPECT_EQ(manager.GetRedoStackSize(), 0);
+    EXPECT_EQ(manager.GetMemoryUsage(), 8000);
+}
+
+TEST_F(CommandTests, CommandManagerRedoStepsDoNotEvictUndo) {
+    CommandManager manager(16000);
+    for (size_t bytes : {3000, 3000, 9000}) {
+        manager.ExecuteCommand(MakeCommand<SizedCommand>(bytes));
+    }
+    ASSERT_TRUE(manager.Undo());
+    ASSERT_TRUE(manager.Undo());
+
+    // Only the undo side is budgeted: 3000 + 3000 fits, the 9000 still on the redo stack does not count
+    manager.SetMemoryBudget(7000);
+    ASSERT_TRUE(manager.Redo());
+    EXPECT_EQ(manager.GetUndoStackSize(), 2);
+    EXPECT_EQ(manager.GetRedoStackSize(), 1);
+    EXPECT_EQ(manager.GetUndoMemoryUsage(), 6000);
+}
+
+TEST_F(CommandTests, CommandManagerMemoryUsageFollowsStacks) {
+    CommandManager manager;
+    EXPECT_EQ(manager.GetMemoryUsage(), 0);
+    
+    manager.ExecuteCommand(MakeCommand<ModifyColorCommand>(&scene, entity0, glm::vec4(1.0f), glm::vec4(0.5f)));
+    const size_t bytes = manager.GetUndoMemoryUsage();
+    EXPECT_GT(bytes, 0);
+    
+    manager.Undo();
+    EXPECT_EQ(manager.GetUndoMemoryUsage(), 0);
+    EXPECT_EQ(manager.GetRedoMemoryUsage(), bytes);
+    
+    manager.Redo();
+    EXPECT_EQ(manager.GetUndoMemoryUsage(), bytes);
+    EXPECT_EQ(manager.GetRedoMemoryUsage(), 0);
+    
+    manager.Clear();
+    EXPECT_EQ(manager.GetMemoryUsage(), 0);
 }
 
 // MacroCommand Tests
 TEST_F(CommandTests, MacroCommandExecution) {
-    auto macro = CreateScope<MacroCommand>("Create and Move");
+    auto macro = MakeCommand<MacroCommand>("Create and Move");
     
     SceneObject newObj;
     newObj.name = "MacroTest";
     
-    macro->AddCommand(CreateScope<CreateEntityCommand>(&scene, newObj));
-    macro->AddCommand(CreateScope<TransformCommand>(&scene, 2, 
-        TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(10.0f)));
+    macro->AddCommand(MakeCommand<CreateEntityCommand>(&scene, newObj));
+    macro->AddCommand(MakeCommand<TransformCommand>(&scene, entity1, 
+        TransformCommand::Type::Position, glm::vec3(1.0f), glm::vec3(10.0f)));
     
-    size_t originalSize = scene.size();
+    size_t originalSize = scene.Size();
     EXPECT_TRUE(macro->Execute());
-    EXPECT_EQ(scene.size(), originalSize + 1);
-    EXPECT_FLOAT_EQ(scene.back().position.x, 10.0f);
-    EXPECT_FLOAT_EQ(scene.back().position.y, 10.0f);
-    EXPECT_FLOAT_EQ(scene.back().position.z, 10.0f);
+    EXPECT_EQ(scene.Size(), originalSize + 1);
+    EXPECT_FLOAT_EQ(Get(entity1).position.x, 10.0f);
+    EXPECT_FLOAT_EQ(Get(entity1).position.y, 10.0f);
+    EXPECT_FLOAT_EQ(Get(entity1).position.z, 10.0f);
 }
 
 TEST_F(CommandTests, MacroCommandUndo) {
-    auto macro = CreateScope<MacroCommand>("Complex Operation");
+    auto macro = MakeCommand<MacroCommand>("Complex Operation");
     
     SceneObject newObj;
     newObj.name = "MacroTest";
     
-    macro->AddCommand(CreateScope<CreateEntityCommand>(&scene, newObj));
-    macro->AddCommand(CreateScope<TransformCommand>(&scene, 2, 
+    macro->AddCommand(MakeCommand<CreateEntityCommand>(&scene, newObj));
+    macro->AddCommand(MakeCommand<TransformCommand>(&scene, entity1, 
         TransformCommand::Type::Scale, glm::vec3(1.0f), glm::vec3(3.0f)));
     
-    size_t originalSize = scene.size();
+    size_t originalSize = scene.Size();
     macro->Execute();
     
     EXPECT_TRUE(macro->Undo());
-    EXPECT_EQ(scene.size(), originalSize);
+    EXPECT_EQ(scene.Size(), originalSize);
+    EXPECT_FLOAT_EQ(Get(entity1).scale.x, 1.0f);
 }
 
 TEST_F(CommandTests, MacroCommandEmpty) {
-    auto macro = CreateScope<MacroCommand>("Empty Macro");
+    auto macro = MakeCommand<MacroCommand>("Empty Macro");
     EXPECT_TRUE(macro->IsEmpty());
     EXPECT_FALSE(macro->Execute());
 }
 
 TEST_F(CommandTests, MacroCommandCount) {
-    auto macro = CreateScope<MacroCommand>("Multiple Commands");
+    auto macro = MakeCommand<MacroCommand>("Multiple Commands");
     
-    macro->AddCommand(CreateScope<TransformCommand>(&scene, 0, 
+    macro->AddCommand(MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Position, glm::vec3(0.0f), glm::vec3(1.0f)));
-    macro->AddCommand(CreateScope<TransformCommand>(&scene, 0, 
+    macro->AddCommand(MakeCommand<TransformCommand>(&scene, entity0, 
         TransformCommand::Type::Rotation, glm::vec3(0.0f), glm::vec3(45.0f)));
     
     EXPECT_EQ(macro->GetCommandCount(), 2);
+    EXPECT_GT(macro->GetMemoryFootprint(), 2 * sizeof(TransformCommand));
+}
+
+TEST_F(CommandTests, CommandNamesAreBuiltOnce) {
+    auto macro = MakeCommand<MacroCommand>("Batch");
+    macro->AddCommand(MakeCommand<ModifyColorCommand>(&scene, entity0, glm::vec4(0.0f), glm::vec4(1.0f)));
+    const std::string_view name = macro->GetName();
+    EXPECT_EQ(name, "Batch (1 operations)");
+    EXPECT_EQ(macro->GetName().data(), name.data());
+
+    macro->AddCommand(MakeCommand<ModifyColorCommand>(&scene, entity1, glm::vec4(0.0f), glm::vec4(1.0f)));
+    EXPECT_EQ(macro->GetName(), "Batch (2 operations)");
+
+    auto remove = MakeCommand<DeleteEntityCommand>(&scene, entity1);
+    EXPECT_EQ(remove->GetName(), "Delete Entity: Object2");
+}
+
+TEST_F(CommandTests, SetParentCommandExecuteUndo) {
+    auto cmd = MakeCommand<SetParentCommand>(&scene, entity1, entity0);
+
+    EXPECT_TRUE(cmd->Execute());
+    EXPECT_EQ(scene.GetParent(entity1), entity0);
+
+    EXPECT_TRUE(cmd->Undo());
+    EXPECT_TRUE(scene.GetParent(entity1).IsNull());
+}
+
+TEST_F(CommandTests, SetParentCommandRejectsCycle) {
+    ASSERT_TRUE(scene.SetParent(entity1, entity0));
+    auto cmd = MakeCommand<SetParentCommand>(&scene, entity0, entity1);
+    EXPECT_FALSE(cmd->Execute());
 }
 
 }  // namespace Vest
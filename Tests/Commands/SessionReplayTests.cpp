@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "Commands/BuiltinCommands.h"
+#include "Commands/CommandManager.h"
+#include "Commands/SessionRecorder.h"
+#include "Commands/SessionReplay.h"
+#include "Scene/Scene.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace Vest {
+
+class SessionReplayTests : public ::testing::Test {
+protected:
+    Scene scene;
+    CommandManager manager;
+    SessionRecorder recorder;
+    EntityHandle entity0;
+    EntityHandle entity1;
+    std::filesystem::path logPath;
+
+    void SetUp() override {
+        RegisterBuiltinCommands();
+
+        SceneObject object;
+        object.name = "First";
+        entity0 = scene.CreateEntity(object);
+        object.name = "Second";
+        object.position = glm::vec3(2.0f);
+        entity1 = scene.CreateEntity(object);
+
+        logPath = std::filesystem::path(::testing::TempDir()) / "VestTests" /
+                  (std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".vsession");
+        ASSERT_TRUE(recorder.Begin(logPath, scene));
+        manager.SetSessionRecorder(&recorder);
+    }
+
+    void TearDown() override {
+        manager.SetSessionRecorder(nullptr);
+        recorder.End();
+        std::filesystem::remove(logPath);
+    }
+
+    // Interactive drag: the scene is written first, then the step is registered
+    void Drag(EntityHandle entity, float from, float to) {
+        scene.TryGetMutable(entity)->position = glm::vec3(to);
+        manager.RegisterExecutedCommand(MakeCommand<TransformCommand>(&scene, entity, TransformCommand::Type::Position,
+                                                                      glm::vec3(from), glm::vec3(to)));
+    }
+
+    static void ExpectSameScene(const Scene& expected, const Scene& actual) {
+        ASSERT_EQ(expected.Size(), actual.Size());
+        for (size_t i = 0; i < expected.Size(); ++i) {
+            const EntityHandle handle = expected.GetHandleAt(i);
+            const SceneObject* object = actual.TryGet(handle);
+            ASSERT_NE(object, nullptr) << "entity " << i;
+            EXPECT_EQ(object->name, expected.GetAt(i).name);
+            EXPECT_EQ(object->position, expected.GetAt(i).position);
+            EXPECT_EQ(object->color, expected.GetAt(i).color);
+        }
+    }
+};
+
+namespace {
+
+// Not registered with CommandRegistry, so it cannot be recorded
+class LocalCommand : public ICommand {
+public:
+    bool Execute() override { return true; }
+    bool Undo() override { return true; }
+    std::string_view GetName() const override { return "Local"; }
+    size_t GetMemoryFootprint() const override { return sizeof(*this); }
+    CommandTypeId GetTypeId() const override { return MakeCommandTypeId("LocalCommand"); }
+};
+
+}  // namespace
+
+TEST_F(SessionReplayTests, ReplayReproducesSceneAndHistory) {
+    const Scene start = scene;
+
+    SceneObject created;
+    created.name = "Created";
+    manager.ExecuteCommand(MakeCommand<CreateEntityCommand>(&scene, created));
+    for (int step = 1; step <= 20; ++step) {
+        Drag(entity0, static_cast<float>(step - 1), static_cast<float>(step));
+    }
+    manager.ExecuteCommand(MakeCommand<ModifyColorCommand>(&scene, entity1, glm::vec4(1.0f), glm::vec4(0.5f)));
+    manager.ExecuteCommand(MakeCommand<DeleteEntityCommand>(&scene, entity1));
+    manager.Undo();
+    manager.Redo();
+    manager.Undo();
+    manager.ExecuteCommand(MakeCommand<BulkSetColorCommand>(&scene, std::vector<EntityHandle>{entity0, entity1},
+                                                            glm::vec4(0.25f)));
+    recorder.End();
+    EXPECT_EQ(recorder.GetUnrecordedCount(), 0u);
+
+    SessionLog log;
+    ASSERT_TRUE(log.Load(logPath));
+    EXPECT_EQ(log.GetEntityCount(), 2u);
+    ASSERT_EQ(log.GetEvents().size(), recorder.GetEventCount());
+
+    Scene replayScene;
+    CommandManager replayManager;
+    SessionReplayStats stats;
+    ASSERT_TRUE(ReplaySession(log, replayScene, replayManager, &stats));
+    EXPECT_EQ(stats.events, log.GetEvents().size());
+    EXPECT_EQ(stats.undos, 2u);
+    EXPECT_EQ(stats.redos, 1u);
+    EXPECT_EQ(stats.failures, 0u);
+    EXPECT_EQ(stats.latenciesUs.size(), stats.events);
+
+    ExpectSameScene(scene, replayScene);
+    EXPECT_EQ(replayManager.GetUndoStackSize(), manager.GetUndoStackSize());
+    EXPECT_EQ(replayManager.GetRedoStackSize(), manager.GetRedoStackSize());
+
+    // The replayed history undoes back to the recorded starting scene
+    while (replayManager.Undo()) {
+    }
+    ExpectSameScene(start, replayScene);
+}
+
+TEST_F(SessionReplayTests, EventsAreTimestampedInOrder) {
+    for (int step = 1; step <= 5; ++step) {
+        Drag(entity0, 0.0f, static_cast<float>(step));
+    }
+    manager.Undo();
+    recorder.End();
+
+    SessionLog log;
+    ASSERT_TRUE(log.Load(logPath));
+    ASSERT_EQ(log.GetEvents().size(), 6u);
+    for (size_t i = 1; i < log.GetEvents().size(); ++i) {
+        EXPECT_LE(log.GetEvents()[i - 1].timeNs, log.GetEvents()[i].timeNs);
+    }
+    EXPECT_EQ(log.GetEvents().back().op, SessionOp::Undo);
+}
+
+TEST_F(SessionReplayTests, TruncatedLogIsRejected) {
+    manager.ExecuteCommand(MakeCommand<ModifyColorCommand>(&scene, entity0, glm::vec4(1.0f), glm::vec4(0.0f)));
+    recorder.End();
+
+    std::ifstream file(logPath, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::vector<std::byte> data(bytes.size() - 1);
+    std::memcpy(data.data(), bytes.data(), data.size());
+
+    SessionLog log;
+    EXPECT_FALSE(log.Parse(data));
+    data.assign(16, std::byte{0});
+    EXPECT_FALSE(log.Parse(data));
+}
+
+TEST_F(SessionReplayTests, UnrecordableCommandStopsReplay) {
+    manager.ExecuteCommand(MakeCommand<ModifyColorCommand>(&scene, entity0, glm::vec4(1.0f), glm::vec4(0.0f)));
+    manager.ExecuteCommand(CreateScope<LocalCommand>());
+    manager.Undo();
+    recorder.End();
+    EXPECT_EQ(recorder.GetUnrecordedCount(), 1u);
+
+    SessionLog log;
+    ASSERT_TRUE(log.Load(logPath));
+    Scene replayScene;
+    CommandManager replayManager;
+    SessionReplayStats stats;
+    EXPECT_FALSE(ReplaySession(log, replayScene, replayManager, &stats));
+    EXPECT_EQ(stats.events, 1u);
+    EXPECT_EQ(replayScene.TryGet(entity0)->color, glm::vec4(0.0f));
+}
+
+}  // namespace Vest
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "Core/BinaryLog.h"
+#include "Core/BinaryLogReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Vest {
+
+namespace {
+
+enum class TestPhase : uint8_t { Load = 3 };
+
+// Never called; its site must still be registered before main()
+[[maybe_unused]] void UnusedCallSite() {
+    VEST_BINLOG("Registered without running {0}", 1);
+}
+
+}  // namespace
+
+class BinaryLogTests : public ::testing::Test {
+protected:
+    std::filesystem::path path;
+
+    void SetUp() override {
+        path = std::filesystem::temp_directory_path() / "VestEngine_BinaryLogTest.vbl";
+        ASSERT_TRUE(BinaryLog::Open(path));
+    }
+
+    void TearDown() override {
+        BinaryLog::Close();
+        std::filesystem::remove(path);
+    }
+
+    BinaryLogReader CloseAndRead() {
+        BinaryLog::Close();
+        BinaryLogReader reader;
+        EXPECT_TRUE(reader.Load(path));
+        return reader;
+    }
+};
+
+TEST_F(BinaryLogTests, RoundTripsArguments) {
+    const std::string name = "crate";
+    VEST_BINLOG("Entity {0} at {1:.2f}, visible {2}, name {3}, phase {4}", 7, 1.5f, true, name, TestPhase::Load);
+    VEST_BINLOG("Literal {{}} and {1}/{0}", uint64_t(1) << 40, -3.25);
+
+    const BinaryLogReader reader = CloseAndRead();
+    ASSERT_EQ(reader.GetEntries().size(), 2u);
+    EXPECT_EQ(reader.FormatMessage(reader.GetEntries()[0]), "Entity 7 at 1.50, visible true, name crate, phase 3");
+    EXPECT_EQ(reader.FormatMessage(reader.GetEntries()[1]), "Literal {} and -3.25/1099511627776");
+    EXPECT_FALSE(reader.IsTruncated());
+    EXPECT_EQ(reader.GetMalformedCount(), 0u);
+
+    const BinaryLogSiteInfo* site = reader.FindSite(reader.GetEntries()[0].siteId);
+    ASSERT_NE(site, nullptr);
+    EXPECT_NE(site->file.find("BinaryLogTests.cpp"), std::string::npos);
+    EXPECT_EQ(site->args.size(), 5u);
+}
+
+TEST_F(BinaryLogTests, SitesRegisterDuringStaticInitialization) {
+    const std::vector<BinaryLogSite> sites = BinaryLog::GetSites();
+    const bool found = std::any_of(sites.begin(), sites.end(), [](const BinaryLogSite& site) {
+        return std::strcmp(site.format, "Registered without running {0}") == 0;
+    });
+    EXPECT_TRUE(found);
+
+    // The file carries the whole table, including sites that never fired
+    const BinaryLogReader reader = CloseAndRead();
+    EXPECT_EQ(reader.GetSiteCount(), sites.size());
+}
+
+TEST_F(BinaryLogTests, ClosedLogDoesNotEvaluateArguments) {
+    BinaryLog::Close();
+    int evaluations = 0;
+    auto count = [&evaluations]() { return ++evaluations; };
+    VEST_BINLOG("Closed {0}", count());
+    EXPECT_EQ(evaluations, 0);
+}
+
+TEST_F(BinaryLogTests, LongStringsAreTruncatedToFit) {
+    const std::string longText(2000, 'x');
+    VEST_BINLOG("{0} {1} {2}", longText, longText, 42);
+
+    const BinaryLogReader reader = CloseAndRead();
+    ASSERT_EQ(reader.GetEntries().size(), 1u);
+    const BinaryLogEntry& entry = reader.GetEntries()[0];
+    EXPECT_EQ(std::get<std::string>(entry.args[0]).size(), BinaryLog::MaxStringLength);
+    EXPECT_LE(std::get<std::string>(entry.args[1]).size(), BinaryLog::MaxStringLength);
+    EXPECT_EQ(std::get<int64_t>(entry.args[2]), 42);
+}
+
+TEST_F(BinaryLogTests, ThreadsAreMergedInTimestampOrder) {
+    constexpr int Threads = 4;
+    constexpr int PerThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < PerThread; ++i) {
+                VEST_BINLOG("Worker {0} step {1}", t, i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const BinaryLogReader reader = CloseAndRead();
+    const std::vector<BinaryLogEntry>& entries = reader.GetEntries();
+    // A full ring drops records rather than blocking, but every record is accounted for
+    EXPECT_EQ(entries.size() + reader.GetDroppedCount(), size_t(Threads * PerThread));
+
+    std::vector<int64_t> lastStep(Threads, -1);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (i > 0) {
+            EXPECT_LE(entries[i - 1].timeNs, entries[i].timeNs);
+        }
+        const int64_t worker = std::get<int64_t>(entries[i].args[0]);
+        const int64_t step = std::get<int64_t>(entries[i].args[1]);
+        ASSERT_GE(worker, 0);
+        ASSERT_LT(worker, Threads);
+        EXPECT_GT(step, lastStep[worker]);
+        lastStep[worker] = step;
+    }
+}
+
+TEST_F(BinaryLogTests, JsonEscapesStrings) {
+    VEST_BINLOG("Path {0}", "C:\\assets\\\"quoted\"");
+
+    const BinaryLogReader reader = CloseAndRead();
+    ASSERT_EQ(reader.GetEntries().size(), 1u);
+    const std::string json = reader.FormatJson(reader.GetEntries()[0]);
+    EXPECT_NE(json.find(R"("message":"Path C:\\assets\\\"quoted\"")"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":["C:\\assets\\\"quoted\""])"), std::string::npos);
+}
+
+TEST_F(BinaryLogTests, TruncatedFileLoadsCompleteChunks) {
+    VEST_BINLOG("Before flush {0}", 1);
+    BinaryLog::Flush();
+    VEST_BINLOG("After flush {0}", 2);
+    BinaryLog::Close();
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    BinaryLogReader reader;
+    ASSERT_TRUE(reader.Load(path));
+    EXPECT_TRUE(reader.IsTruncated());
+    ASSERT_EQ(reader.GetEntries().size(), 1u);
+    EXPECT_EQ(reader.FormatMessage(reader.GetEntries()[0]), "Before flush 1");
+}
+
+TEST_F(BinaryLogTests, RejectsOtherFiles) {
+    BinaryLog::Close();
+    std::filesystem::resize_file(path, 0);
+    BinaryLogReader reader;
+    EXPECT_FALSE(reader.Load(path));
+    EXPECT_FALSE(reader.Load(path.string() + ".missing"));
+}
+
+}  // namespace Vest
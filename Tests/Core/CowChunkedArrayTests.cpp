@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "Core/CowChunkedArray.h"
+
+namespace Vest {
+
+class CowChunkedArrayTests : public ::testing::Test {
+protected:
+    using Array = CowChunkedArray<int, 4>;
+
+    static Array MakeArray(int count) {
+        Array array;
+        for (int i = 0; i < count; ++i) {
+            array.PushBack(i);
+        }
+        return array;
+    }
+};
+
+TEST_F(CowChunkedArrayTests, PushAndIndexAcrossChunks) {
+    Array array = MakeArray(10);
+    EXPECT_EQ(array.Size(), 10u);
+    EXPECT_EQ(array.ChunkCount(), 3u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(array[i], i);
+    }
+}
+
+TEST_F(CowChunkedArrayTests, CopySharesAllChunks) {
+    Array original = MakeArray(10);
+    Array copy = original;
+
+    for (size_t i = 0; i < copy.Size(); i += 4) {
+        EXPECT_TRUE(copy.IsShared(i));
+        EXPECT_EQ(&copy[i], &original[i]);
+    }
+}
+
+TEST_F(CowChunkedArrayTests, MutateDetachesOnlyTouchedChunk) {
+    Array original = MakeArray(10);
+    Array copy = original;
+
+    copy.Mutate(5) = 500;
+
+    EXPECT_EQ(copy[5], 500);
+    EXPECT_EQ(original[5], 5);
+    EXPECT_FALSE(copy.IsShared(5));
+    EXPECT_FALSE(original.IsShared(5));
+    EXPECT_TRUE(copy.IsShared(0));
+    EXPECT_TRUE(copy.IsShared(8));
+}
+
+TEST_F(CowChunkedArrayTests, PushAndPopDoNotAffectSnapshot) {
+    Array original = MakeArray(6);
+    Array snapshot = original;
+
+    original.PopBack();
+    original.PopBack();
+    original.PopBack();
+    original.PushBack(42);
+
+    EXPECT_EQ(original.Size(), 4u);
+    EXPECT_EQ(original[3], 42);
+    ASSERT_EQ(snapshot.Size(), 6u);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(snapshot[i], i);
+    }
+}
+
+TEST_F(CowChunkedArrayTests, UnsharedMutateDoesNotCopy) {
+    Array array = MakeArray(4);
+    const int* before = &array[0];
+    array.Mutate(0) = 7;
+    EXPECT_EQ(&array[0], before);
+}
+
+TEST_F(CowChunkedArrayTests, ClearReleasesChunks) {
+    Array array = MakeArray(9);
+    array.Clear();
+    EXPECT_TRUE(array.Empty());
+    EXPECT_EQ(array.ChunkCount(), 0u);
+}
+
+}  // namespace Vest
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "Core/EventQueue.h"
+
+#include <vector>
+
+namespace Vest {
+
+class EventQueueTests : public ::testing::Test {
+protected:
+    EventQueue queue;
+
+    std::vector<EventType> DrainTypes() {
+        std::vector<EventType> types;
+        queue.Drain([&types](Event& event) { types.push_back(event.GetEventType()); });
+        return types;
+    }
+};
+
+TEST_F(EventQueueTests, DrainsInArrivalOrder) {
+    queue.Push(KeyPressedEvent(65, 0, false));
+    queue.Push(MouseButtonPressedEvent(0, 0));
+    queue.Push(KeyTypedEvent('a'));
+    queue.Push(KeyReleasedEvent(65, 0));
+    EXPECT_EQ(queue.Size(), 4u);
+
+    const std::vector<EventType> expected = {EventType::KeyPressed, EventType::MouseButtonPressed,
+                                             EventType::KeyTyped, EventType::KeyReleased};
+    EXPECT_EQ(DrainTypes(), expected);
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST_F(EventQueueTests, DeliversPayloadThroughDispatcher) {
+    queue.Push(WindowResizeEvent(640, 480));
+    unsigned int width = 0;
+    queue.Drain([&width](Event& event) {
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<WindowResizeEvent>([&width](WindowResizeEvent& resize) {
+            width = resize.GetWidth();
+            return true;
+        });
+        EXPECT_TRUE(event.handled);
+    });
+    EXPECT_EQ(width, 640u);
+}
+
+TEST_F(EventQueueTests, CoalescesMovesAndScrolls) {
+    queue.Push(MouseMovedEvent(1.0f, 1.0f));
+    queue.Push(MouseMovedEvent(2.0f, 3.0f));
+    queue.Push(MouseScrolledEvent(0.0f, 1.0f));
+    queue.Push(MouseScrolledEvent(0.0f, 2.0f));
+    queue.Push(MouseMovedEvent(4.0f, 4.0f));
+    ASSERT_EQ(queue.Size(), 3u);
+
+    std::vector<float> values;
+    queue.Drain([&values](Event& event) {
+        EventDispatcher dispatcher(event);
+        dispatcher.Dispatch<MouseMovedEvent>([&values](MouseMovedEvent& move) {
+            values.push_back(move.GetY());
+            return false;
+        });
+        dispatcher.Dispatch<MouseScrolledEvent>([&values](MouseScrolledEvent& scroll) {
+            values.push_back(scroll.GetYOffset());
+            return false;
+        });
+    });
+    EXPECT_EQ(values, (std::vector<float>{3.0f, 3.0f, 4.0f}));
+}
+
+TEST_F(EventQueueTests, FullQueueDropsAndCounts) {
+    for (size_t i = 0; i < EventQueue::Capacity + 5; ++i) {
+        queue.Push(KeyTypedEvent(static_cast<unsigned int>(i)));
+    }
+    EXPECT_EQ(queue.Size(), EventQueue::Capacity);
+    EXPECT_EQ(queue.GetDroppedCount(), 5u);
+
+    // The oldest events survive
+    unsigned int first = 1234;
+    queue.Drain([&first](Event& event) {
+        if (first == 1234) {
+            first = static_cast<KeyTypedEvent&>(event).GetCodepoint();
+        }
+    });
+    EXPECT_EQ(first, 0u);
+}
+
+TEST_F(EventQueueTests, WrapsAroundAfterDraining) {
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i < EventQueue::Capacity - 1; ++i) {
+            queue.Push(KeyTypedEvent(static_cast<unsigned int>(i)));
+        }
+        size_t drained = 0;
+        unsigned int expected = 0;
+        queue.Drain([&](Event& event) {
+            EXPECT_EQ(static_cast<KeyTypedEvent&>(event).GetCodepoint(), expected++);
+            ++drained;
+        });
+        EXPECT_EQ(drained, EventQueue::Capacity - 1);
+    }
+    EXPECT_EQ(queue.GetDroppedCount(), 0u);
+}
+
+TEST_F(EventQueueTests, CategoriesSeparateKeyboardAndMouse) {
+    EXPECT_TRUE(KeyPressedEvent(1, 0, false).IsInCategory(EventCategoryKeyboard));
+    EXPECT_TRUE(KeyTypedEvent('x').IsInCategory(EventCategoryKeyboard));
+    EXPECT_TRUE(MouseScrolledEvent(0.0f, 1.0f).IsInCategory(EventCategoryMouse));
+    EXPECT_FALSE(MouseMovedEvent(0.0f, 0.0f).IsInCategory(EventCategoryKeyboard));
+    EXPECT_TRUE(WindowResizeEvent(1, 1).IsInCategory(EventCategoryApplication));
+}
+
+}  // namespace Vest
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "Core/FrameAllocator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace Vest {
+
+class FrameAllocatorTests : public ::testing::Test {
+protected:
+    void SetUp() override { FrameAllocator::BeginFrame(); }
+};
+
+TEST_F(FrameAllocatorTests, AllocationsAreAligned) {
+    for (size_t alignment : {1u, 4u, 8u, 16u, 64u, 256u}) {
+        FrameAllocator::Allocate(3);  // Misalign the bump pointer
+        void* memory = FrameAllocator::Allocate(24, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u) << "alignment " << alignment;
+    }
+}
+
+TEST_F(FrameAllocatorTests, DataSurvivesIntoNextFrame) {
+    int* values = FrameAllocator::AllocateArray<int>(16);
+    for (int i = 0; i < 16; ++i) {
+        values[i] = i * 3;
+    }
+
+    // The next frame writes to the other arena
+    FrameAllocator::BeginFrame();
+    int* other = FrameAllocator::AllocateArray<int>(16);
+    std::memset(other, 0xFF, sizeof(int) * 16);
+
+    EXPECT_NE(values, other);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(values[i], i * 3);
+    }
+}
+
+TEST_F(FrameAllocatorTests, MemoryIsReusedTwoFramesLater) {
+    void* first = FrameAllocator::Allocate(128);
+    FrameAllocator::BeginFrame();
+    FrameAllocator::Allocate(128);
+    FrameAllocator::BeginFrame();
+
+    EXPECT_EQ(FrameAllocator::GetBytesUsed(), 0u);
+    EXPECT_EQ(FrameAllocator::Allocate(128), first);
+}
+
+TEST_F(FrameAllocatorTests, ReservedMemoryStopsGrowingOnceWarm) {
+    for (int frame = 0; frame < 2; ++frame) {
+        FrameAllocator::Allocate(FrameAllocator::DefaultBlockSize / 2);
+        FrameAllocator::Allocate(FrameAllocator::DefaultBlockSize / 2);
+        FrameAllocator::BeginFrame();
+    }
+    const size_t reserved = FrameAllocator::GetBytesReserved();
+
+    for (int frame = 0; frame < 10; ++frame) {
+        FrameAllocator::Allocate(FrameAllocator::DefaultBlockSize / 2);
+        FrameAllocator::Allocate(FrameAllocator::DefaultBlockSize / 2);
+        FrameAllocator::BeginFrame();
+    }
+    EXPECT_EQ(FrameAllocator::GetBytesReserved(), reserved);
+}
+
+TEST_F(FrameAllocatorTests, HandlesAllocationsLargerThanABlock) {
+    const size_t size = FrameAllocator::DefaultBlockSize * 3;
+    auto* bytes = static_cast<uint8_t*>(FrameAllocator::Allocate(size));
+    bytes[0] = 1;
+    bytes[size - 1] = 2;
+
+    EXPECT_GE(FrameAllocator::GetBytesUsed(), size);
+    EXPECT_EQ(bytes[0], 1);
+    EXPECT_EQ(bytes[size - 1], 2);
+}
+
+TEST_F(FrameAllocatorTests, CopyStringIsNullTerminated) {
+    std::string source = "Undo Transform";
+    std::string_view copy = FrameAllocator::CopyString(source);
+    source.assign("overwritten");
+
+    EXPECT_EQ(copy, "Undo Transform");
+    EXPECT_EQ(copy.data()[copy.size()], '\0');
+}
+
+TEST_F(FrameAllocatorTests, PmrContainersUseFrameMemory) {
+    const size_t before = FrameAllocator::GetBytesUsed();
+
+    FrameVector<float> vertices(FrameAllocator::GetResource());
+    for (int i = 0; i < 1000; ++i) {
+        vertices.push_back(static_cast<float>(i));
+    }
+    FrameString label("Redo ", FrameAllocator::GetResource());
+    label.append("a command name long enough to leave the small string buffer");
+
+    EXPECT_EQ(vertices[999], 999.0f);
+    EXPECT_EQ(label.substr(0, 5), "Redo ");
+    EXPECT_GT(FrameAllocator::GetBytesUsed(), before + 1000 * sizeof(float));
+}
+
+TEST_F(FrameAllocatorTests, ThreadsHaveSeparateArenas) {
+    void* mainMemory = FrameAllocator::Allocate(64);
+    void* workerMemory = nullptr;
+    size_t workerUsed = 0;
+
+    std::thread worker([&]() {
+        workerMemory = FrameAllocator::Allocate(64);
+        workerUsed = FrameAllocator::GetBytesUsed();
+    });
+    worker.join();
+
+    EXPECT_NE(mainMemory, workerMemory);
+    EXPECT_EQ(workerUsed, 64u);
+}
+
+TEST_F(FrameAllocatorTests, CountsHeapAllocationsPerFrame) {
+    if (!FrameAllocator::IsHeapTrackingEnabled()) {
+        GTEST_SKIP() << "Built without VEST_TRACK_HEAP_ALLOCATIONS";
+    }
+
+    // Kept alive until the count is read; a new/delete pair the optimizer can see may be elided
+    std::vector<int*> allocations;
+    allocations.reserve(5);
+    FrameAllocator::BeginFrame();
+    for (int i = 0; i < 5; ++i) {
+        allocations.push_back(new int(i));
+    }
+    FrameAllocator::BeginFrame();
+    EXPECT_GE(FrameAllocator::GetLastFrameHeapAllocations(), 5u);
+    for (int* allocation : allocations) {
+        delete allocation;
+    }
+
+    // Each frame's arena reserves its blocks on first use; warm both first
+    for (int frame = 0; frame < 2; ++frame) {
+        FrameVector<int> warm(FrameAllocator::GetResource());
+        warm.resize(4096);
+        FrameAllocator::BeginFrame();
+    }
+
+    FrameVector<int> values(FrameAllocator::GetResource());
+    values.resize(4096);
+    FrameAllocator::BeginFrame();
+    EXPECT_EQ(FrameAllocator::GetLastFrameHeapAllocations(), 0u);
+}
+
+}  // namespace Vest
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "Core/FramePacer.h"
+
+#include <chrono>
+#include <thread>
+
+namespace Vest {
+
+class FramePacerTests : public ::testing::Test {
+protected:
+    FramePacer pacer;
+
+    // One loop iteration of Application::Run with @p work of CPU time
+    void RunFrame(std::chrono::microseconds work = std::chrono::microseconds(0)) {
+        pacer.BeginFrame();
+        const FramePacer::Clock::time_point end = FramePacer::Clock::now() + work;
+        while (FramePacer::Clock::now() < end) {
+        }
+        pacer.EndWork();
+        pacer.EndFrame();
+    }
+
+    static double ElapsedMs(FramePacer::Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(FramePacer::Clock::now() - start).count();
+    }
+};
+
+TEST_F(FramePacerTests, FirstFrameHasZeroDelta) {
+    EXPECT_EQ(pacer.BeginFrame().GetSeconds(), 0.0f);
+    pacer.EndWork();
+    pacer.EndFrame();
+    EXPECT_GT(pacer.BeginFrame().GetSeconds(), 0.0f);
+    EXPECT_EQ(pacer.GetFrameCount(), 1u);
+}
+
+TEST_F(FramePacerTests, TargetFpsIsClamped) {
+    pacer.SetTargetFps(0.0);
+    EXPECT_EQ(pacer.GetTargetFps(), FramePacer::MinTargetFps);
+}
+
+TEST_F(FramePacerTests, FixedRateHoldsTargetPeriod) {
+    using namespace std::chrono;
+    pacer.SetMode(FramePacingMode::FixedRate);
+    pacer.SetTargetFps(200.0);  // 5 ms
+
+    constexpr int Frames = 40;
+    RunFrame();
+    const FramePacer::Clock::time_point start = FramePacer::Clock::now();
+    for (int i = 0; i < Frames; ++i) {
+        RunFrame(microseconds(500));
+    }
+    const double elapsedMs = ElapsedMs(start);
+
+    // Deadlines are absolute, so the average period is exact up to the last frame's jitter
+    EXPECT_GE(elapsedMs, Frames * 5.0 - 5.0);
+    EXPECT_LT(elapsedMs, Frames * 5.0 * 1.5);
+}
+
+TEST_F(FramePacerTests, SplitsCpuAndWaitTime) {
+    using namespace std::chrono;
+    pacer.SetMode(FramePacingMode::FixedRate);
+    pacer.SetTargetFps(100.0);  // 10 ms
+
+    RunFrame();
+    RunFrame(milliseconds(2));
+    pacer.BeginFrame();
+
+    const FrameTiming& timing = pacer.GetLastFrame();
+    EXPECT_GE(timing.cpuMs, 2.0);
+    EXPECT_LT(timing.cpuMs, 9.0);
+    EXPECT_GT(timing.waitMs, 0.0);
+    EXPECT_NEAR(timing.cpuMs + timing.waitMs, timing.frameMs, 1.0e-6);
+    EXPECT_GE(timing.frameMs, 9.0);
+}
+
+TEST_F(FramePacerTests, SplitsFrameByPhase) {
+    using namespace std::chrono;
+    pacer.SetMode(FramePacingMode::Uncapped);
+    RunFrame();
+
+    pacer.BeginFrame();
+    std::this_thread::sleep_for(milliseconds(2));
+    pacer.EndUpdate();
+    std::this_thread::sleep_for(milliseconds(3));
+    pacer.EndImGui();
+    pacer.EndWork();
+    std::this_thread::sleep_for(milliseconds(1));
+    pacer.EndFrame();
+    pacer.BeginFrame();
+
+    const FrameTiming& timing = pacer.GetLastFrame();
+    EXPECT_GE(timing.updateMs, 2.0);
+    EXPECT_GE(timing.imguiMs, 3.0);
+    EXPECT_GE(timing.presentMs, 1.0);
+    EXPECT_NEAR(timing.updateMs + timing.imguiMs + timing.presentMs, timing.frameMs, 1.0e-6);
+}
+
+TEST_F(FramePacerTests, UncappedDoesNotWait) {
+    pacer.SetMode(FramePacingMode::Uncapped);
+    RunFrame();
+    const FramePacer::Clock::time_point start = FramePacer::Clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        RunFrame();
+    }
+    EXPECT_LT(ElapsedMs(start), 100.0);
+}
+
+TEST_F(FramePacerTests, LongFrameResynchronizes) {
+    using namespace std::chrono;
+    pacer.SetMode(FramePacingMode::FixedRate);
+    pacer.SetTargetFps(200.0);  // 5 ms
+
+    RunFrame();
+    pacer.BeginFrame();
+    std::this_thread::sleep_for(milliseconds(30));  // A hitch of six periods
+    pacer.EndWork();
+    pacer.EndFrame();
+
+    // No burst of short frames to catch up: the next frame waits a full period
+    const FramePacer::Clock::time_point start = FramePacer::Clock::now();
+    RunFrame();
+    EXPECT_GE(ElapsedMs(start), 4.0);
+}
+
+}  // namespace Vest
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "Core/FrameStats.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace Vest {
+
+class FrameStatsTests : public ::testing::Test {
+protected:
+    static FrameTiming MakeFrame(double frameMs) {
+        FrameTiming timing;
+        timing.frameMs = frameMs;
+        timing.cpuMs = frameMs * 0.5;
+        timing.waitMs = frameMs * 0.5;
+        timing.updateMs = frameMs * 0.25;
+        timing.imguiMs = frameMs * 0.25;
+        timing.presentMs = frameMs * 0.5;
+        return timing;
+    }
+};
+
+TEST_F(FrameStatsTests, EmptyWindowSummarizesToZero) {
+    FrameStats stats;
+    const FrameMetricSummary summary = stats.Summarize(FrameMetric::Frame);
+    EXPECT_EQ(summary.meanMs, 0.0);
+    EXPECT_EQ(summary.maxMs, 0.0);
+    EXPECT_EQ(stats.GetSpikeCount(), 0u);
+}
+
+TEST_F(FrameStatsTests, PercentilesUseNearestRank) {
+    FrameStats stats(100);
+    // 1..100 ms, added out of order
+    for (int i = 100; i >= 1; --i) {
+        stats.Add(MakeFrame(static_cast<double>(i)));
+    }
+
+    const FrameMetricSummary frame = stats.Summarize(FrameMetric::Frame);
+    EXPECT_DOUBLE_EQ(frame.meanMs, 50.5);
+    EXPECT_DOUBLE_EQ(frame.p50Ms, 50.0);
+    EXPECT_DOUBLE_EQ(frame.p95Ms, 95.0);
+    EXPECT_DOUBLE_EQ(frame.p99Ms, 99.0);
+    EXPECT_DOUBLE_EQ(frame.maxMs, 100.0);
+
+    const FrameMetricSummary present = stats.Summarize(FrameMetric::Present);
+    EXPECT_DOUBLE_EQ(present.maxMs, 50.0);
+    EXPECT_DOUBLE_EQ(stats.Summarize(FrameMetric::Update).p50Ms, 12.5);
+}
+
+TEST_F(FrameStatsTests, WindowKeepsTheLatestFrames) {
+    FrameStats stats(4);
+    for (int i = 1; i <= 6; ++i) {
+        stats.Add(MakeFrame(static_cast<double>(i)));
+    }
+
+    ASSERT_EQ(stats.GetCount(), 4u);
+    EXPECT_EQ(stats.GetSample(0).frameMs, 3.0);
+    EXPECT_EQ(stats.GetSample(3).frameMs, 6.0);
+    EXPECT_DOUBLE_EQ(stats.Summarize(FrameMetric::Frame).meanMs, 4.5);
+
+    stats.Clear();
+    EXPECT_EQ(stats.GetCount(), 0u);
+}
+
+TEST_F(FrameStatsTests, CountsSpikesOverBudget) {
+    FrameStats stats;
+    stats.SetBudgetMs(10.0);
+    for (double ms : {5.0, 10.0, 12.0, 9.0, 40.0}) {
+        stats.Add(MakeFrame(ms));
+    }
+    EXPECT_EQ(stats.GetSpikeCount(), 2u);
+    EXPECT_TRUE(stats.IsSpike(stats.GetSample(4)));
+    EXPECT_FALSE(stats.IsSpike(stats.GetSample(1)));
+}
+
+TEST_F(FrameStatsTests, RecordingOutlivesTheWindowAndExportsCsv) {
+    FrameStats stats(2);
+    stats.SetBudgetMs(10.0);
+    stats.Add(MakeFrame(1.0));
+    stats.StartRecording();
+    for (double ms : {4.0, 20.0, 8.0}) {
+        stats.Add(MakeFrame(ms));
+    }
+    stats.StopRecording();
+    stats.Add(MakeFrame(2.0));
+    ASSERT_EQ(stats.GetRecording().size(), 3u);
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "VestEngine_FrameStatsTest.csv";
+    ASSERT_TRUE(stats.ExportCsv(path));
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    std::filesystem::remove(path);
+
+    std::string line;
+    std::istringstream lines(contents.str());
+    std::getline(lines, line);
+    EXPECT_EQ(line, "frame,frame_ms,cpu_ms,wait_ms,update_ms,imgui_ms,present_ms,spike");
+    std::getline(lines, line);
+    EXPECT_EQ(line, "0,4.0000,2.0000,2.0000,1.0000,1.0000,2.0000,0");
+    std::getline(lines, line);
+    EXPECT_EQ(line, "1,20.0000,10.0000,10.0000,5.0000,5.0000,10.0000,1");
+    std::getline(lines, line);
+    EXPECT_EQ(line.rfind("2,8.0000,", 0), 0u);
+    EXPECT_FALSE(std::getline(lines, line));
+
+    // Restarting discards the previous session
+    stats.StartRecording();
+    EXPECT_TRUE(stats.GetRecording().empty());
+}
+
+}  // namespace Vest
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "Core/Input.h"
+
+namespace Vest {
+
+class InputTests : public ::testing::Test {
+protected:
+    void TearDown() override { Input::SetState(InputState()); }
+};
+
+TEST_F(InputTests, QueriesReadTheSnapshot) {
+    InputState state;
+    state.keys.set(65);
+    state.mouseButtons.set(1);
+    state.mousePosition = glm::vec2(10.0f, 20.0f);
+    state.scrollDelta = glm::vec2(0.0f, -1.0f);
+    Input::SetState(state);
+
+    EXPECT_TRUE(Input::IsKeyPressed(65));
+    EXPECT_FALSE(Input::IsKeyPressed(66));
+    EXPECT_TRUE(Input::IsMouseButtonPressed(1));
+    EXPECT_FALSE(Input::IsMouseButtonPressed(0));
+    EXPECT_EQ(Input::GetMousePosition(), glm::vec2(10.0f, 20.0f));
+    EXPECT_EQ(Input::GetScrollDelta(), glm::vec2(0.0f, -1.0f));
+}
+
+TEST_F(InputTests, SnapshotIsUnaffectedByLaterChanges) {
+    InputState live;
+    live.keys.set(32);
+    Input::SetState(live);
+
+    live.keys.reset(32);
+    EXPECT_TRUE(Input::IsKeyPressed(32));
+}
+
+TEST_F(InputTests, OutOfRangeCodesAreNotPressed) {
+    InputState state;
+    state.keys.set();
+    state.mouseButtons.set();
+    Input::SetState(state);
+
+    EXPECT_FALSE(Input::IsKeyPressed(-1));
+    EXPECT_FALSE(Input::IsKeyPressed(InputState::KeyCount));
+    EXPECT_FALSE(Input::IsMouseButtonPressed(InputState::MouseButtonCount));
+}
+
+}  // namespace Vest
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "Core/JobSystem.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Vest {
+
+class JobSystemTests : public ::testing::Test {};
+
+TEST_F(JobSystemTests, DequeOwnerIsLifoThiefIsFifo) {
+    WorkStealingDeque<int*> deque(4);
+    int values[3] = {0, 1, 2};
+    for (int& value : values) {
+        deque.Push(&value);
+    }
+
+    int* item = nullptr;
+    ASSERT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, &values[0]);
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, &values[2]);
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, &values[1]);
+    EXPECT_FALSE(deque.Pop(item));
+    EXPECT_FALSE(deque.Steal(item));
+}
+
+TEST_F(JobSystemTests, DequeGrowsPastInitialCapacity) {
+    WorkStealingDeque<uintptr_t> deque(2);
+    for (uintptr_t i = 1; i <= 1000; ++i) {
+        deque.Push(i);
+    }
+    EXPECT_EQ(deque.Size(), 1000u);
+
+    uintptr_t item = 0;
+    for (uintptr_t i = 1000; i >= 1; --i) {
+        ASSERT_TRUE(deque.Pop(item));
+        EXPECT_EQ(item, i);
+    }
+}
+
+TEST_F(JobSystemTests, DequeConcurrentStealTakesEachItemOnce) {
+    constexpr uintptr_t ItemCount = 100000;
+    WorkStealingDeque<uintptr_t> deque(16);
+    std::vector<std::atomic<int>> taken(ItemCount);
+    std::atomic<bool> producing{true};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 4; ++t) {
+        thieves.emplace_back([&]() {
+            uintptr_t item = 0;
+            while (producing.load() || !deque.Empty()) {
+                if (deque.Steal(item)) {
+                    taken[item].fetch_add(1);
+                }
+            }
+        });
+    }
+
+    uintptr_t item = 0;
+    for (uintptr_t i = 0; i < ItemCount; ++i) {
+        deque.Push(i);
+        if (i % 3 == 0 && deque.Pop(item)) {
+            taken[item].fetch_add(1);
+        }
+    }
+    while (deque.Pop(item)) {
+        taken[item].fetch_add(1);
+    }
+    producing.store(false);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (uintptr_t i = 0; i < ItemCount; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
+
+TEST_F(JobSystemTests, RunAndWaitCompletesAllJobs) {
+    JobSystem jobs(4);
+    JobCounter counter;
+    std::atomic<int> sum{0};
+
+    for (int i = 1; i <= 1000; ++i) {
+        jobs.Run([&sum, i]() { sum.fetch_add(i); }, &counter);
+    }
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST_F(JobSystemTests, ZeroWorkersRunsOnWaitingThread) {
+    JobSystem jobs(0);
+    JobCounter counter;
+    std::thread::id ranOn;
+
+    jobs.Run([&ranOn]() { ranOn = std::this_thread::get_id(); }, &counter);
+    EXPECT_FALSE(counter.IsDone());
+
+    jobs.Wait(counter);
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST_F(JobSystemTests, DetachedJobsReportCompletion) {
+    static std::atomic<int> s_Completed{0};
+    s_Completed = 0;
+
+    JobSystem jobs(2);
+    jobs.SetDetachedCompletionCallback([]() { s_Completed.fetch_add(1); });
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 10; ++i) {
+        jobs.Run([&ran]() { ran.fetch_add(1); });
+    }
+    JobCounter counter;
+    jobs.Run([]() {}, &counter);  // Awaited, so not reported
+    jobs.Wait(counter);
+
+    while (s_Completed.load() < 10) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(ran.load(), 10);
+    EXPECT_EQ(s_Completed.load(), 10);
+}
+
+TEST_F(JobSystemTests, DependencyRunsAfterPrerequisites) {
+    JobSystem jobs(4);
+    JobCounter first;
+    JobCounter second;
+    std::atomic<int> finished{0};
+    std::atomic<int> seenByDependent{-1};
+
+    for (int i = 0; i < 64; ++i) {
+        jobs.Run([&finished]() {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            finished.fetch_add(1);
+        }, &first);
+    }
+    jobs.Run([&]() { seenByDependent = finished.load(); }, &second, &first);
+
+    jobs.Wait(second);
+    EXPECT_EQ(seenByDependent.load(), 64);
+}
+
+TEST_F(JobSystemTests, DependencyOnFinishedCounterRunsImmediately) {
+    JobSystem jobs(2);
+    JobCounter done;
+    JobCounter counter;
+    bool ran = false;
+
+    jobs.Run([&ran]() { ran = true; }, &counter, &done);
+    jobs.Wait(counter);
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(JobSystemTests, NestedJobsAndWaitInsideJob) {
+    JobSystem jobs(4);
+    JobCounter outer;
+    std::atomic<int> leaves{0};
+
+    for (int i = 0; i < 16; ++i) {
+        jobs.Run([&]() {
+            JobCounter inner;
+            for (int j = 0; j < 16; ++j) {
+                jobs.Run([&leaves]() { leaves.fetch_add(1); }, &inner);
+            }
+            jobs.Wait(inner);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+
+    EXPECT_EQ(leaves.load(), 256);
+}
+
+TEST_F(JobSystemTests, SubmissionFromForeignThread) {
+    JobSystem jobs(2);
+    JobCounter counter;
+    std::atomic<int> ran{0};
+
+    std::thread producer([&]() {
+        for (int i = 0; i < 100; ++i) {
+            jobs.Run([&ran]() { ran.fetch_add(1); }, &counter);
+        }
+        jobs.Wait(counter);
+    });
+    producer.join();
+
+    EXPECT_EQ(ran.load(), 100);
+}
+
+TEST_F(JobSystemTests, ParallelForCoversEveryIndexOnce) {
+    JobSystem jobs(4);
+    constexpr uint32_t Count = 100003;
+    std::vector<std::atomic<int>> hits(Count);
+
+    jobs.ParallelFor(Count, [&hits](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            hits[i].fetch_add(1);
+        }
+    });
+
+    for (uint32_t i = 0; i < Count; ++i) {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+}
+
+TEST_F(JobSystemTests, ParallelForRespectsMinimumGrain) {
+    JobSystem jobs(4);
+    std::atomic<uint32_t> smallest{UINT32_MAX};
+
+    jobs.ParallelFor(4096, [&smallest](uint32_t begin, uint32_t end) {
+        uint32_t size = end - begin;
+        uint32_t current = smallest.load();
+        while (size < current && !smallest.compare_exchange_weak(current, size)) {
+        }
+    }, 512);
+
+    EXPECT_GE(smallest.load(), 256u);  // Halving never goes below half a grain
+}
+
+TEST_F(JobSystemTests, ParallelForEmptyRange) {
+    JobSystem jobs(2);
+    bool called = false;
+    jobs.ParallelFor(0, [&called](uint32_t, uint32_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+}  // namespace Vest
@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+
+// Compile this file the way a release build strips logging: INFO and above
+#undef VEST_LOG_ACTIVE_LEVEL
+#define VEST_LOG_ACTIVE_LEVEL 2
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+TEST(LogStrippingTests, StrippedMacrosDoNotEvaluateArguments) {
+    int evaluations = 0;
+    auto count = [&evaluations]() { return ++evaluations; };
+
+    VEST_CORE_TRACE("{0}", count());
+    VEST_CORE_DEBUG("{0}", count());
+    VEST_TRACE("{0}", count());
+    VEST_DEBUG("{0}", count());
+    EXPECT_EQ(evaluations, 0);
+
+    VEST_CORE_INFO("Evaluated {0}", count());
+    EXPECT_EQ(evaluations, 1);
+}
+
+}  // namespace Vest
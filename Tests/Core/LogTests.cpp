@@ -2,6 +2,7 @@
 #include "Core/Log.h"
 #include <fstream>
 #include <filesystem>
+#include <string>
 
 namespace Vest {
 
@@ -65,4 +66,50 @@ TEST_F(LogTests, TraceLogging) {
     EXPECT_NO_THROW(VEST_TRACE("Client trace message"));
 }
 
+TEST_F(LogTests, AsyncLoggerWritesQueuedMessagesOnShutdown) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "VestEngine_AsyncLogTest.log";
+
+    LogConfig config;
+    config.filePath = path.string();
+    config.queueSize = 64;
+    config.flushLevel = spdlog::level::off;
+    config.flushInterval = std::chrono::seconds(0);
+    Log::Init(config);
+    EXPECT_TRUE(Log::GetConfig().async);
+
+    constexpr int Messages = 1000;
+    for (int i = 0; i < Messages; ++i) {
+        VEST_CORE_INFO("Queued message {0}", i);
+    }
+    Log::Shutdown();
+    EXPECT_EQ(Log::GetCoreLogger(), nullptr);
+
+    int lines = 0;
+    {
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find("Queued message") != std::string::npos) {
+                ++lines;
+            }
+        }
+    }
+    EXPECT_EQ(lines, Messages);
+
+    std::filesystem::remove(path);
+    Log::Init();
+}
+
+TEST_F(LogTests, ReinitializeReplacesLoggers) {
+    LogConfig config;
+    config.async = false;
+    EXPECT_NO_THROW(Log::Init(config));
+    EXPECT_FALSE(Log::GetConfig().async);
+    EXPECT_NO_THROW(VEST_CORE_INFO("Synchronous message"));
+
+    EXPECT_NO_THROW(Log::Init());
+    EXPECT_TRUE(Log::GetConfig().async);
+    EXPECT_NE(Log::GetCoreLogger(), nullptr);
+}
+
 }  // namespace Vest
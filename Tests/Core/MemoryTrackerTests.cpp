@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "Core/MemoryTracker.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace Vest {
+
+class MemoryTrackerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!MemoryTracker::IsEnabled()) {
+            GTEST_SKIP() << "Built without VEST_TRACK_HEAP_ALLOCATIONS";
+        }
+        MemoryTracker::BeginFrame();
+    }
+
+    static const MemoryTagStats& Sample(MemoryTag tag) {
+        MemoryTracker::BeginFrame();
+        return MemoryTracker::GetStats(tag);
+    }
+};
+
+TEST(MemoryTagScopeTests, ScopesNestAndRestore) {
+    EXPECT_EQ(MemoryTracker::GetThreadTag(), MemoryTag::Untagged);
+    {
+        MemoryTagScope outer(MemoryTag::Scene);
+        EXPECT_EQ(MemoryTracker::GetThreadTag(), MemoryTag::Scene);
+        {
+            MemoryTagScope inner(MemoryTag::Strings);
+            EXPECT_EQ(MemoryTracker::GetThreadTag(), MemoryTag::Strings);
+        }
+        EXPECT_EQ(MemoryTracker::GetThreadTag(), MemoryTag::Scene);
+    }
+    EXPECT_EQ(MemoryTracker::GetThreadTag(), MemoryTag::Untagged);
+    EXPECT_STREQ(MemoryTracker::GetTagName(MemoryTag::Serialization), "Serialization");
+}
+
+TEST_F(MemoryTrackerTests, ChargesAllocationsToTheCurrentTag) {
+    const int64_t before = Sample(MemoryTag::Serialization).currentBytes;
+    std::unique_ptr<char[]> block;
+    {
+        MemoryTagScope tag(MemoryTag::Serialization);
+        block = std::make_unique<char[]>(4096);
+    }
+
+    const MemoryTagStats& during = Sample(MemoryTag::Serialization);
+    EXPECT_EQ(during.currentBytes, before + 4096);
+    EXPECT_GE(during.peakBytes, during.currentBytes);
+    EXPECT_EQ(during.frameAllocations, 1u);
+    EXPECT_EQ(during.frameBytes, 4096u);
+
+    block.reset();
+    const MemoryTagStats& after = Sample(MemoryTag::Serialization);
+    EXPECT_EQ(after.currentBytes, before);
+    EXPECT_EQ(after.frameAllocations, 0u);
+    EXPECT_GE(after.peakBytes, before + 4096);
+    EXPECT_GE(MemoryTracker::GetTotal().allocations, after.allocations);
+}
+
+TEST_F(MemoryTrackerTests, FreesAreChargedToTheAllocatingTag) {
+    const int64_t texturesBefore = Sample(MemoryTag::Textures).currentBytes;
+    const uint64_t sceneFreesBefore = MemoryTracker::GetStats(MemoryTag::Scene).frees;
+
+    std::string* text = nullptr;
+    {
+        MemoryTagScope tag(MemoryTag::Textures);
+        text = new std::string(1000, 'x');
+    }
+    EXPECT_GT(Sample(MemoryTag::Textures).currentBytes, texturesBefore);
+
+    std::thread([text]() {
+        MemoryTagScope tag(MemoryTag::Scene);
+        delete text;
+    }).join();
+
+    EXPECT_EQ(Sample(MemoryTag::Textures).currentBytes, texturesBefore);
+    EXPECT_EQ(MemoryTracker::GetStats(MemoryTag::Scene).frees, sceneFreesBefore);
+}
+
+TEST_F(MemoryTrackerTests, OverAlignedAllocationsKeepTheirAlignment) {
+    struct alignas(256) Aligned {
+        char data[300];
+    };
+
+    const int64_t before = Sample(MemoryTag::Rendering).currentBytes;
+    Aligned* aligned = nullptr;
+    {
+        MemoryTagScope tag(MemoryTag::Rendering);
+        aligned = new Aligned();
+    }
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 256, 0u);
+    EXPECT_EQ(Sample(MemoryTag::Rendering).currentBytes, before + static_cast<int64_t>(sizeof(Aligned)));
+
+    delete aligned;
+    EXPECT_EQ(Sample(MemoryTag::Rendering).currentBytes, before);
+}
+
+TEST_F(MemoryTrackerTests, ExportsCsv) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "VestEngine_MemoryTrackerTest.csv";
+    ASSERT_TRUE(MemoryTracker::ExportCsv(path));
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    std::filesystem::remove(path);
+
+    std::istringstream lines(contents.str());
+    std::string line;
+    size_t rows = 0;
+    std::getline(lines, line);
+    EXPECT_EQ(line, "tag,allocations,frees,current_bytes,peak_bytes,frame_allocations,frame_bytes");
+    while (std::getline(lines, line)) {
+        ++rows;
+    }
+    EXPECT_EQ(rows, MemoryTracker::TagCount + 1);
+    EXPECT_NE(contents.str().find("\nImGui,"), std::string::npos);
+    EXPECT_NE(contents.str().find("\nTotal,"), std::string::npos);
+}
+
+}  // namespace Vest
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Vest {
+
+class ProfilerTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Profiler::EndCapture();
+        Profiler::SetHistoryEnabled(false);
+        Profiler::SetHistoryCapacity(Profiler::DefaultHistoryCapacity);
+    }
+
+    static const ProfileThread* FindThread(const ProfileCapture& capture, const std::string& name) {
+        for (const ProfileThread& thread : capture.threads) {
+            if (thread.name == name) {
+                return &thread;
+            }
+        }
+        return nullptr;
+    }
+
+    static const ProfileEvent* FindEvent(const ProfileThread& thread, const char* name) {
+        for (const ProfileEvent& event : thread.events) {
+            if (std::strcmp(event.name, name) == 0) {
+                return &event;
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(ProfilerTests, RecordsNestedScopes) {
+    Profiler::SetThreadName("Test Main");
+    Profiler::BeginCapture();
+    {
+        VEST_PROFILE_SCOPE("Outer");
+        {
+            VEST_PROFILE_SCOPE("Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    Profiler::EndCapture();
+
+    const ProfileThread* thread = FindThread(Profiler::GetCapture(), "Test Main");
+    ASSERT_NE(thread, nullptr);
+    ASSERT_EQ(thread->events.size(), 2u);
+
+    // Sorted by start, parents first
+    const ProfileEvent& outer = thread->events[0];
+    const ProfileEvent& inner = thread->events[1];
+    EXPECT_STREQ(outer.name, "Outer");
+    EXPECT_STREQ(inner.name, "Inner");
+    EXPECT_EQ(outer.depth, 0u);
+    EXPECT_EQ(inner.depth, 1u);
+    EXPECT_LE(outer.startNs, inner.startNs);
+    EXPECT_GE(outer.endNs, inner.endNs);
+    EXPECT_GE(inner.endNs - inner.startNs, 1000000);
+}
+
+TEST_F(ProfilerTests, NothingIsRecordedOutsideACapture) {
+    {
+        VEST_PROFILE_SCOPE("Before");
+    }
+    Profiler::BeginCapture();
+    Profiler::EndCapture();
+    EXPECT_EQ(Profiler::GetCapture().GetEventCount(), 0u);
+
+    // A scope open across captures belongs to neither
+    Profiler::BeginCapture();
+    {
+        VEST_PROFILE_SCOPE("Straddling");
+        Profiler::EndCapture();
+        Profiler::BeginCapture();
+    }
+    Profiler::EndCapture();
+    EXPECT_EQ(Profiler::GetCapture().GetEventCount(), 0u);
+}
+
+TEST_F(ProfilerTests, DynamicNamesAreInterned) {
+    Profiler::SetThreadName("Test Main");
+    Profiler::BeginCapture();
+    {
+        std::string name = "Layer ";
+        name += "42";
+        VEST_PROFILE_SCOPE_DYNAMIC(name);
+        name = "overwritten";
+    }
+    Profiler::EndCapture();
+
+    const ProfileThread* thread = FindThread(Profiler::GetCapture(), "Test Main");
+    ASSERT_NE(thread, nullptr);
+    EXPECT_NE(FindEvent(*thread, "Layer 42"), nullptr);
+}
+
+TEST_F(ProfilerTests, CollectsEveryThreadPerFrame) {
+    constexpr int Threads = 3;
+    constexpr int Frames = 4;
+    Profiler::BeginCapture();
+    for (int frame = 0; frame < Frames; ++frame) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < Threads; ++t) {
+            threads.emplace_back([t]() {
+                Profiler::SetThreadName("Profiled " + std::to_string(t));
+                VEST_PROFILE_SCOPE("Work");
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        Profiler::EndFrame();
+    }
+    Profiler::EndCapture();
+
+    const ProfileCapture& capture = Profiler::GetCapture();
+    ASSERT_EQ(capture.frames.size(), size_t(Frames));
+    for (size_t i = 1; i < capture.frames.size(); ++i) {
+        EXPECT_EQ(capture.frames[i].index, capture.frames[i - 1].index + 1);
+        EXPECT_EQ(capture.frames[i].startNs, capture.frames[i - 1].endNs);
+    }
+    EXPECT_EQ(capture.GetEventCount(), size_t(Threads * Frames));
+    EXPECT_EQ(capture.dropped, 0u);
+    EXPECT_NE(FindThread(capture, "Profiled 0"), nullptr);
+}
+
+TEST_F(ProfilerTests, FullBufferDropsAndCounts) {
+    Profiler::BeginCapture();
+    const size_t total = Profiler::RingCapacity + 100;
+    for (size_t i = 0; i < total; ++i) {
+        VEST_PROFILE_SCOPE("Tiny");
+    }
+    Profiler::EndCapture();
+
+    const ProfileCapture& capture = Profiler::GetCapture();
+    EXPECT_EQ(capture.GetEventCount(), Profiler::RingCapacity);
+    EXPECT_EQ(capture.dropped, 100u);
+}
+
+TEST_F(ProfilerTests, ExportsChromeTrace) {
+    Profiler::SetThreadName("Test \"Main\"");
+    Profiler::BeginCapture();
+    {
+        VEST_PROFILE_FUNCTION();
+    }
+    Profiler::EndFrame();
+    Profiler::EndCapture();
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "VestEngine_ProfilerTest.json";
+    ASSERT_TRUE(Profiler::GetCapture().ExportChromeTrace(path));
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    const std::string json = contents.str();
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("ExportsChromeTrace"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"name":"Test \"Main\""})"), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Frame "), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+}
+
+TEST_F(ProfilerTests, HistoryKeepsTheLastFrames) {
+    Profiler::SetThreadName("Test Main");
+    Profiler::SetHistoryCapacity(3);
+    Profiler::SetHistoryEnabled(true);
+    EXPECT_TRUE(Profiler::IsRecording());
+    EXPECT_FALSE(Profiler::IsCapturing());
+    for (int frame = 0; frame < 5; ++frame) {
+        for (int i = 0; i <= frame; ++i) {
+            VEST_PROFILE_SCOPE("Frame Work");
+        }
+        Profiler::EndFrame();
+    }
+
+    ASSERT_EQ(Profiler::GetHistoryCount(), 3u);
+    for (size_t i = 0; i < 3; ++i) {
+        const ProfileFrameRecord& record = Profiler::GetHistoryFrame(i);
+        if (i > 0) {
+            EXPECT_EQ(record.frame.index, Profiler::GetHistoryFrame(i - 1).frame.index + 1);
+        }
+        ASSERT_EQ(record.threads.size(), 1u);
+        EXPECT_EQ(record.threads[0].name, "Test Main");
+        // Oldest kept frame is the third one, with three scopes
+        EXPECT_EQ(record.threads[0].events.size(), i + 3);
+    }
+
+    // Pausing freezes what is there
+    const uint64_t newest = Profiler::GetHistoryFrame(2).frame.index;
+    Profiler::SetHistoryEnabled(false);
+    EXPECT_FALSE(Profiler::IsRecording());
+    {
+        VEST_PROFILE_SCOPE("Paused");
+    }
+    Profiler::EndFrame();
+    ASSERT_EQ(Profiler::GetHistoryCount(), 3u);
+    EXPECT_EQ(Profiler::GetHistoryFrame(2).frame.index, newest);
+
+    Profiler::ClearHistory();
+    EXPECT_EQ(Profiler::GetHistoryCount(), 0u);
+}
+
+TEST_F(ProfilerTests, HistoryAndCaptureRecordTogether) {
+    Profiler::SetThreadName("Test Main");
+    Profiler::SetHistoryEnabled(true);
+    Profiler::BeginCapture();
+    {
+        VEST_PROFILE_SCOPE("Shared");
+    }
+    Profiler::EndFrame();
+    {
+        VEST_PROFILE_SCOPE("History Only");
+        Profiler::EndCapture();
+    }
+    Profiler::EndFrame();
+
+    const ProfileCapture& capture = Profiler::GetCapture();
+    EXPECT_EQ(capture.GetEventCount(), 1u);
+    ASSERT_EQ(capture.frames.size(), 1u);
+    EXPECT_GE(capture.frames[0].startNs, capture.startNs);
+
+    ASSERT_EQ(Profiler::GetHistoryCount(), 2u);
+    const ProfileFrameRecord& first = Profiler::GetHistoryFrame(0);
+    const ProfileFrameRecord& second = Profiler::GetHistoryFrame(1);
+    ASSERT_EQ(first.threads.size(), 1u);
+    ASSERT_EQ(second.threads.size(), 1u);
+    EXPECT_NE(FindEvent(first.threads[0], "Shared"), nullptr);
+    EXPECT_NE(FindEvent(second.threads[0], "History Only"), nullptr);
+}
+
+}  // namespace Vest
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "Core/StringTable.h"
+
+#include <string>
+
+namespace Vest {
+
+class StringTableTests : public ::testing::Test {};
+
+TEST_F(StringTableTests, EmptyStringIsIdZero) {
+    InternedString empty;
+    EXPECT_TRUE(empty.Empty());
+    EXPECT_EQ(empty.GetId(), StringTable::EmptyId);
+    EXPECT_EQ(InternedString("").GetId(), StringTable::EmptyId);
+    EXPECT_STREQ(empty.CStr(), "");
+}
+
+TEST_F(StringTableTests, SameStringSameId) {
+    std::string dynamic = std::string("Interned") + "Name";
+    InternedString a("InternedName");
+    InternedString b(dynamic);
+
+    EXPECT_EQ(a.GetId(), b.GetId());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.View().data(), b.View().data());
+}
+
+TEST_F(StringTableTests, DifferentStringsDifferentIds) {
+    InternedString a("Alpha");
+    InternedString b("Beta");
+    EXPECT_NE(a.GetId(), b.GetId());
+    EXPECT_FALSE(a == b);
+}
+
+TEST_F(StringTableTests, RoundTripsCharacters) {
+    InternedString name("Textured Quad");
+    EXPECT_EQ(name.View(), "Textured Quad");
+    EXPECT_STREQ(name.CStr(), "Textured Quad");
+    EXPECT_EQ(name.Str(), std::string("Textured Quad"));
+    EXPECT_EQ(InternedString::FromId(name.GetId()), name);
+}
+
+TEST_F(StringTableTests, InterningExistingStringDoesNotGrowTable) {
+    InternedString("RepeatedName");
+    const size_t count = StringTable::GetStringCount();
+    const size_t bytes = StringTable::GetArenaBytes();
+
+    for (int i = 0; i < 100; ++i) {
+        InternedString again("RepeatedName");
+    }
+    EXPECT_EQ(StringTable::GetStringCount(), count);
+    EXPECT_EQ(StringTable::GetArenaBytes(), bytes);
+}
+
+TEST_F(StringTableTests, FindDoesNotAddStrings) {
+    const InternedString known("FindableName");
+    EXPECT_EQ(StringTable::Find("FindableName"), known.GetId());
+    EXPECT_EQ(StringTable::Find(""), StringTable::EmptyId);
+
+    const size_t count = StringTable::GetStringCount();
+    EXPECT_FALSE(StringTable::Find("NeverInternedName").has_value());
+    EXPECT_EQ(StringTable::GetStringCount(), count);
+}
+
+TEST_F(StringTableTests, ViewsStayValidAsTableGrows) {
+    InternedString first("StableName");
+    const char* before = first.CStr();
+
+    for (int i = 0; i < 10000; ++i) {
+        InternedString filler("Filler " + std::to_string(i));
+    }
+    EXPECT_EQ(first.CStr(), before);
+    EXPECT_STREQ(first.CStr(), "StableName");
+}
+
+TEST_F(StringTableTests, LargeStringsAreStored) {
+    std::string big(100000, 'x');
+    InternedString name(big);
+    EXPECT_EQ(name.View().size(), big.size());
+    EXPECT_EQ(name, big);
+}
+
+TEST_F(StringTableTests, HandleIsFourBytes) {
+    EXPECT_EQ(sizeof(InternedString), sizeof(uint32_t));
+}
+
+}  // namespace Vest
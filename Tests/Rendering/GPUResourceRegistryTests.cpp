@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "Rendering/GPUResourceRegistry.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Vest {
+
+class GPUResourceRegistryTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (GPUResourceID id : m_Registered) {
+            GPUResourceRegistry::Unregister(id);
+        }
+        GPUResourceRegistry::SetBudget(0);
+    }
+
+    GPUResourceID Register(GPUResourceType type, uint64_t bytes, std::string name = {},
+                           const std::source_location& site = std::source_location::current()) {
+        const GPUResourceID id = GPUResourceRegistry::Register(type, bytes, std::move(name), site);
+        m_Registered.push_back(id);
+        return id;
+    }
+
+    std::vector<GPUResourceID> m_Registered;
+};
+
+TEST_F(GPUResourceRegistryTests, TotalsFollowRegistration) {
+    const GPUResourceTotals texturesBefore = GPUResourceRegistry::GetTotals(GPUResourceType::Texture);
+    const GPUResourceTotals totalBefore = GPUResourceRegistry::GetTotal();
+
+    const GPUResourceID first = Register(GPUResourceType::Texture, 4096);
+    Register(GPUResourceType::Texture, 1024);
+    Register(GPUResourceType::IndexBuffer, 24);
+
+    GPUResourceTotals textures = GPUResourceRegistry::GetTotals(GPUResourceType::Texture);
+    EXPECT_EQ(textures.count, texturesBefore.count + 2);
+    EXPECT_EQ(textures.bytes, texturesBefore.bytes + 5120);
+    EXPECT_EQ(GPUResourceRegistry::GetTotal().bytes, totalBefore.bytes + 5144);
+
+    GPUResourceRegistry::Unregister(first);
+    GPUResourceRegistry::Unregister(first);  // Unknown IDs are ignored
+    textures = GPUResourceRegistry::GetTotals(GPUResourceType::Texture);
+    EXPECT_EQ(textures.count, texturesBefore.count + 1);
+    EXPECT_EQ(textures.bytes, texturesBefore.bytes + 1024);
+}
+
+TEST_F(GPUResourceRegistryTests, ResizeUpdatesTheTotals) {
+    const uint64_t before = GPUResourceRegistry::GetTotals(GPUResourceType::Framebuffer).bytes;
+    const GPUResourceID id = Register(GPUResourceType::Framebuffer, 100 * 100 * 4);
+    GPUResourceRegistry::Resize(id, 50 * 50 * 4);
+    EXPECT_EQ(GPUResourceRegistry::GetTotals(GPUResourceType::Framebuffer).bytes, before + 50 * 50 * 4);
+    GPUResourceRegistry::Resize(id, 200 * 200 * 4);
+    EXPECT_EQ(GPUResourceRegistry::GetTotals(GPUResourceType::Framebuffer).bytes, before + 200 * 200 * 4);
+}
+
+TEST_F(GPUResourceRegistryTests, RecordsNameAndCreationSite) {
+    const GPUResourceID named = Register(GPUResourceType::Texture, 16, "checker.png");
+    const int line = __LINE__ + 1;
+    const GPUResourceID unnamed = Register(GPUResourceType::VertexBuffer, 64);
+
+    EXPECT_EQ(GPUResourceRegistry::GetName(named), "checker.png");
+    const std::string site = "GPUResourceRegistryTests.cpp:" + std::to_string(line);
+    EXPECT_EQ(GPUResourceRegistry::GetName(unnamed), "VertexBuffer " + site);
+
+    const std::vector<GPUResourceInfo> resources = GPUResourceRegistry::GetResources();
+    auto it = std::find_if(resources.begin(), resources.end(),
+                           [unnamed](const GPUResourceInfo& info) { return info.id == unnamed; });
+    ASSERT_NE(it, resources.end());
+    EXPECT_EQ(it->site, site);
+    EXPECT_EQ(it->type, GPUResourceType::VertexBuffer);
+    EXPECT_EQ(it->bytes, 64u);
+}
+
+TEST_F(GPUResourceRegistryTests, ReportsLiveResourcesAsLeaks) {
+    const size_t before = GPUResourceRegistry::ReportLeaks();
+    Register(GPUResourceType::Framebuffer, 1024);
+    const GPUResourceID released = Register(GPUResourceType::Texture, 1024);
+    GPUResourceRegistry::Unregister(released);
+    EXPECT_EQ(GPUResourceRegistry::ReportLeaks(), before + 1);
+}
+
+TEST_F(GPUResourceRegistryTests, FlagsUsageOverBudget) {
+    const uint64_t used = GPUResourceRegistry::GetTotal().bytes;
+    GPUResourceRegistry::SetBudget(used + 1000);
+    EXPECT_FALSE(GPUResourceRegistry::IsOverBudget());
+
+    const GPUResourceID id = Register(GPUResourceType::Texture, 2000);
+    EXPECT_TRUE(GPUResourceRegistry::IsOverBudget());
+    GPUResourceRegistry::Resize(id, 500);
+    EXPECT_FALSE(GPUResourceRegistry::IsOverBudget());
+
+    GPUResourceRegistry::SetBudget(0);
+    GPUResourceRegistry::Resize(id, 1 << 30);
+    EXPECT_FALSE(GPUResourceRegistry::IsOverBudget());
+}
+
+}  // namespace Vest
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "Rendering/Framebuffer.h"
+#include "Rendering/GPUResourceRegistry.h"
+#include "Rendering/Platform/Null/NullBuffer.h"
+#include "Rendering/Platform/Null/NullFramebuffer.h"
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/Platform/Null/NullShader.h"
+#include "Rendering/Platform/Null/NullTexture.h"
+#include "Rendering/Platform/Null/NullVertexArray.h"
+#include "Rendering/Renderer.h"
+#include "Rendering/Texture.h"
+
+#include <algorithm>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Vest {
+
+class NullRendererTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RenderCommand::Init(RenderAPI::Null);
+        NullRendererAPI::SetRecordDrawCalls(true);
+    }
+
+    void TearDown() override {
+        RenderThread::Shutdown();
+        // The Null RendererAPI stays installed: initializing a real one needs a graphics context
+        RendererAPI::SetAPI(ResolveDefaultRenderAPI());
+    }
+
+    static Ref<VertexArray> CreateQuad() {
+        float vertices[4 * 3] = {-0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.5f, 0.5f, 0.0f, -0.5f, 0.5f, 0.0f};
+        uint32_t indices[6] = {0, 1, 2, 2, 3, 0};
+
+        Ref<VertexArray> vertexArray = VertexArray::Create();
+        Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(vertices, sizeof(vertices));
+        vertexBuffer->SetLayout({{ShaderDataType::Float3, "a_Position"}});
+        vertexArray->AddVertexBuffer(vertexBuffer);
+        vertexArray->SetIndexBuffer(IndexBuffer::Create(indices, 6));
+        return vertexArray;
+    }
+
+    static uint32_t GetID(const Ref<Shader>& shader) { return static_cast<const NullShader&>(*shader).GetRendererID(); }
+};
+
+TEST_F(NullRendererTests, RecordsDrawCallsWithTheirState) {
+    Ref<Shader> shader = Shader::Create("Flat", "vertex", "fragment");
+    Ref<VertexArray> quad = CreateQuad();
+    Ref<Texture2D> texture = Texture2D::Create(16, 8);
+    FramebufferSpecification spec;
+    spec.width = 320;
+    spec.height = 200;
+    Ref<Framebuffer> framebuffer = Framebuffer::Create(spec);
+
+    const glm::mat4 viewProjection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f);
+    const glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    framebuffer->Bind();
+    RenderCommand::SetClearColor({0.1f, 0.2f, 0.3f, 1.0f});
+    RenderCommand::Clear();
+    texture->Bind(1);
+    Renderer::BeginScene(viewProjection);
+    Renderer::Submit(shader, quad, transform);
+    Renderer::EndScene();
+    framebuffer->Unbind();
+
+    const NullRenderStats& stats = NullRendererAPI::GetStats();
+    EXPECT_EQ(stats.drawCalls, 1u);
+    EXPECT_EQ(stats.elements, 6u);
+    EXPECT_EQ(stats.clears, 1u);
+    EXPECT_EQ(stats.uniformUploads, 2u);
+
+    const std::vector<NullDrawCall>& calls = NullRendererAPI::GetDrawCalls();
+    ASSERT_EQ(calls.size(), 1u);
+    const NullDrawCall& call = calls[0];
+    EXPECT_EQ(call.mode, NullDrawMode::Triangles);
+    EXPECT_EQ(call.count, 6u);
+    EXPECT_EQ(call.shaderName, "Flat");
+    EXPECT_EQ(call.state.shader, GetID(shader));
+    EXPECT_EQ(call.state.vertexArray, static_cast<const NullVertexArray&>(*quad).GetRendererID());
+    EXPECT_EQ(call.state.textures[1], static_cast<const NullTexture2D&>(*texture).GetRendererID());
+    EXPECT_EQ(call.state.textures[0], 0u);
+    EXPECT_EQ(call.state.framebuffer, static_cast<const NullFramebuffer&>(*framebuffer).GetRendererID());
+    EXPECT_EQ(call.state.viewport, glm::uvec4(0, 0, 320, 200));
+    EXPECT_EQ(call.state.clearColor, glm::vec4(0.1f, 0.2f, 0.3f, 1.0f));
+
+    ASSERT_EQ(call.uniforms.size(), 2u);
+    EXPECT_EQ(call.uniforms[0].first, "u_Transform");
+    EXPECT_EQ(std::get<glm::mat4>(call.uniforms[0].second), transform);
+    EXPECT_EQ(call.uniforms[1].first, "u_ViewProjection");
+    EXPECT_EQ(std::get<glm::mat4>(call.uniforms[1].second), viewProjection);
+
+    // Unbinding restores the default framebuffer
+    EXPECT_EQ(NullRendererAPI::GetState().framebuffer, 0u);
+}
+
+TEST_F(NullRendererTests, CountsRedundantStateChanges) {
+    Ref<Shader> shader = Shader::Create("Flat", "vertex", "fragment");
+    Ref<VertexArray> quad = CreateQuad();
+
+    shader->Bind();
+    shader->Bind();
+    quad->Bind();
+    RenderCommand::SetViewport(0, 0, 64, 64);
+    RenderCommand::SetViewport(0, 0, 64, 64);
+    RenderCommand::DrawIndexed(quad);
+    RenderCommand::DrawIndexed(quad, 3);
+
+    const NullRenderStats& stats = NullRendererAPI::GetStats();
+    EXPECT_EQ(stats.stateChanges, 3u);
+    EXPECT_EQ(stats.redundantChanges, 2u);
+    EXPECT_EQ(stats.drawCalls, 2u);
+    EXPECT_EQ(stats.elements, 9u);
+    EXPECT_EQ(NullRendererAPI::GetDrawCalls()[1].count, 3u);
+
+    NullRendererAPI::ResetRecording();
+    EXPECT_EQ(NullRendererAPI::GetStats().drawCalls, 0u);
+    EXPECT_TRUE(NullRendererAPI::GetDrawCalls().empty());
+    EXPECT_EQ(NullRendererAPI::GetState().shader, GetID(shader));
+}
+
+TEST_F(NullRendererTests, RunsOnTheRenderThread) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    Ref<Shader> shader = Shader::Create("Flat", "vertex", "fragment");
+    Ref<VertexArray> quad = CreateQuad();
+    RenderThread::Flush();
+    NullRendererAPI::ResetRecording();
+    NullRendererAPI::SetRecordDrawCalls(false);
+
+    constexpr uint32_t DrawCount = 1000;
+    for (uint32_t i = 0; i < DrawCount; ++i) {
+        Renderer::Submit(shader, quad, glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i), 0.0f, 0.0f)));
+    }
+    RenderThread::Flush();
+
+    const NullRenderStats& stats = NullRendererAPI::GetStats();
+    EXPECT_EQ(stats.drawCalls, DrawCount);
+    EXPECT_EQ(stats.elements, DrawCount * 6u);
+    EXPECT_TRUE(NullRendererAPI::GetDrawCalls().empty());
+    // Shader bind, two uniform uploads, vertex array bind and the draw
+    EXPECT_EQ(RenderThread::GetLastFrameCommandCount(), DrawCount * 5);
+    // Only the first shader and vertex array binds change anything
+    EXPECT_EQ(stats.stateChanges, 2u);
+    EXPECT_EQ(stats.redundantChanges, (DrawCount - 1) * 2);
+}
+
+TEST_F(NullRendererTests, ResourcesAreCPUStandIns) {
+    const GPUResourceTotals before = GPUResourceRegistry::GetTotal();
+    {
+        float vertices[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+        Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(sizeof(vertices));
+        vertexBuffer->SetData(vertices, sizeof(vertices));
+        const std::vector<uint8_t>& data = static_cast<const NullVertexBuffer&>(*vertexBuffer).GetData();
+        ASSERT_EQ(data.size(), sizeof(vertices));
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), reinterpret_cast<const uint8_t*>(vertices)));
+
+        Ref<Texture2D> missing = Texture2D::Create("does/not/exist.png");
+        EXPECT_EQ(missing->GetWidth(), 1u);
+        EXPECT_EQ(missing->GetHeight(), 1u);
+
+        FramebufferSpecification spec;
+        spec.width = 100;
+        spec.height = 50;
+        Ref<Framebuffer> framebuffer = Framebuffer::Create(spec);
+        framebuffer->Resize(200, 100);
+        EXPECT_EQ(framebuffer->GetSpecification().width, 200u);
+        EXPECT_NE(framebuffer->GetColorAttachmentRendererID(), 0u);
+
+        const GPUResourceTotals during = GPUResourceRegistry::GetTotal();
+        EXPECT_EQ(during.count, before.count + 3);
+        EXPECT_EQ(during.bytes, before.bytes + sizeof(vertices) + 4 + 200 * 100 * 4);
+    }
+    EXPECT_EQ(GPUResourceRegistry::GetTotal().count, before.count);
+}
+
+}  // namespace Vest
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include "Rendering/RenderCommandQueue.h"
+#include "Rendering/RenderThread.h"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace Vest {
+
+class RenderThreadTests : public ::testing::Test {
+protected:
+    void TearDown() override { RenderThread::Shutdown(); }
+};
+
+namespace {
+
+struct DestructionTracker {
+    explicit DestructionTracker(int& destroyed) : destroyed(&destroyed) {}
+    DestructionTracker(DestructionTracker&& other) noexcept : destroyed(other.destroyed) { other.destroyed = nullptr; }
+    ~DestructionTracker() {
+        if (destroyed) {
+            ++*destroyed;
+        }
+    }
+
+    int* destroyed;
+};
+
+struct TrackedResource {
+    TrackedResource(std::vector<int>& log, int id) : log(log), id(id) {}
+    ~TrackedResource() { log.push_back(id); }
+
+    std::vector<int>& log;
+    int id;
+};
+
+}  // namespace
+
+TEST_F(RenderThreadTests, QueueExecutesInSubmissionOrder) {
+    RenderCommandQueue queue(256);
+    std::vector<int> order;
+
+    for (int i = 0; i < 100; ++i) {
+        queue.Submit([&order, i]() { order.push_back(i); });
+    }
+    EXPECT_EQ(queue.GetCommandCount(), 100u);
+    EXPECT_GT(queue.GetCapacityBytes(), 256u);  // Spilled into more blocks
+
+    queue.Execute();
+    ASSERT_EQ(order.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+    EXPECT_EQ(queue.GetCommandCount(), 0u);
+    EXPECT_EQ(queue.GetUsedBytes(), 0u);
+}
+
+TEST_F(RenderThreadTests, QueueReusesBlocksAcrossFrames) {
+    RenderCommandQueue queue(1024);
+    int sum = 0;
+
+    for (int i = 0; i < 64; ++i) {
+        queue.Submit([&sum]() { ++sum; });
+    }
+    queue.Execute();
+    const size_t capacity = queue.GetCapacityBytes();
+
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 64; ++i) {
+            queue.Submit([&sum]() { ++sum; });
+        }
+        queue.Execute();
+    }
+
+    EXPECT_EQ(sum, 64 * 11);
+    EXPECT_EQ(queue.GetCapacityBytes(), capacity);
+}
+
+TEST_F(RenderThreadTests, QueueHandlesCommandsLargerThanABlock) {
+    RenderCommandQueue queue(64);
+    std::array<int, 256> payload{};
+    payload.back() = 42;
+    int seen = 0;
+
+    queue.Submit([&seen]() { seen += 1; });
+    queue.Submit([&seen, payload]() { seen += payload.back(); });
+    queue.Submit([&seen]() { seen += 100; });
+    queue.Execute();
+
+    EXPECT_EQ(seen, 143);
+}
+
+TEST_F(RenderThreadTests, QueueDestroysCommandsExactlyOnce) {
+    int destroyed = 0;
+    int executed = 0;
+    {
+        RenderCommandQueue queue;
+        queue.Submit([tracker = DestructionTracker(destroyed), &executed]() { ++executed; });
+        queue.Execute();
+        EXPECT_EQ(executed, 1);
+        EXPECT_EQ(destroyed, 1);
+
+        // Never executed: destroyed by the queue's destructor
+        queue.Submit([tracker = DestructionTracker(destroyed), &executed]() { ++executed; });
+    }
+    EXPECT_EQ(executed, 1);
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST_F(RenderThreadTests, SubmitRunsImmediatelyWithoutRenderThread) {
+    ASSERT_FALSE(RenderThread::IsInitialized());
+    bool ran = false;
+    RenderThread::Submit([&ran]() { ran = true; });
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(RenderThreadTests, SingleThreadedDefersUntilKick) {
+    RenderThread::Init(RenderThreadPolicy::SingleThreaded);
+    int ran = 0;
+
+    RenderThread::Submit([&ran]() { ++ran; });
+    RenderThread::Submit([&ran]() { ++ran; });
+    EXPECT_EQ(ran, 0);
+
+    RenderThread::Kick();
+    EXPECT_EQ(ran, 2);
+    EXPECT_EQ(RenderThread::GetLastFrameCommandCount(), 2u);
+}
+
+TEST_F(RenderThreadTests, MultiThreadedExecutesOnRenderThread) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    std::thread::id executedOn;
+    bool sawRenderThread = false;
+
+    RenderThread::Submit([&]() {
+        executedOn = std::this_thread::get_id();
+        sawRenderThread = RenderThread::IsRenderThread();
+    });
+    RenderThread::Flush();
+
+    EXPECT_NE(executedOn, std::this_thread::get_id());
+    EXPECT_TRUE(sawRenderThread);
+    EXPECT_FALSE(RenderThread::IsRenderThread());
+}
+
+TEST_F(RenderThreadTests, MultiThreadedKeepsFrameOrder) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    std::vector<int> order;  // Only touched by the render thread until Flush
+
+    for (int frame = 0; frame < 50; ++frame) {
+        for (int i = 0; i < 10; ++i) {
+            RenderThread::Submit([&order, value = frame * 10 + i]() { order.push_back(value); });
+        }
+        RenderThread::Kick();
+    }
+    RenderThread::Flush();
+
+    ASSERT_EQ(order.size(), 500u);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST_F(RenderThreadTests, ResourceFreesRunAfterFrameCommands) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    std::vector<int> log;
+
+    Ref<TrackedResource> resource = CreateRenderResource<TrackedResource>(log, 7);
+    TrackedResource* raw = resource.get();
+    RenderThread::Submit([&log]() { log.push_back(1); });
+    resource.reset();  // Deletion is queued, not immediate
+    RenderThread::Submit([&log, raw]() { log.push_back(raw->id); });
+    RenderThread::Flush();
+
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_EQ(log[0], 1);
+    EXPECT_EQ(log[1], 7);  // Still alive for a command recorded after the last Ref dropped
+    EXPECT_EQ(log[2], 7);  // Destructor
+}
+
+TEST_F(RenderThreadTests, SubmitFromRenderThreadRunsInline) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    std::vector<int> order;
+
+    RenderThread::Submit([&order]() {
+        order.push_back(1);
+        RenderThread::Submit([&order]() { order.push_back(2); });
+        order.push_back(3);
+    });
+    RenderThread::Flush();
+
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(RenderThreadTests, ShutdownExecutesPendingCommands) {
+    RenderThread::Init(RenderThreadPolicy::MultiThreaded);
+    bool ran = false;
+    RenderThread::Submit([&ran]() { ran = true; });
+
+    RenderThread::Shutdown();
+    EXPECT_TRUE(ran);
+    EXPECT_FALSE(RenderThread::IsInitialized());
+}
+
+}  // namespace Vest
@@ -0,0 +1,373 @@
+#include <gtest/gtest.h>
+#include "Scene/Scene.h"
+
+namespace Vest {
+
+class SceneTests : public ::testing::Test {
+protected:
+    Scene scene;
+
+    static SceneObject MakeObject(const std::string& name) {
+        SceneObject object;
+        object.name = name;
+        return object;
+    }
+};
+
+TEST_F(SceneTests, DefaultHandleIsNull) {
+    EntityHandle handle;
+    EXPECT_TRUE(handle.IsNull());
+    EXPECT_FALSE(scene.IsValid(handle));
+    EXPECT_EQ(scene.TryGet(handle), nullptr);
+}
+
+TEST_F(SceneTests, HandlePacking) {
+    EntityHandle handle = EntityHandle::Make(1234, 7);
+    EXPECT_EQ(handle.GetIndex(), 1234u);
+    EXPECT_EQ(handle.GetGeneration(), 7u);
+    EXPECT_EQ(sizeof(EntityHandle), sizeof(uint32_t));
+}
+
+TEST_F(SceneTests, CreateAndLookup) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+
+    EXPECT_EQ(scene.Size(), 2u);
+    ASSERT_TRUE(scene.IsValid(a));
+    ASSERT_TRUE(scene.IsValid(b));
+    EXPECT_EQ(scene.TryGet(a)->name, "A");
+    EXPECT_EQ(scene.TryGet(b)->name, "B");
+}
+
+TEST_F(SceneTests, DestroySwapsLastIntoPlace) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+    EntityHandle c = scene.CreateEntity(MakeObject("C"));
+
+    EXPECT_TRUE(scene.DestroyEntity(a));
+    EXPECT_EQ(scene.Size(), 2u);
+    EXPECT_FALSE(scene.IsValid(a));
+
+    // C moved into A's dense position, handles still resolve correctly
+    EXPECT_EQ(scene.GetHandleAt(0), c);
+    EXPECT_EQ(scene.TryGet(b)->name, "B");
+    EXPECT_EQ(scene.TryGet(c)->name, "C");
+}
+
+TEST_F(SceneTests, StaleHandleRejectedAfterSlotReuse) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    ASSERT_TRUE(scene.DestroyEntity(a));
+
+    EntityHandle reused = scene.CreateEntity(MakeObject("Reused"));
+    EXPECT_EQ(reused.GetIndex(), a.GetIndex());
+    EXPECT_NE(reused, a);
+    EXPECT_FALSE(scene.IsValid(a));
+    EXPECT_FALSE(scene.DestroyEntity(a));
+    EXPECT_TRUE(scene.IsValid(reused));
+}
+
+TEST_F(SceneTests, RestoreRevivesOriginalHandle) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    scene.CreateEntity(MakeObject("B"));
+    ASSERT_TRUE(scene.DestroyEntity(a));
+
+    EXPECT_TRUE(scene.RestoreEntity(a, MakeObject("A")));
+    ASSERT_TRUE(scene.IsValid(a));
+    EXPECT_EQ(scene.TryGet(a)->name, "A");
+
+    // A revived slot must not be handed out again by CreateEntity
+    EntityHandle c = scene.CreateEntity(MakeObject("C"));
+    EXPECT_NE(c.GetIndex(), a.GetIndex());
+    EXPECT_EQ(scene.Size(), 3u);
+}
+
+TEST_F(SceneTests, RestoreDoesNotRevivePastGenerations) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    ASSERT_TRUE(scene.DestroyEntity(a));
+    EntityHandle reused = scene.CreateEntity(MakeObject("Reused"));
+    ASSERT_EQ(reused.GetIndex(), a.GetIndex());
+    ASSERT_TRUE(scene.DestroyEntity(reused));
+
+    // Undo of the original delete, then the slot cycles again
+    ASSERT_TRUE(scene.RestoreEntity(a, MakeObject("A")));
+    ASSERT_TRUE(scene.DestroyEntity(a));
+    EntityHandle next = scene.CreateEntity(MakeObject("Next"));
+    ASSERT_EQ(next.GetIndex(), a.GetIndex());
+
+    EXPECT_NE(next, reused);
+    EXPECT_NE(next, a);
+    EXPECT_FALSE(scene.IsValid(reused));
+    EXPECT_FALSE(scene.IsValid(a));
+    EXPECT_EQ(scene.TryGet(reused), nullptr);
+
+    // Restoring the reused handle is still allowed once the slot is free again
+    ASSERT_TRUE(scene.DestroyEntity(next));
+    EXPECT_TRUE(scene.RestoreEntity(reused, MakeObject("Reused")));
+    EXPECT_FALSE(scene.IsValid(next));
+}
+
+TEST_F(SceneTests, RestoreFailsOnOccupiedSlot) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EXPECT_FALSE(scene.RestoreEntity(a, MakeObject("Duplicate")));
+    EXPECT_EQ(scene.Size(), 1u);
+}
+
+TEST_F(SceneTests, BatchDestroyKeepsSurvivorOrder) {
+    std::vector<EntityHandle> handles;
+    for (int i = 0; i < 6; ++i) {
+        handles.push_back(scene.CreateEntity(MakeObject("E" + std::to_string(i))));
+    }
+
+    // Stale and repeated handles are skipped
+    const std::vector<EntityHandle> doomed = {handles[4], handles[1], handles[4], EntityHandle()};
+    EXPECT_EQ(scene.DestroyEntities(doomed), 2u);
+    ASSERT_EQ(scene.Size(), 4u);
+    EXPECT_EQ(scene.GetHandleAt(0), handles[0]);
+    EXPECT_EQ(scene.GetHandleAt(1), handles[2]);
+    EXPECT_EQ(scene.GetHandleAt(2), handles[3]);
+    EXPECT_EQ(scene.GetHandleAt(3), handles[5]);
+    EXPECT_EQ(scene.TryGet(handles[5])->name, "E5");
+    EXPECT_TRUE(scene.FindEntityByName("E1").IsNull());
+    EXPECT_FALSE(scene.IsValid(handles[4]));
+}
+
+TEST_F(SceneTests, BatchRestoreRevivesHandles) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+    EntityHandle c = scene.CreateEntity(MakeObject("C"));
+    const std::vector<EntityHandle> removed = {a, c};
+    const std::vector<SceneObject> saved = {*scene.TryGet(a), *scene.TryGet(c)};
+    ASSERT_EQ(scene.DestroyEntities(removed), 2u);
+
+    EXPECT_EQ(scene.RestoreEntities(removed, saved), 2u);
+    EXPECT_EQ(scene.Size(), 3u);
+    EXPECT_EQ(scene.TryGet(a)->name, "A");
+    EXPECT_EQ(scene.TryGet(c)->name, "C");
+    EXPECT_EQ(scene.FindEntityByName("C"), c);
+
+    // Occupied slots are not overwritten
+    EXPECT_EQ(scene.RestoreEntities(std::vector<EntityHandle>{b}, saved), 0u);
+    EXPECT_EQ(scene.TryGet(b)->name, "B");
+}
+
+TEST_F(SceneTests, ClearInvalidatesHandles) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+
+    scene.Clear();
+    EXPECT_TRUE(scene.Empty());
+    EXPECT_FALSE(scene.IsValid(a));
+    EXPECT_FALSE(scene.IsValid(b));
+}
+
+TEST_F(SceneTests, CopyPreservesHandles) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    Scene backup = scene;
+
+    scene.DestroyEntity(a);
+    scene = backup;
+    ASSERT_TRUE(scene.IsValid(a));
+    EXPECT_EQ(scene.TryGet(a)->name, "A");
+}
+
+TEST_F(SceneTests, FindEntityByName) {
+    EntityHandle a = scene.CreateEntity(MakeObject("Player"));
+    scene.CreateEntity(MakeObject("Enemy"));
+
+    EXPECT_EQ(scene.FindEntityByName("Player"), a);
+    EXPECT_EQ(scene.FindEntityByName(InternedString("Player")), a);
+    EXPECT_EQ(scene.FindEntityByName(std::string("Player")), a);
+
+    // Looking up an unknown name must not intern it
+    const size_t strings = StringTable::GetStringCount();
+    EXPECT_TRUE(scene.FindEntityByName("Missing").IsNull());
+    EXPECT_EQ(StringTable::GetStringCount(), strings);
+
+    scene.DestroyEntity(a);
+    EXPECT_TRUE(scene.FindEntityByName("Player").IsNull());
+}
+
+TEST_F(SceneTests, RenameUpdatesNameIndex) {
+    EntityHandle a = scene.CreateEntity(MakeObject("Old"));
+
+    EXPECT_TRUE(scene.RenameEntity(a, "New"));
+    EXPECT_EQ(scene.TryGet(a)->name, "New");
+    EXPECT_TRUE(scene.FindEntityByName("Old").IsNull());
+    EXPECT_EQ(scene.FindEntityByName("New"), a);
+}
+
+TEST_F(SceneTests, DuplicateNamesResolveToSurvivor) {
+    EntityHandle a = scene.CreateEntity(MakeObject("Twin"));
+    EntityHandle b = scene.CreateEntity(MakeObject("Twin"));
+
+    scene.DestroyEntity(a);
+    EXPECT_EQ(scene.FindEntityByName("Twin"), b);
+}
+
+TEST_F(SceneTests, CopyingDoesNotInternNewStrings) {
+    for (int i = 0; i < 100; ++i) {
+        scene.CreateEntity(MakeObject("Entity " + std::to_string(i)));
+    }
+    const size_t count = StringTable::GetStringCount();
+
+    Scene backup = scene;
+    EXPECT_EQ(StringTable::GetStringCount(), count);
+    EXPECT_EQ(backup.FindEntityByName("Entity 42"), scene.FindEntityByName("Entity 42"));
+}
+
+TEST_F(SceneTests, SnapshotIsolatedFromEdits) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+    Scene snapshot = scene;
+
+    scene.TryGetMutable(a)->position = glm::vec3(5.0f);
+    scene.DestroyEntity(b);
+    EntityHandle c = scene.CreateEntity(MakeObject("C"));
+    scene.RenameEntity(a, "Renamed");
+
+    EXPECT_EQ(snapshot.Size(), 2u);
+    EXPECT_FLOAT_EQ(snapshot.TryGet(a)->position.x, 0.0f);
+    EXPECT_EQ(snapshot.TryGet(a)->name, "A");
+    EXPECT_TRUE(snapshot.IsValid(b));
+    EXPECT_FALSE(snapshot.IsValid(c));
+    EXPECT_EQ(snapshot.FindEntityByName("A"), a);
+    EXPECT_TRUE(snapshot.FindEntityByName("Renamed").IsNull());
+
+    scene = std::move(snapshot);
+    EXPECT_TRUE(scene.IsValid(b));
+    EXPECT_FALSE(scene.IsValid(c));
+    EXPECT_FLOAT_EQ(scene.TryGet(a)->position.x, 0.0f);
+}
+
+TEST_F(SceneTests, ReadsDoNotDetachFromSnapshot) {
+    for (int i = 0; i < 1000; ++i) {
+        scene.CreateEntity(MakeObject("E"));
+    }
+    Scene snapshot = scene;
+
+    const Scene& view = scene;
+    for (size_t i = 0; i < view.Size(); ++i) {
+        EXPECT_EQ(&view.GetAt(i), &snapshot.GetAt(i));
+    }
+}
+
+TEST_F(SceneTests, HierarchyIsDepthFirst) {
+    EntityHandle root = scene.CreateEntity(MakeObject("Root"));
+    EntityHandle other = scene.CreateEntity(MakeObject("Other"));
+    EntityHandle child = scene.CreateEntity(MakeObject("Child"));
+    EntityHandle grandchild = scene.CreateEntity(MakeObject("Grandchild"));
+
+    ASSERT_TRUE(scene.SetParent(child, root));
+    ASSERT_TRUE(scene.SetParent(grandchild, child));
+    scene.UpdateTransforms();
+
+    ASSERT_EQ(scene.GetHierarchySize(), 4u);
+    EXPECT_EQ(scene.GetHierarchyHandleAt(0), root);
+    EXPECT_EQ(scene.GetHierarchyHandleAt(1), child);
+    EXPECT_EQ(scene.GetHierarchyHandleAt(2), grandchild);
+    EXPECT_EQ(scene.GetHierarchyHandleAt(3), other);
+    EXPECT_EQ(scene.GetHierarchyDepthAt(2), 2u);
+    EXPECT_EQ(scene.GetSubtreeEndAt(0), 3u);
+    EXPECT_EQ(scene.GetSubtreeEndAt(3), 4u);
+}
+
+TEST_F(SceneTests, SetParentRejectsCycles) {
+    EntityHandle a = scene.CreateEntity(MakeObject("A"));
+    EntityHandle b = scene.CreateEntity(MakeObject("B"));
+
+    ASSERT_TRUE(scene.SetParent(b, a));
+    EXPECT_FALSE(scene.SetParent(a, b));
+    EXPECT_FALSE(scene.SetParent(a, a));
+    EXPECT_TRUE(scene.GetParent(a).IsNull());
+}
+
+TEST_F(SceneTests, WorldTransformsComposeThroughParents) {
+    SceneObject parentObject = MakeObject("Parent");
+    parentObject.position = glm::vec3(10.0f, 0.0f, 0.0f);
+    parentObject.scale = glm::vec3(2.0f);
+    SceneObject childObject = MakeObject("Child");
+    childObject.position = glm::vec3(1.0f, 0.0f, 0.0f);
+
+    EntityHandle parent = scene.CreateEntity(parentObject);
+    EntityHandle child = scene.CreateEntity(childObject);
+    scene.SetParent(child, parent);
+    scene.UpdateTransforms();
+
+    glm::vec4 origin = scene.GetWorldTransform(child) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_FLOAT_EQ(origin.x, 12.0f);
+}
+
+TEST_F(SceneTests, MovingParentRepropagatesSubtree) {
+    EntityHandle parent = scene.CreateEntity(MakeObject("Parent"));
+    EntityHandle child = scene.CreateEntity(MakeObject("Child"));
+    EntityHandle unrelated = scene.CreateEntity(MakeObject("Unrelated"));
+    scene.SetParent(child, parent);
+    scene.UpdateTransforms();
+
+    scene.TryGetMutable(parent)->position = glm::vec3(0.0f, 5.0f, 0.0f);
+    scene.UpdateTransforms();
+
+    glm::vec4 childOrigin = scene.GetWorldTransform(child) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    glm::vec4 unrelatedOrigin = scene.GetWorldTransform(unrelated) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_FLOAT_EQ(childOrigin.y, 5.0f);
+    EXPECT_FLOAT_EQ(unrelatedOrigin.y, 0.0f);
+}
+
+TEST_F(SceneTests, DestroyedParentOrphansUntilRestored) {
+    SceneObject parentObject = MakeObject("Parent");
+    parentObject.position = glm::vec3(3.0f, 0.0f, 0.0f);
+    EntityHandle parent = scene.CreateEntity(parentObject);
+    EntityHandle child = scene.CreateEntity(MakeObject("Child"));
+    scene.SetParent(child, parent);
+
+    SceneObject saved = *scene.TryGet(parent);
+    scene.DestroyEntity(parent);
+    scene.UpdateTransforms();
+    EXPECT_TRUE(scene.GetParent(child).IsNull());
+    EXPECT_FLOAT_EQ((scene.GetWorldTransform(child) * glm::vec4(0, 0, 0, 1)).x, 0.0f);
+
+    scene.RestoreEntity(parent, saved);
+    scene.UpdateTransforms();
+    EXPECT_EQ(scene.GetParent(child), parent);
+    EXPECT_FLOAT_EQ((scene.GetWorldTransform(child) * glm::vec4(0, 0, 0, 1)).x, 3.0f);
+}
+
+TEST_F(SceneTests, RevisionTracksWrites) {
+    EntityHandle entity = scene.CreateEntity(MakeObject("Tracked"));
+    uint64_t revision = scene.GetRevision();
+
+    // Reads and transform updates leave it alone
+    scene.TryGet(entity);
+    scene.UpdateTransforms();
+    EXPECT_EQ(scene.GetRevision(), revision);
+
+    scene.TryGetMutable(entity)->position.x = 1.0f;
+    EXPECT_NE(scene.GetRevision(), revision);
+    revision = scene.GetRevision();
+
+    EntityHandle other = scene.CreateEntity(MakeObject("Other"));
+    EXPECT_NE(scene.GetRevision(), revision);
+    revision = scene.GetRevision();
+    scene.SetParent(other, entity);
+    EXPECT_NE(scene.GetRevision(), revision);
+    revision = scene.GetRevision();
+    scene.DestroyEntity(other);
+    EXPECT_NE(scene.GetRevision(), revision);
+}
+
+TEST_F(SceneTests, RestoredSnapshotHasDifferentRevision) {
+    EntityHandle entity = scene.CreateEntity(MakeObject("Snapshot"));
+    const Scene snapshot = scene;
+    EXPECT_EQ(snapshot.GetRevision(), scene.GetRevision());
+
+    scene.TryGetMutable(entity)->position.x = 2.0f;
+    const uint64_t edited = scene.GetRevision();
+    scene = snapshot;
+    EXPECT_NE(scene.GetRevision(), edited);
+
+    Scene unrelated;
+    unrelated.CreateEntity(MakeObject("Unrelated"));
+    EXPECT_NE(unrelated.GetRevision(), scene.GetRevision());
+}
+
+}  // namespace Vest
@@ -179,4 +179,36 @@ TEST_F(SceneSerializerTests, RoundTripConsistency) {
     }
 }
 
+TEST_F(SceneSerializerTests, SceneRoundTripPreservesParents) {
+    Scene scene;
+    auto objects = CreateTestScene();
+    EntityHandle parent = scene.CreateEntity(objects[0]);
+    EntityHandle child = scene.CreateEntity(objects[1]);
+    ASSERT_TRUE(scene.SetParent(child, parent));
+
+    ASSERT_TRUE(SceneSerializer::Serialize(testFile, scene));
+
+    Scene loaded;
+    ASSERT_TRUE(SceneSerializer::Deserialize(testFile, loaded));
+    ASSERT_EQ(loaded.Size(), 2u);
+
+    EntityHandle loadedParent = loaded.FindEntityByName("TestObject1");
+    EntityHandle loadedChild = loaded.FindEntityByName("TestObject2");
+    ASSERT_FALSE(loadedParent.IsNull());
+    ASSERT_FALSE(loadedChild.IsNull());
+    EXPECT_EQ(loaded.GetParent(loadedChild), loadedParent);
+    EXPECT_TRUE(loaded.GetParent(loadedParent).IsNull());
+}
+
+TEST_F(SceneSerializerTests, SceneLoadsFilesWithoutParents) {
+    auto objects = CreateTestScene();
+    ASSERT_TRUE(SceneSerializer::Serialize(testFile, objects));
+
+    Scene loaded;
+    ASSERT_TRUE(SceneSerializer::Deserialize(testFile, loaded));
+    ASSERT_EQ(loaded.Size(), 2u);
+    EXPECT_TRUE(loaded.GetParent(loaded.GetHandleAt(0)).IsNull());
+    EXPECT_TRUE(loaded.GetParent(loaded.GetHandleAt(1)).IsNull());
+}
+
 }  // namespace Vest
@@ -8,5 +8,7 @@ int main(int argc, char** argv) {
     Vest::Log::Init();
     
     ::testing::InitGoogleTest(&argc, argv);
-    return RUN_ALL_TESTS();
+    const int result = RUN_ALL_TESTS();
+    Vest::Log::Shutdown();
+    return result;
 }
@@ -0,0 +1,88 @@
+// Offline decoder for binary logs written by BinaryLog (VEST_BINLOG).
+//
+// Prints one line per record, merged across threads in timestamp order,
+// either as text ("[seconds] [thread] message") or as JSON Lines with the
+// source location and raw arguments. Summary counts go to stderr.
+//
+// Usage: vest-logdecode [--json] <input.vbl> [output]
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Core/BinaryLogReader.h"
+#include "Core/Log.h"
+
+using namespace Vest;
+
+namespace {
+
+void PrintUsage() {
+    std::fprintf(stderr, "Usage: vest-logdecode [--json] <input.vbl> [output]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    bool json = false;
+    const char* input = nullptr;
+    const char* output = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0) {
+            PrintUsage();
+            return 0;
+        } else if (!input) {
+            input = argv[i];
+        } else if (!output) {
+            output = argv[i];
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (!input) {
+        PrintUsage();
+        return 1;
+    }
+
+    // Diagnostics only, on stderr: stdout may be the decoded output
+    LogConfig config;
+    config.async = false;
+    config.filePath.clear();
+    config.consoleToStderr = true;
+    Log::Init(config);
+    Log::GetCoreLogger()->set_level(spdlog::level::warn);
+
+    BinaryLogReader reader;
+    if (!reader.Load(input)) {
+        Log::Shutdown();
+        return 1;
+    }
+
+    std::ofstream file;
+    if (output) {
+        file.open(output);
+        if (!file) {
+            std::fprintf(stderr, "Failed to open %s for writing\n", output);
+            Log::Shutdown();
+            return 1;
+        }
+    }
+    std::ostream& out = output ? static_cast<std::ostream&>(file) : std::cout;
+
+    for (const BinaryLogEntry& entry : reader.GetEntries()) {
+        out << (json ? reader.FormatJson(entry) : reader.FormatText(entry)) << '\n';
+    }
+    out.flush();
+
+    std::fprintf(stderr, "%zu records, %zu sites, %llu dropped, %llu malformed%s\n", reader.GetEntries().size(),
+                 reader.GetSiteCount(), static_cast<unsigned long long>(reader.GetDroppedCount()),
+                 static_cast<unsigned long long>(reader.GetMalformedCount()),
+                 reader.IsTruncated() ? ", truncated" : "");
+    Log::Shutdown();
+    return 0;
+}
@@ -1,16 +1,25 @@
 #include "Core/Application.h"
 
+#include <algorithm>
 #include <cassert>
-#include <chrono>
 
 #include "Core/Event.h"
+#include "Core/FrameAllocator.h"
+#include "Core/Input.h"
+#include "Core/JobSystem.h"
 #include "Core/Log.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Profiler.h"
 #include "ImGui/ImGuiLayer.h"
+#include "Rendering/GPUResourceRegistry.h"
 #include "Rendering/RenderCommand.h"
+#include "Rendering/RenderThread.h"
 
 namespace Vest {
 
 Application* Application::s_Instance = nullptr;
+std::atomic<uint64_t> Application::s_WakeCount{0};
+std::atomic<bool> Application::s_WaitingForEvents{false};
 
 Application::Application(const std::string& name) {
     assert(!s_Instance && "Application already exists!");
@@ -20,54 +29,148 @@ Application::Application(const std::string& name) {
     Log::Init();
     VEST_CORE_INFO("VestEngine Application '{0}' starting...", name);
 
+    JobSystem::Init();
+    JobSystem::Get().SetDetachedCompletionCallback(&Application::Wake);
+
     WindowProps props;
     props.title = name;
     m_Window = Window::Create(props);
-    m_Window->SetEventCallback([this](Event& event) { OnEvent(event); });
     VEST_CORE_INFO("Window created: {0} ({1}x{2})", props.title, props.width, props.height);
 
-    Renderer::Init();
+    Renderer::Init(m_Window.get());
     VEST_CORE_INFO("Renderer initialized");
 
     m_ImGuiLayer = new ImGuiLayer();
     PushOverlay(m_ImGuiLayer);
 
+    // WindowsWindow::Init enables vsync; keep the pacer in agreement
+    SetFramePacing(m_Window->IsVSync() ? FramePacingMode::VSync : FramePacingMode::Uncapped);
+
     InitializeLayers();
+
+    // Create the resources queued by the layers before the first frame reads their IDs
+    RenderThread::Flush();
 }
 
 Application::~Application() {
     VEST_CORE_INFO("VestEngine Application shutting down...");
+    JobSystem::Shutdown();
+    // Layers release their GPU resources while the renderer can still free them
+    m_LayerStack.Clear();
+    m_ImGuiLayer = nullptr;
     Renderer::Shutdown();
+    GPUResourceRegistry::ReportLeaks();
     s_Instance = nullptr;
 }
 
 void Application::Run() {
     VEST_CORE_INFO("Entering main loop...");
-    auto lastTime = std::chrono::steady_clock::now();
+    Profiler::SetThreadName("Main");
 
     while (m_Running) {
-        auto now = std::chrono::steady_clock::now();
-        std::chrono::duration<float> delta = now - lastTime;
-        lastTime = now;
-
-        Timestep timestep(delta.count());
+        const bool woke = WaitWhileIdle();
+        Timestep timestep = m_FramePacer.BeginFrame();
+        if (woke) {
+            // Nothing should jump by the time spent asleep, and the sleep is not a slow frame
+            timestep = Timestep(std::min(timestep.GetSeconds(), 1.0f / 60.0f));
+        } else if (m_FramePacer.GetFrameCount() > 0) {
+            m_FrameStats.Add(m_FramePacer.GetLastFrame());
+        }
+        FrameAllocator::BeginFrame();
+        MemoryTracker::BeginFrame();
+        {
+            VEST_PROFILE_SCOPE("ProcessEvents");
+            ProcessEvents();
+        }
 
         if (!m_Minimized) {
+            VEST_PROFILE_SCOPE("OnUpdate");
             for (Layer* layer : m_LayerStack) {
+                VEST_PROFILE_SCOPE_DYNAMIC(layer->GetName());
                 layer->OnUpdate(timestep);
             }
         }
+        m_FramePacer.EndUpdate();
 
-        m_ImGuiLayer->Begin();
-        for (Layer* layer : m_LayerStack) {
-            layer->OnImGuiRender();
+        {
+            VEST_PROFILE_SCOPE("OnImGuiRender");
+            m_ImGuiLayer->Begin();
+            for (Layer* layer : m_LayerStack) {
+                VEST_PROFILE_SCOPE_DYNAMIC(layer->GetName());
+                layer->OnImGuiRender();
+            }
+            m_ImGuiLayer->End();
         }
-        m_ImGuiLayer->End();
+        m_FramePacer.EndImGui();
 
-        m_Window->OnUpdate();
+        {
+            VEST_PROFILE_SCOPE("Window::OnUpdate");
+            m_Window->OnUpdate();
+        }
+        m_FramePacer.EndWork();
+
+        {
+            // Frame N executes on the render thread while the next iteration builds N+1.
+            // With vsync this blocks on the previous frame's swap, which counts as waiting
+            VEST_PROFILE_SCOPE("Wait");
+            RenderThread::Kick();
+            m_FramePacer.EndFrame();
+        }
+        Profiler::EndFrame();
     }
 }
 
+void Application::SetFramePacing(FramePacingMode mode, double targetFps) {
+    m_FramePacer.SetMode(mode);
+    m_FramePacer.SetTargetFps(targetFps);
+    // The refresh rate is not queried, so vsync and uncapped are judged against 60 Hz
+    m_FrameStats.SetBudgetMs(1000.0 / (mode == FramePacingMode::FixedRate ? m_FramePacer.GetTargetFps()
+                                                                          : FramePacer::DefaultTargetFps));
+    m_Window->SetVSync(mode == FramePacingMode::VSync);
+}
+
+void Application::SetIdleMode(bool enabled, uint32_t idleFrames) {
+    m_IdleModeEnabled = enabled;
+    m_IdleFrameThreshold = std::max(idleFrames, 1u);
+    m_InactiveFrames = 0;
+}
+
+void Application::Wake() {
+    s_WakeCount.fetch_add(1, std::memory_order_seq_cst);
+    if (s_WaitingForEvents.load(std::memory_order_seq_cst) && s_Instance) {
+        s_Instance->m_Window->PostEmptyEvent();
+    }
+}
+
+bool Application::WaitWhileIdle() {
+    const uint64_t eventCount = m_Window->GetEventCount();
+    const uint64_t wakeCount = s_WakeCount.load(std::memory_order_seq_cst);
+    const bool active = m_FrameRequested || eventCount != m_LastEventCount || wakeCount != m_LastWakeCount;
+    m_FrameRequested = false;
+    m_LastEventCount = eventCount;
+    m_LastWakeCount = wakeCount;
+    m_InactiveFrames = active ? 0 : std::min(m_InactiveFrames + 1, m_IdleFrameThreshold);
+    if (!IsIdle()) {
+        return false;
+    }
+
+    // Publish the wait before re-checking, so a Wake() racing with it either
+    // is seen here or posts an event that ends the wait immediately
+    s_WaitingForEvents.store(true, std::memory_order_seq_cst);
+    if (s_WakeCount.load(std::memory_order_seq_cst) == m_LastWakeCount) {
+        m_Window->WaitEvents(IdleWaitTimeout);
+    }
+    s_WaitingForEvents.store(false, std::memory_order_seq_cst);
+
+    // Events handled while waiting are counted at the top of the next frame
+    return true;
+}
+
+void Application::ProcessEvents() {
+    Input::SetState(m_Window->TakeInputState());
+    m_Window->GetEventQueue().Drain([this](Event& event) { OnEvent(event); });
+}
+
 void Application::OnEvent(Event& event) {
     EventDispatcher dispatcher(event);
     dispatcher.Dispatch<WindowCloseEvent>([this](WindowCloseEvent& e) { return OnWindowClose(e); });
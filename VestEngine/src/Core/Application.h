@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 
+#include "Core/FramePacer.h"
+#include "Core/FrameStats.h"
 #include "Core/LayerStack.h"
 #include "Core/Timestep.h"
 #include "Core/Window.h"
@@ -24,6 +28,45 @@ public:
 
     Window& GetWindow() const { return *m_Window; }
 
+    /**
+     * @brief Switch pacing mode; also sets the window's swap interval
+     * @param targetFps Used by FramePacingMode::FixedRate
+     */
+    void SetFramePacing(FramePacingMode mode, double targetFps = FramePacer::DefaultTargetFps);
+    const FramePacer& GetFramePacer() const { return m_FramePacer; }
+
+    /**
+     * @brief Timing of recent frames; the budget follows the pacing target
+     */
+    FrameStats& GetFrameStats() { return m_FrameStats; }
+
+    /**
+     * @brief Let the main loop block on window events once nothing has happened for @p idleFrames frames
+     *
+     * While idle, a frame runs when an event arrives, Wake() is called or
+     * IdleWaitTimeout passes. Input, window events, RequestFrame() and
+     * Wake() count as activity; anything that animates must call
+     * RequestFrame() every frame it wants to keep running.
+     */
+    void SetIdleMode(bool enabled, uint32_t idleFrames = DefaultIdleFrames);
+    bool IsIdleModeEnabled() const { return m_IdleModeEnabled; }
+    bool IsIdle() const { return m_IdleModeEnabled && m_InactiveFrames >= m_IdleFrameThreshold; }
+
+    /**
+     * @brief Keep running at full rate for at least one more frame
+     */
+    void RequestFrame() { m_FrameRequested = true; }
+
+    /**
+     * @brief Wake an idle main loop; callable from any thread (file watchers, async jobs)
+     *
+     * Detached JobSystem jobs call this automatically when they finish.
+     */
+    static void Wake();
+
+    static constexpr uint32_t DefaultIdleFrames = 60;
+    static constexpr double IdleWaitTimeout = 0.5;
+
     static Application& Get() { return *s_Instance; }
 
 protected:
@@ -33,14 +76,30 @@ private:
     bool OnWindowClose(WindowCloseEvent& event);
     bool OnWindowResize(WindowResizeEvent& event);
 
+    // Takes this frame's input snapshot and dispatches the queued window events
+    void ProcessEvents();
+
+    // Counts inactive frames and blocks on window events once idle; true if it waited
+    bool WaitWhileIdle();
+
     Scope<Window> m_Window;
     bool m_Running = true;
     bool m_Minimized = false;
     LayerStack m_LayerStack;
     ImGuiLayer* m_ImGuiLayer = nullptr;
-    float m_LastFrameTime = 0.0f;
+    FramePacer m_FramePacer;
+    FrameStats m_FrameStats;
+
+    bool m_IdleModeEnabled = false;
+    uint32_t m_IdleFrameThreshold = DefaultIdleFrames;
+    uint32_t m_InactiveFrames = 0;
+    bool m_FrameRequested = false;
+    uint64_t m_LastEventCount = 0;
+    uint64_t m_LastWakeCount = 0;
 
     static Application* s_Instance;
+    static std::atomic<uint64_t> s_WakeCount;
+    static std::atomic<bool> s_WaitingForEvents;
 };
 
 Application* CreateApplication();
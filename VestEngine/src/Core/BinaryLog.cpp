@@ -0,0 +1,317 @@
+#include "Core/BinaryLog.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+std::atomic<bool> BinaryLog::s_Enabled{false};
+
+namespace {
+
+constexpr size_t RingMask = BinaryLog::RingCapacity - 1;
+static_assert((BinaryLog::RingCapacity & RingMask) == 0, "Ring capacity must be a power of two");
+
+/**
+ * @brief Single-producer, single-consumer byte ring
+ *
+ * The owning thread pushes whole records; the writer drains every committed
+ * byte. Positions grow monotonically and are masked on access.
+ */
+class Ring {
+public:
+    Ring() : m_Data(std::make_unique<uint8_t[]>(BinaryLog::RingCapacity)) {}
+
+    void Push(const uint8_t* data, size_t size) {
+        const uint64_t head = m_Head.load(std::memory_order_relaxed);
+        const uint64_t tail = m_Tail.load(std::memory_order_acquire);
+        if (BinaryLog::RingCapacity - (head - tail) < size) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const size_t offset = static_cast<size_t>(head & RingMask);
+        const size_t first = std::min(size, BinaryLog::RingCapacity - offset);
+        std::memcpy(m_Data.get() + offset, data, first);
+        std::memcpy(m_Data.get(), data + first, size - first);
+        m_Head.store(head + size, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pass every committed byte to @p consume in at most two spans and release them
+     */
+    template <typename F>
+    void Drain(F&& consume) {
+        const uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+        const uint64_t head = m_Head.load(std::memory_order_acquire);
+        const size_t size = static_cast<size_t>(head - tail);
+        if (size == 0) {
+            return;
+        }
+        const size_t offset = static_cast<size_t>(tail & RingMask);
+        const size_t first = std::min(size, BinaryLog::RingCapacity - offset);
+        consume(m_Data.get() + offset, first);
+        if (size > first) {
+            consume(m_Data.get(), size - first);
+        }
+        m_Tail.store(head, std::memory_order_release);
+    }
+
+    uint64_t TakeDropped() { return m_Dropped.exchange(0, std::memory_order_relaxed); }
+    uint64_t PeekDropped() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<uint8_t[]> m_Data;
+    alignas(64) std::atomic<uint64_t> m_Head{0};
+    alignas(64) std::atomic<uint64_t> m_Tail{0};
+    std::atomic<uint64_t> m_Dropped{0};
+};
+
+struct ThreadRing {
+    uint32_t thread = 0;
+    Ring ring;
+};
+
+template <typename T>
+void Append(std::vector<uint8_t>& out, T value) {
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>& out, const char* text) {
+    const size_t length = std::min(std::strlen(text), size_t(UINT16_MAX));
+    Append(out, static_cast<uint16_t>(length));
+    out.insert(out.end(), text, text + length);
+}
+
+struct State {
+    std::mutex sitesMutex;
+    std::vector<BinaryLogSite> sites;
+
+    // Never shrinks: threads keep a raw pointer to their ring for the life of the process
+    std::mutex ringsMutex;
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+
+    // Everything below is owned by whoever holds writerMutex
+    std::mutex writerMutex;
+    std::ofstream file;
+    size_t sitesWritten = 0;
+    uint64_t dropped = 0;
+    std::vector<uint8_t> chunk;
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool stop = false;
+    std::thread writer;
+
+    ~State() { StopWriter(); }
+
+    void StopWriter() {
+        if (!writer.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stop = true;
+        }
+        wake.notify_one();
+        writer.join();
+    }
+
+    std::vector<ThreadRing*> GetRings() {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        std::vector<ThreadRing*> result;
+        result.reserve(rings.size());
+        for (const auto& ring : rings) {
+            result.push_back(ring.get());
+        }
+        return result;
+    }
+
+    // Requires writerMutex and an open file
+    void Drain() {
+        chunk.clear();
+        {
+            std::lock_guard<std::mutex> lock(sitesMutex);
+            for (; sitesWritten < sites.size(); ++sitesWritten) {
+                const BinaryLogSite& site = sites[sitesWritten];
+                Append(chunk, BinaryLogFormat::ChunkKind::Site);
+                Append(chunk, site.id);
+                Append(chunk, site.line);
+                Append(chunk, static_cast<uint8_t>(site.args.size()));
+                for (BinaryLogArg arg : site.args) {
+                    Append(chunk, arg);
+                }
+                AppendString(chunk, site.format);
+                AppendString(chunk, site.file);
+            }
+        }
+
+        for (ThreadRing* threadRing : GetRings()) {
+            if (const uint64_t lost = threadRing->ring.TakeDropped()) {
+                dropped += lost;
+                Append(chunk, BinaryLogFormat::ChunkKind::Dropped);
+                Append(chunk, threadRing->thread);
+                Append(chunk, lost);
+            }
+
+            const size_t header = chunk.size();
+            Append(chunk, BinaryLogFormat::ChunkKind::Records);
+            Append(chunk, threadRing->thread);
+            Append(chunk, uint32_t(0));
+            threadRing->ring.Drain(
+                [this](const uint8_t* data, size_t size) { chunk.insert(chunk.end(), data, data + size); });
+
+            const size_t bytes = chunk.size() - header - (1 + 2 * sizeof(uint32_t));
+            if (bytes == 0) {
+                chunk.resize(header);
+            } else {
+                const uint32_t count = static_cast<uint32_t>(bytes);
+                std::memcpy(chunk.data() + header + 1 + sizeof(uint32_t), &count, sizeof(count));
+            }
+        }
+
+        if (!chunk.empty()) {
+            file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+            file.flush();
+        }
+    }
+
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        while (!stop) {
+            wake.wait_for(lock, BinaryLog::DrainInterval, [this]() { return stop; });
+            lock.unlock();
+            {
+                std::lock_guard<std::mutex> writerLock(writerMutex);
+                if (file.is_open()) {
+                    Drain();
+                }
+            }
+            lock.lock();
+        }
+    }
+};
+
+State& GetState() {
+    // Function-local so call sites can register from any translation unit's static initializers
+    static State state;
+    return state;
+}
+
+thread_local ThreadRing* t_Ring = nullptr;
+
+ThreadRing* RegisterThread() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.ringsMutex);
+    auto ring = std::make_unique<ThreadRing>();
+    ring->thread = static_cast<uint32_t>(state.rings.size());
+    state.rings.push_back(std::move(ring));
+    return state.rings.back().get();
+}
+
+}  // namespace
+
+bool BinaryLog::Open(const std::filesystem::path& path) {
+    Close();
+
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.writerMutex);
+    state.file.open(path, std::ios::binary | std::ios::trunc);
+    if (!state.file) {
+        VEST_CORE_ERROR("Failed to open binary log {0}", path.string());
+        return false;
+    }
+
+    // Records left over from before the last Close() belong to no file
+    for (ThreadRing* threadRing : state.GetRings()) {
+        threadRing->ring.Drain([](const uint8_t*, size_t) {});
+        threadRing->ring.TakeDropped();
+    }
+    state.sitesWritten = 0;
+    state.dropped = 0;
+
+    BinaryLogFormat::FileHeader header;
+    std::memcpy(header.magic, BinaryLogFormat::Magic, sizeof(header.magic));
+    header.version = BinaryLogFormat::Version;
+    header.steadyOriginNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    header.systemOriginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+    state.file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    state.stop = false;
+    state.writer = std::thread([&state]() { state.WriterLoop(); });
+    s_Enabled.store(true, std::memory_order_relaxed);
+    VEST_CORE_INFO("Binary log opened: {0}", path.string());
+    return true;
+}
+
+void BinaryLog::Close() {
+    State& state = GetState();
+    s_Enabled.store(false, std::memory_order_relaxed);
+    state.StopWriter();
+
+    std::lock_guard<std::mutex> lock(state.writerMutex);
+    if (!state.file.is_open()) {
+        return;
+    }
+    state.Drain();
+    state.file.close();
+    if (state.dropped > 0) {
+        VEST_CORE_WARN("Binary log dropped {0} records to full thread rings", state.dropped);
+    }
+}
+
+void BinaryLog::Flush() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.writerMutex);
+    if (state.file.is_open()) {
+        state.Drain();
+    }
+}
+
+uint64_t BinaryLog::GetDroppedCount() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.writerMutex);
+    uint64_t dropped = state.dropped;
+    for (ThreadRing* threadRing : state.GetRings()) {
+        dropped += threadRing->ring.PeekDropped();
+    }
+    return dropped;
+}
+
+uint32_t BinaryLog::RegisterSite(const char* format, const char* file, uint32_t line,
+                                 std::initializer_list<BinaryLogArg> args) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.sitesMutex);
+    BinaryLogSite site;
+    site.id = static_cast<uint32_t>(state.sites.size() + 1);
+    site.format = format;
+    site.file = file;
+    site.line = line;
+    site.args.assign(args.begin(), args.end());
+    state.sites.push_back(std::move(site));
+    return state.sites.back().id;
+}
+
+std::vector<BinaryLogSite> BinaryLog::GetSites() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.sitesMutex);
+    return state.sites;
+}
+
+void BinaryLog::Commit(const uint8_t* record, size_t size) {
+    if (!t_Ring) {
+        t_Ring = RegisterThread();
+    }
+    t_Ring->ring.Push(record, size);
+}
+
+}  // namespace Vest
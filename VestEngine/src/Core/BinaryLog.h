@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Set to 0 to compile every VEST_BINLOG call site out
+#ifndef VEST_BINLOG_ENABLED
+#define VEST_BINLOG_ENABLED 1
+#endif
+
+namespace Vest {
+
+/**
+ * @brief How an argument is stored in a binary log record
+ *
+ * Integers narrower than 32 bits, bools and enums are widened, everything
+ * convertible to std::string_view is copied as a length-prefixed string and
+ * other pointers are stored as their address.
+ */
+enum class BinaryLogArg : uint8_t { Bool = 0, Int32, UInt32, Int64, UInt64, Float, Double, String, Pointer };
+
+/**
+ * @brief A registered VEST_BINLOG call site
+ */
+struct BinaryLogSite {
+    uint32_t id = 0;
+    const char* format = "";
+    const char* file = "";
+    uint32_t line = 0;
+    std::vector<BinaryLogArg> args;
+};
+
+namespace BinaryLogFormat {
+
+// File layout: FileHeader, then a sequence of chunks each starting with a ChunkKind byte.
+//   Site:    u32 id, u32 line, u8 argCount, argCount x u8 BinaryLogArg,
+//            u16 formatLength, format, u16 fileLength, file
+//   Records: u32 thread, u32 byteCount, byteCount bytes of records
+//   Dropped: u32 thread, u64 records lost to a full ring since the last report
+// A record is a RecordHeader followed by `size` bytes of arguments in call order:
+// fixed-size values as raw little-endian bytes, strings as u16 length + bytes.
+constexpr char Magic[4] = {'V', 'B', 'L', 'G'};
+constexpr uint32_t Version = 1;
+
+enum class ChunkKind : uint8_t { Site = 1, Records = 2, Dropped = 3 };
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    int64_t steadyOriginNs;  // BinaryLog::Clock when the file was opened, same epoch as record timestamps
+    int64_t systemOriginNs;  // system_clock at the same moment, nanoseconds since the Unix epoch
+};
+
+struct RecordHeader {
+    uint32_t siteId;
+    uint32_t size;  // Argument bytes following the header
+    uint64_t timestampNs;
+};
+
+constexpr size_t MaxRecordSize = 512;
+constexpr size_t MaxPayloadSize = MaxRecordSize - sizeof(RecordHeader);
+
+}  // namespace BinaryLogFormat
+
+/**
+ * @brief Low-overhead binary log channel for high-frequency engine events
+ *
+ * Each VEST_BINLOG call site registers its format string, source location
+ * and argument types once during static initialization. At runtime a call
+ * only copies a site ID, a timestamp and the raw argument bytes into a
+ * lock-free ring owned by the calling thread; nothing is formatted. A
+ * background thread drains the rings into the file opened with Open(), and
+ * vest-logdecode (or BinaryLogReader) turns that file into text or JSON.
+ *
+ * When no file is open a call costs one relaxed atomic load and its
+ * arguments are not evaluated. When a thread's ring is full its records
+ * are dropped and counted, never blocked on.
+ */
+class BinaryLog {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t RingCapacity = size_t(1) << 18;  // Bytes per thread
+    static constexpr size_t MaxStringLength = 255;
+    static constexpr std::chrono::milliseconds DrainInterval{20};
+
+    /**
+     * @brief Start writing to @p path, truncating it; closes any file already open
+     * @return false if the file could not be created
+     */
+    static bool Open(const std::filesystem::path& path);
+
+    /**
+     * @brief Write everything still queued, stop the background thread and close the file
+     */
+    static void Close();
+
+    /**
+     * @brief Write everything queued so far to the file before returning
+     */
+    static void Flush();
+
+    static bool IsOpen() { return s_Enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records dropped because a thread's ring was full, since Open()
+     */
+    static uint64_t GetDroppedCount();
+
+    /**
+     * @brief Register a call site; done by VEST_BINLOG during static initialization
+     * @return The site's ID, never 0
+     */
+    static uint32_t RegisterSite(const char* format, const char* file, uint32_t line,
+                                 std::initializer_list<BinaryLogArg> args);
+
+    /**
+     * @brief Copy of every registered site, ordered by ID
+     */
+    static std::vector<BinaryLogSite> GetSites();
+
+    /**
+     * @brief Append one record to the calling thread's ring; use VEST_BINLOG rather than calling this
+     */
+    template <typename Site, typename... Args>
+    static void Write(const Args&... args);
+
+private:
+    static void Commit(const uint8_t* record, size_t size);
+
+    static std::atomic<bool> s_Enabled;
+};
+
+namespace BinaryLogDetail {
+
+template <typename>
+inline constexpr bool AlwaysFalse = false;
+
+template <typename T>
+constexpr BinaryLogArg ArgType() {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        return BinaryLogArg::Bool;
+    } else if constexpr (std::is_enum_v<U>) {
+        return ArgType<std::underlying_type_t<U>>();
+    } else if constexpr (std::is_integral_v<U>) {
+        if constexpr (std::is_signed_v<U>) {
+            return sizeof(U) <= 4 ? BinaryLogArg::Int32 : BinaryLogArg::Int64;
+        } else {
+            return sizeof(U) <= 4 ? BinaryLogArg::UInt32 : BinaryLogArg::UInt64;
+        }
+    } else if constexpr (std::is_same_v<U, float>) {
+        return BinaryLogArg::Float;
+    } else if constexpr (std::is_same_v<U, double>) {
+        return BinaryLogArg::Double;
+    } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+        return BinaryLogArg::String;
+    } else if constexpr (std::is_pointer_v<U>) {
+        return BinaryLogArg::Pointer;
+    } else {
+        static_assert(AlwaysFalse<U>, "VEST_BINLOG arguments must be arithmetic, enums, strings or pointers");
+    }
+}
+
+template <typename T>
+constexpr size_t FixedSize() {
+    switch (ArgType<T>()) {
+        case BinaryLogArg::String:
+            return sizeof(uint16_t);
+        case BinaryLogArg::Int64:
+        case BinaryLogArg::UInt64:
+        case BinaryLogArg::Double:
+        case BinaryLogArg::Pointer:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+// Fixed-size arguments and string length prefixes; string contents get whatever room is left
+template <typename... Args>
+constexpr size_t FixedPayloadSize() {
+    return (size_t(0) + ... + FixedSize<Args>());
+}
+
+/**
+ * @brief Appends arguments to a record's payload, truncating strings to keep room for the rest
+ */
+class Encoder {
+public:
+    Encoder(uint8_t* data, size_t reserved) : m_Data(data), m_Reserved(reserved) {}
+
+    template <typename T>
+    void Put(const T& value) {
+        constexpr BinaryLogArg type = ArgType<T>();
+        if constexpr (type == BinaryLogArg::String) {
+            const std::string_view text(value);
+            const size_t available = BinaryLogFormat::MaxPayloadSize - m_Size - m_Reserved;
+            const uint16_t length =
+                static_cast<uint16_t>(std::min(text.size(), std::min(BinaryLog::MaxStringLength, available)));
+            Raw(length);
+            std::memcpy(m_Data + m_Size, text.data(), length);
+            m_Size += length;
+        } else if constexpr (type == BinaryLogArg::Pointer) {
+            Raw(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        } else if constexpr (type == BinaryLogArg::Bool) {
+            Raw(static_cast<uint32_t>(value ? 1 : 0));
+        } else if constexpr (type == BinaryLogArg::Int32) {
+            Raw(static_cast<int32_t>(value));
+        } else if constexpr (type == BinaryLogArg::UInt32) {
+            Raw(static_cast<uint32_t>(value));
+        } else if constexpr (type == BinaryLogArg::Int64) {
+            Raw(static_cast<int64_t>(value));
+        } else if constexpr (type == BinaryLogArg::UInt64) {
+            Raw(static_cast<uint64_t>(value));
+        } else {
+            Raw(value);
+        }
+    }
+
+    size_t GetSize() const { return m_Size; }
+
+private:
+    template <typename T>
+    void Raw(T value) {
+        std::memcpy(m_Data + m_Size, &value, sizeof(T));
+        m_Size += sizeof(T);
+        m_Reserved -= sizeof(T);
+    }
+
+    uint8_t* m_Data;
+    size_t m_Size = 0;
+    size_t m_Reserved;  // Bytes still needed by the fixed parts of the arguments not yet written
+};
+
+/**
+ * @brief Registers one call site (per argument type list) before main()
+ *
+ * Static data members of class template specializations are initialized
+ * during static initialization, so every site that is compiled in appears
+ * in the file's site table even if it never fires. A call that runs before
+ * its own registration (from another static initializer) sees ID 0 and is
+ * discarded.
+ */
+template <typename Site, typename... Args>
+struct SiteRegistration {
+    static const uint32_t id;
+};
+
+template <typename Site, typename... Args>
+const uint32_t SiteRegistration<Site, Args...>::id =
+    BinaryLog::RegisterSite(Site::Format(), Site::File(), Site::Line(), {ArgType<Args>()...});
+
+}  // namespace BinaryLogDetail
+
+template <typename Site, typename... Args>
+void BinaryLog::Write(const Args&... args) {
+    static_assert(BinaryLogDetail::FixedPayloadSize<Args...>() <= BinaryLogFormat::MaxPayloadSize,
+                  "Too many VEST_BINLOG arguments for one record");
+    const uint32_t id = BinaryLogDetail::SiteRegistration<Site, std::decay_t<Args>...>::id;
+    if (id == 0) {
+        return;
+    }
+
+    uint8_t record[BinaryLogFormat::MaxRecordSize];
+    BinaryLogDetail::Encoder encoder(record + sizeof(BinaryLogFormat::RecordHeader),
+                                     BinaryLogDetail::FixedPayloadSize<Args...>());
+    (encoder.Put(args), ...);
+
+    BinaryLogFormat::RecordHeader header;
+    header.siteId = id;
+    header.size = static_cast<uint32_t>(encoder.GetSize());
+    header.timestampNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+    std::memcpy(record, &header, sizeof(header));
+    Commit(record, sizeof(header) + encoder.GetSize());
+}
+
+}  // namespace Vest
+
+#if VEST_BINLOG_ENABLED
+/**
+ * @brief Log a high-frequency event to the binary log: VEST_BINLOG("Drew {0} indices", count)
+ *
+ * @p format must be a string literal using fmt syntax; it is formatted
+ * offline by the decoder, never at the call site.
+ */
+#define VEST_BINLOG(format, ...)                                                    \
+    do {                                                                            \
+        struct VestBinaryLogSite {                                                  \
+            static constexpr const char* Format() { return format; }                \
+            static constexpr const char* File() { return __FILE__; }                \
+            static constexpr uint32_t Line() { return __LINE__; }                   \
+        };                                                                          \
+        if (::Vest::BinaryLog::IsOpen()) {                                          \
+            ::Vest::BinaryLog::Write<VestBinaryLogSite>(__VA_ARGS__);               \
+        }                                                                           \
+    } while (0)
+#else
+#define VEST_BINLOG(format, ...) static_cast<void>(0)
+#endif
@@ -0,0 +1,370 @@
+#include "Core/BinaryLogReader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <spdlog/fmt/fmt.h>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+namespace {
+
+/**
+ * @brief Bounds-checked little-endian cursor over a byte range
+ */
+class Cursor {
+public:
+    Cursor(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        if (m_Size - m_Offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+        m_Offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value) {
+        uint16_t length = 0;
+        if (!Read(length) || m_Size - m_Offset < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(m_Data + m_Offset), length);
+        m_Offset += length;
+        return true;
+    }
+
+    bool Skip(size_t bytes) {
+        if (m_Size - m_Offset < bytes) {
+            return false;
+        }
+        m_Offset += bytes;
+        return true;
+    }
+
+    const uint8_t* GetPosition() const { return m_Data + m_Offset; }
+    size_t GetRemaining() const { return m_Size - m_Offset; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Offset = 0;
+};
+
+bool ReadValue(Cursor& cursor, BinaryLogArg type, BinaryLogValue& value) {
+    switch (type) {
+        case BinaryLogArg::Bool: {
+            uint32_t raw = 0;
+            return cursor.Read(raw) && (value = raw != 0, true);
+        }
+        case BinaryLogArg::Int32: {
+            int32_t raw = 0;
+            return cursor.Read(raw) && (value = static_cast<int64_t>(raw), true);
+        }
+        case BinaryLogArg::UInt32: {
+            uint32_t raw = 0;
+            return cursor.Read(raw) && (value = static_cast<uint64_t>(raw), true);
+        }
+        case BinaryLogArg::Int64: {
+            int64_t raw = 0;
+            return cursor.Read(raw) && (value = raw, true);
+        }
+        case BinaryLogArg::UInt64:
+        case BinaryLogArg::Pointer: {
+            uint64_t raw = 0;
+            return cursor.Read(raw) && (value = raw, true);
+        }
+        case BinaryLogArg::Float: {
+            float raw = 0.0f;
+            return cursor.Read(raw) && (value = static_cast<double>(raw), true);
+        }
+        case BinaryLogArg::Double: {
+            double raw = 0.0;
+            return cursor.Read(raw) && (value = raw, true);
+        }
+        case BinaryLogArg::String: {
+            std::string raw;
+            return cursor.ReadString(raw) && (value = std::move(raw), true);
+        }
+    }
+    return false;
+}
+
+// Format one argument with an fmt replacement field's spec ("" or ":...")
+std::string FormatValue(const BinaryLogValue& value, BinaryLogArg type, const std::string& spec) {
+    if (type == BinaryLogArg::Pointer && spec.empty()) {
+        return fmt::format("{:#x}", std::get<uint64_t>(value));
+    }
+    try {
+        return std::visit([&spec](const auto& v) { return fmt::format(fmt::runtime("{" + spec + "}"), v); }, value);
+    } catch (const fmt::format_error&) {
+        // A spec that does not suit the stored type (e.g. precision on an integer)
+        return std::visit([](const auto& v) { return fmt::format("{}", v); }, value);
+    }
+}
+
+void AppendJsonString(std::string& out, const std::string& text) {
+    out += '"';
+    for (const char c : text) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+}  // namespace
+
+void BinaryLogReader::Clear() {
+    m_Sites.clear();
+    m_Entries.clear();
+    m_SteadyOriginNs = 0;
+    m_SystemOriginNs = 0;
+    m_Dropped = 0;
+    m_Malformed = 0;
+    m_Truncated = false;
+}
+
+bool BinaryLogReader::Load(const std::filesystem::path& path) {
+    Clear();
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        VEST_CORE_ERROR("Failed to open binary log {0}", path.string());
+        return false;
+    }
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Cursor cursor(bytes.data(), bytes.size());
+    BinaryLogFormat::FileHeader header;
+    if (!cursor.Read(header) || std::memcmp(header.magic, BinaryLogFormat::Magic, sizeof(header.magic)) != 0) {
+        VEST_CORE_ERROR("{0} is not a binary log", path.string());
+        return false;
+    }
+    if (header.version != BinaryLogFormat::Version) {
+        VEST_CORE_ERROR("Binary log {0} has unsupported version {1}", path.string(), header.version);
+        return false;
+    }
+    m_SteadyOriginNs = header.steadyOriginNs;
+    m_SystemOriginNs = header.systemOriginNs;
+
+    // Sites can follow the records that use them, so collect record chunks and decode them afterwards
+    struct RecordChunk {
+        uint32_t thread;
+        const uint8_t* data;
+        size_t size;
+    };
+    std::vector<RecordChunk> chunks;
+
+    while (cursor.GetRemaining() > 0 && !m_Truncated) {
+        BinaryLogFormat::ChunkKind kind;
+        cursor.Read(kind);
+        switch (kind) {
+            case BinaryLogFormat::ChunkKind::Site: {
+                BinaryLogSiteInfo site;
+                uint8_t argCount = 0;
+                bool complete = cursor.Read(site.id) && cursor.Read(site.line) && cursor.Read(argCount);
+                for (uint8_t i = 0; complete && i < argCount; ++i) {
+                    BinaryLogArg arg{};
+                    complete = cursor.Read(arg);
+                    if (complete) {
+                        site.args.push_back(arg);
+                    }
+                }
+                complete = complete && cursor.ReadString(site.format) && cursor.ReadString(site.file);
+                if (complete) {
+                    m_Sites[site.id] = std::move(site);
+                } else {
+                    m_Truncated = true;
+                }
+                break;
+            }
+            case BinaryLogFormat::ChunkKind::Records: {
+                RecordChunk chunk;
+                uint32_t size = 0;
+                if (cursor.Read(chunk.thread) && cursor.Read(size) && cursor.GetRemaining() >= size) {
+                    chunk.data = cursor.GetPosition();
+                    chunk.size = size;
+                    chunks.push_back(chunk);
+                    cursor.Skip(size);
+                } else {
+                    m_Truncated = true;
+                }
+                break;
+            }
+            case BinaryLogFormat::ChunkKind::Dropped: {
+                uint32_t thread = 0;
+                uint64_t count = 0;
+                if (cursor.Read(thread) && cursor.Read(count)) {
+                    m_Dropped += count;
+                } else {
+                    m_Truncated = true;
+                }
+                break;
+            }
+            default:
+                // Chunk sizes are implicit, so nothing after an unknown chunk can be trusted
+                ++m_Malformed;
+                m_Truncated = true;
+                break;
+        }
+    }
+    if (m_Truncated) {
+        VEST_CORE_WARN("Binary log {0} ends with an incomplete chunk", path.string());
+    }
+
+    for (const RecordChunk& chunk : chunks) {
+        if (!DecodeRecords(chunk.thread, chunk.data, chunk.size)) {
+            ++m_Malformed;
+        }
+    }
+
+    // Each thread's records are already in order; merging keeps equal timestamps per thread stable
+    std::stable_sort(m_Entries.begin(), m_Entries.end(),
+                     [](const BinaryLogEntry& a, const BinaryLogEntry& b) { return a.timeNs < b.timeNs; });
+    return true;
+}
+
+bool BinaryLogReader::DecodeRecords(uint32_t thread, const uint8_t* data, size_t size) {
+    Cursor cursor(data, size);
+    while (cursor.GetRemaining() > 0) {
+        BinaryLogFormat::RecordHeader header;
+        if (!cursor.Read(header) || cursor.GetRemaining() < header.size) {
+            return false;
+        }
+        Cursor payload(cursor.GetPosition(), header.size);
+        cursor.Skip(header.size);
+
+        const BinaryLogSiteInfo* site = FindSite(header.siteId);
+        if (!site) {
+            ++m_Malformed;
+            continue;
+        }
+
+        BinaryLogEntry entry;
+        entry.timeNs = static_cast<uint64_t>(static_cast<int64_t>(header.timestampNs) - m_SteadyOriginNs);
+        entry.thread = thread;
+        entry.siteId = header.siteId;
+        entry.args.resize(site->args.size());
+        bool valid = true;
+        for (size_t i = 0; valid && i < site->args.size(); ++i) {
+            valid = ReadValue(payload, site->args[i], entry.args[i]);
+        }
+        if (!valid) {
+            ++m_Malformed;
+            continue;
+        }
+        m_Entries.push_back(std::move(entry));
+    }
+    return true;
+}
+
+const BinaryLogSiteInfo* BinaryLogReader::FindSite(uint32_t id) const {
+    const auto it = m_Sites.find(id);
+    return it != m_Sites.end() ? &it->second : nullptr;
+}
+
+std::string BinaryLogReader::FormatMessage(const BinaryLogEntry& entry) const {
+    const BinaryLogSiteInfo* site = FindSite(entry.siteId);
+    if (!site) {
+        return fmt::format("<unknown site {0}>", entry.siteId);
+    }
+
+    const std::string& format = site->format;
+    std::string message;
+    message.reserve(format.size() + 16 * entry.args.size());
+    size_t nextArg = 0;
+    for (size_t i = 0; i < format.size(); ++i) {
+        const char c = format[i];
+        if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+            message += c;
+            ++i;
+            continue;
+        }
+        const size_t close = c == '{' ? format.find('}', i) : std::string::npos;
+        if (close == std::string::npos) {
+            message += c;
+            continue;
+        }
+
+        // {}, {N}, {:spec} or {N:spec}
+        const std::string field = format.substr(i + 1, close - i - 1);
+        const size_t colon = field.find(':');
+        const std::string index = field.substr(0, colon);
+        const std::string spec = colon == std::string::npos ? "" : field.substr(colon);
+        size_t arg = nextArg++;
+        if (!index.empty()) {
+            const bool numeric = index.size() <= 3 && index.find_first_not_of("0123456789") == std::string::npos;
+            arg = numeric ? std::stoul(index) : entry.args.size();
+        }
+        message += arg < entry.args.size() ? FormatValue(entry.args[arg], site->args[arg], spec) : "{?}";
+        i = close;
+    }
+    return message;
+}
+
+std::string BinaryLogReader::FormatText(const BinaryLogEntry& entry) const {
+    return fmt::format("[{0:12.6f}] [{1}] {2}", static_cast<double>(entry.timeNs) * 1.0e-9, entry.thread,
+                       FormatMessage(entry));
+}
+
+std::string BinaryLogReader::FormatJson(const BinaryLogEntry& entry) const {
+    const BinaryLogSiteInfo* site = FindSite(entry.siteId);
+    std::string json = fmt::format("{{\"time_ns\":{0},\"thread\":{1},\"site\":{2},", entry.timeNs, entry.thread,
+                                   entry.siteId);
+    json += "\"file\":";
+    AppendJsonString(json, site ? site->file : std::string());
+    json += fmt::format(",\"line\":{0},\"message\":", site ? site->line : 0);
+    AppendJsonString(json, FormatMessage(entry));
+    json += ",\"args\":[";
+    for (size_t i = 0; i < entry.args.size(); ++i) {
+        if (i > 0) {
+            json += ',';
+        }
+        std::visit(
+            [&json](const auto& value) {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, std::string>) {
+                    AppendJsonString(json, value);
+                } else if constexpr (std::is_same_v<T, bool>) {
+                    json += value ? "true" : "false";
+                } else if constexpr (std::is_same_v<T, double>) {
+                    // JSON has no NaN or infinity
+                    json += std::isfinite(value) ? fmt::format("{}", value) : "null";
+                } else {
+                    json += fmt::format("{}", value);
+                }
+            },
+            entry.args[i]);
+    }
+    json += "]}";
+    return json;
+}
+
+}  // namespace Vest
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "Core/BinaryLog.h"
+
+namespace Vest {
+
+using BinaryLogValue = std::variant<bool, int64_t, uint64_t, double, std::string>;
+
+/**
+ * @brief One decoded VEST_BINLOG call
+ */
+struct BinaryLogEntry {
+    uint64_t timeNs = 0;  // Since the file was opened
+    uint32_t thread = 0;  // Order in which threads first logged, starting at 0
+    uint32_t siteId = 0;
+    std::vector<BinaryLogValue> args;
+};
+
+/**
+ * @brief Call site as stored in a binary log file
+ */
+struct BinaryLogSiteInfo {
+    uint32_t id = 0;
+    std::string format;
+    std::string file;
+    uint32_t line = 0;
+    std::vector<BinaryLogArg> args;
+};
+
+/**
+ * @brief Reads a file written by BinaryLog and formats its records offline
+ *
+ * Entries from all threads are merged in timestamp order. A file cut short
+ * (the process died mid-write) loads up to its last complete chunk.
+ */
+class BinaryLogReader {
+public:
+    /**
+     * @return false if the file is missing or is not a binary log of a supported version
+     */
+    bool Load(const std::filesystem::path& path);
+
+    const std::vector<BinaryLogEntry>& GetEntries() const { return m_Entries; }
+    const BinaryLogSiteInfo* FindSite(uint32_t id) const;
+    size_t GetSiteCount() const { return m_Sites.size(); }
+
+    /**
+     * @brief Records the writer dropped because a ring was full
+     */
+    uint64_t GetDroppedCount() const { return m_Dropped; }
+
+    /**
+     * @brief Records or chunks that could not be decoded
+     */
+    uint64_t GetMalformedCount() const { return m_Malformed; }
+
+    bool IsTruncated() const { return m_Truncated; }
+
+    /**
+     * @brief Wall-clock time the file was opened, nanoseconds since the Unix epoch
+     */
+    int64_t GetSystemOriginNs() const { return m_SystemOriginNs; }
+
+    /**
+     * @brief The entry's message with its arguments substituted into the site's format string
+     */
+    std::string FormatMessage(const BinaryLogEntry& entry) const;
+
+    /**
+     * @brief "[seconds] [thread] message"
+     */
+    std::string FormatText(const BinaryLogEntry& entry) const;
+
+    /**
+     * @brief One JSON object per entry, without a trailing newline
+     */
+    std::string FormatJson(const BinaryLogEntry& entry) const;
+
+private:
+    void Clear();
+    bool DecodeRecords(uint32_t thread, const uint8_t* data, size_t size);
+
+    std::unordered_map<uint32_t, BinaryLogSiteInfo> m_Sites;
+    std::vector<BinaryLogEntry> m_Entries;
+    int64_t m_SteadyOriginNs = 0;
+    int64_t m_SystemOriginNs = 0;
+    uint64_t m_Dropped = 0;
+    uint64_t m_Malformed = 0;
+    bool m_Truncated = false;
+};
+
+}  // namespace Vest
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "Core/Base.h"
+
+namespace Vest {
+
+/**
+ * @brief Growable array stored in reference-counted, copy-on-write chunks
+ *
+ * Copying the container only copies chunk pointers, so a snapshot costs
+ * O(chunk count) regardless of element count and shares all element
+ * memory with the original. The first write to a shared chunk (through
+ * Mutate, PushBack, PopBack or Back) clones just that chunk.
+ *
+ * Reads never detach, so callers should use the const accessors for
+ * anything that does not modify elements.
+ *
+ * Not thread-safe: a container and its copies must be modified from one
+ * thread at a time.
+ */
+template <typename T, size_t ChunkSize = 256>
+class CowChunkedArray {
+public:
+    static_assert(ChunkSize > 0, "ChunkSize must be non-zero");
+
+    size_t Size() const { return m_Size; }
+    bool Empty() const { return m_Size == 0; }
+    size_t ChunkCount() const { return m_Chunks.size(); }
+
+    const T& operator[](size_t index) const {
+        assert(index < m_Size);
+        return m_Chunks[index / ChunkSize]->items[index % ChunkSize];
+    }
+
+    /**
+     * @brief Writable access; clones the owning chunk if it is shared
+     */
+    T& Mutate(size_t index) {
+        assert(index < m_Size);
+        return Detach(index / ChunkSize).items[index % ChunkSize];
+    }
+
+    const T& Back() const { return (*this)[m_Size - 1]; }
+    T& MutateBack() { return Mutate(m_Size - 1); }
+
+    void PushBack(const T& value) {
+        if (m_Size == m_Chunks.size() * ChunkSize) {
+            m_Chunks.push_back(CreateRef<Chunk>());
+            m_Chunks.back()->items.reserve(ChunkSize);
+        }
+        Detach(m_Size / ChunkSize).items.push_back(value);
+        ++m_Size;
+    }
+
+    void PopBack() {
+        assert(m_Size > 0);
+        --m_Size;
+        const size_t chunkIndex = m_Size / ChunkSize;
+        if (m_Size % ChunkSize == 0) {
+            // Last element of the chunk: drop our reference instead of cloning it
+            m_Chunks.pop_back();
+        } else {
+            Detach(chunkIndex).items.pop_back();
+        }
+    }
+
+    void Clear() {
+        m_Chunks.clear();
+        m_Size = 0;
+    }
+
+    /**
+     * @brief True if the chunk holding @p index is shared with another copy
+     */
+    bool IsShared(size_t index) const {
+        return m_Chunks[index / ChunkSize].use_count() > 1;
+    }
+
+private:
+    struct Chunk {
+        std::vector<T> items;
+    };
+
+    Chunk& Detach(size_t chunkIndex) {
+        Ref<Chunk>& chunk = m_Chunks[chunkIndex];
+        if (chunk.use_count() > 1) {
+            auto copy = CreateRef<Chunk>();
+            copy->items.reserve(ChunkSize);
+            copy->items = chunk->items;
+            chunk = std::move(copy);
+        }
+        return *chunk;
+    }
+
+    std::vector<Ref<Chunk>> m_Chunks;
+    size_t m_Size = 0;
+};
+
+}  // namespace Vest
@@ -5,6 +5,7 @@
 #endif
 
 #include "Core/Application.h"
+#include "Core/Log.h"
 
 int main(int argc, char** argv) {
     (void)argc;
@@ -12,5 +13,6 @@ int main(int argc, char** argv) {
     Vest::Application* app = Vest::CreateApplication();
     app->Run();
     delete app;
+    Vest::Log::Shutdown();
     return 0;
 }
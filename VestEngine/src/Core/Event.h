@@ -10,7 +10,21 @@ namespace Vest {
 enum class EventType {
     None = 0,
     WindowClose,
-    WindowResize
+    WindowResize,
+    WindowFocus,
+    KeyPressed,
+    KeyReleased,
+    KeyTyped,
+    MouseButtonPressed,
+    MouseButtonReleased,
+    MouseMoved,
+    MouseScrolled
+};
+
+enum EventCategory {
+    EventCategoryApplication = 1 << 0,
+    EventCategoryKeyboard = 1 << 1,
+    EventCategoryMouse = 1 << 2
 };
 
 class Event {
@@ -21,7 +35,10 @@ public:
 
     virtual EventType GetEventType() const = 0;
     virtual const char* GetName() const = 0;
+    virtual int GetCategoryFlags() const { return EventCategoryApplication; }
     virtual std::string ToString() const { return GetName(); }
+
+    bool IsInCategory(EventCategory category) const { return (GetCategoryFlags() & category) != 0; }
 };
 
 class WindowCloseEvent : public Event {
@@ -55,6 +72,158 @@ private:
     unsigned int m_Height;
 };
 
+class WindowFocusEvent : public Event {
+public:
+    explicit WindowFocusEvent(bool focused) : m_Focused(focused) {}
+
+    static EventType StaticType() { return EventType::WindowFocus; }
+
+    bool IsFocused() const { return m_Focused; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "WindowFocus"; }
+
+private:
+    bool m_Focused;
+};
+
+/**
+ * @brief Key codes and modifier bits are GLFW's (GLFW_KEY_*, GLFW_MOD_*)
+ */
+class KeyEvent : public Event {
+public:
+    int GetKeyCode() const { return m_KeyCode; }
+    int GetMods() const { return m_Mods; }
+
+    int GetCategoryFlags() const override { return EventCategoryKeyboard; }
+
+protected:
+    KeyEvent(int keyCode, int mods) : m_KeyCode(keyCode), m_Mods(mods) {}
+
+    int m_KeyCode;
+    int m_Mods;
+};
+
+class KeyPressedEvent : public KeyEvent {
+public:
+    KeyPressedEvent(int keyCode, int mods, bool repeat) : KeyEvent(keyCode, mods), m_Repeat(repeat) {}
+
+    static EventType StaticType() { return EventType::KeyPressed; }
+
+    bool IsRepeat() const { return m_Repeat; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "KeyPressed"; }
+
+    std::string ToString() const override {
+        std::ostringstream ss;
+        ss << "KeyPressed: " << m_KeyCode << (m_Repeat ? " (repeat)" : "");
+        return ss.str();
+    }
+
+private:
+    bool m_Repeat;
+};
+
+class KeyReleasedEvent : public KeyEvent {
+public:
+    KeyReleasedEvent(int keyCode, int mods) : KeyEvent(keyCode, mods) {}
+
+    static EventType StaticType() { return EventType::KeyReleased; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "KeyReleased"; }
+};
+
+/**
+ * @brief Text input; carries a Unicode code point rather than a key
+ */
+class KeyTypedEvent : public Event {
+public:
+    explicit KeyTypedEvent(unsigned int codepoint) : m_Codepoint(codepoint) {}
+
+    static EventType StaticType() { return EventType::KeyTyped; }
+
+    unsigned int GetCodepoint() const { return m_Codepoint; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "KeyTyped"; }
+    int GetCategoryFlags() const override { return EventCategoryKeyboard; }
+
+private:
+    unsigned int m_Codepoint;
+};
+
+class MouseButtonEvent : public Event {
+public:
+    int GetButton() const { return m_Button; }
+    int GetMods() const { return m_Mods; }
+
+    int GetCategoryFlags() const override { return EventCategoryMouse; }
+
+protected:
+    MouseButtonEvent(int button, int mods) : m_Button(button), m_Mods(mods) {}
+
+    int m_Button;
+    int m_Mods;
+};
+
+class MouseButtonPressedEvent : public MouseButtonEvent {
+public:
+    MouseButtonPressedEvent(int button, int mods) : MouseButtonEvent(button, mods) {}
+
+    static EventType StaticType() { return EventType::MouseButtonPressed; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "MouseButtonPressed"; }
+};
+
+class MouseButtonReleasedEvent : public MouseButtonEvent {
+public:
+    MouseButtonReleasedEvent(int button, int mods) : MouseButtonEvent(button, mods) {}
+
+    static EventType StaticType() { return EventType::MouseButtonReleased; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "MouseButtonReleased"; }
+};
+
+class MouseMovedEvent : public Event {
+public:
+    MouseMovedEvent(float x, float y) : m_X(x), m_Y(y) {}
+
+    static EventType StaticType() { return EventType::MouseMoved; }
+
+    float GetX() const { return m_X; }
+    float GetY() const { return m_Y; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "MouseMoved"; }
+    int GetCategoryFlags() const override { return EventCategoryMouse; }
+
+private:
+    float m_X;
+    float m_Y;
+};
+
+class MouseScrolledEvent : public Event {
+public:
+    MouseScrolledEvent(float xOffset, float yOffset) : m_XOffset(xOffset), m_YOffset(yOffset) {}
+
+    static EventType StaticType() { return EventType::MouseScrolled; }
+
+    float GetXOffset() const { return m_XOffset; }
+    float GetYOffset() const { return m_YOffset; }
+
+    EventType GetEventType() const override { return StaticType(); }
+    const char* GetName() const override { return "MouseScrolled"; }
+    int GetCategoryFlags() const override { return EventCategoryMouse; }
+
+private:
+    float m_XOffset;
+    float m_YOffset;
+};
+
 class EventDispatcher {
 public:
     explicit EventDispatcher(Event& event) : m_Event(event) {}
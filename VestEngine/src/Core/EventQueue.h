@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include "Core/Event.h"
+
+namespace Vest {
+
+/**
+ * @brief Fixed-capacity ring buffer of typed events, drained once per frame
+ *
+ * Window callbacks push events here instead of dispatching them from inside
+ * glfwPollEvents(); Application::Run() drains the queue through the layer
+ * stack at the top of the next frame. Events are stored by value in a
+ * variant, so pushing and draining never allocate.
+ *
+ * Consecutive mouse moves collapse into the latest position and
+ * consecutive scrolls into their sum. When the queue is full further
+ * events are dropped and counted; held-key and button state is tracked
+ * separately by the input snapshot, so it stays correct regardless.
+ *
+ * Main-thread only.
+ */
+class EventQueue {
+public:
+    static constexpr size_t Capacity = 1024;
+
+    using QueuedEvent = std::variant<std::monostate, WindowCloseEvent, WindowResizeEvent, WindowFocusEvent,
+                                     KeyPressedEvent, KeyReleasedEvent, KeyTypedEvent, MouseButtonPressedEvent,
+                                     MouseButtonReleasedEvent, MouseMovedEvent, MouseScrolledEvent>;
+
+    template <typename T>
+    void Push(const T& event) {
+        static_assert(std::is_base_of_v<Event, T>, "Can only queue Event types");
+        if constexpr (std::is_same_v<T, MouseMovedEvent>) {
+            if (m_Count > 0 && std::holds_alternative<MouseMovedEvent>(Back())) {
+                Back() = event;
+                return;
+            }
+        } else if constexpr (std::is_same_v<T, MouseScrolledEvent>) {
+            if (m_Count > 0) {
+                if (auto* last = std::get_if<MouseScrolledEvent>(&Back())) {
+                    *last = MouseScrolledEvent(last->GetXOffset() + event.GetXOffset(),
+                                               last->GetYOffset() + event.GetYOffset());
+                    return;
+                }
+            }
+        }
+
+        if (m_Count == Capacity) {
+            ++m_Dropped;
+            return;
+        }
+        m_Events[(m_Head + m_Count) % Capacity] = event;
+        ++m_Count;
+    }
+
+    /**
+     * @brief Call @p handler with every queued event (as Event&) in arrival order, then empty the queue
+     *
+     * Events pushed by the handler are delivered in the same call.
+     */
+    template <typename F>
+    void Drain(F&& handler) {
+        while (m_Count > 0) {
+            QueuedEvent event = std::move(m_Events[m_Head]);
+            m_Head = (m_Head + 1) % Capacity;
+            --m_Count;
+            std::visit(
+                [&handler](auto& queued) {
+                    if constexpr (!std::is_same_v<std::decay_t<decltype(queued)>, std::monostate>) {
+                        handler(static_cast<Event&>(queued));
+                    }
+                },
+                event);
+        }
+    }
+
+    size_t Size() const { return m_Count; }
+    bool Empty() const { return m_Count == 0; }
+
+    /**
+     * @brief Events lost to a full queue since creation
+     */
+    uint64_t GetDroppedCount() const { return m_Dropped; }
+
+    void Clear() {
+        m_Head = 0;
+        m_Count = 0;
+    }
+
+private:
+    QueuedEvent& Back() { return m_Events[(m_Head + m_Count - 1) % Capacity]; }
+
+    std::array<QueuedEvent, Capacity> m_Events;
+    size_t m_Head = 0;
+    size_t m_Count = 0;
+    uint64_t m_Dropped = 0;
+};
+
+}  // namespace Vest
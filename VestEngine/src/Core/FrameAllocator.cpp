@@ -0,0 +1,151 @@
+#include "Core/FrameAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include "Core/MemoryTracker.h"
+
+namespace Vest {
+
+namespace {
+
+std::atomic<uint64_t> s_FrameIndex{0};
+std::atomic<uint64_t> s_FrameStartHeapAllocations{0};
+std::atomic<uint64_t> s_LastFrameHeapAllocations{0};
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+class Arena {
+public:
+    void* Allocate(size_t size, size_t alignment) {
+        while (m_Current < m_Blocks.size()) {
+            Block& block = m_Blocks[m_Current];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+            const size_t offset = AlignUp(base + m_Offset, alignment) - base;
+            if (offset + size <= block.capacity) {
+                m_Offset = offset + size;
+                m_Used += size;
+                return block.data.get() + offset;
+            }
+            ++m_Current;
+            m_Offset = 0;
+        }
+
+        Block block;
+        block.capacity = std::max(FrameAllocator::DefaultBlockSize, size + alignment);
+        block.data = std::make_unique<std::byte[]>(block.capacity);
+        m_Blocks.push_back(std::move(block));
+        m_Current = m_Blocks.size() - 1;
+        m_Offset = 0;
+        return Allocate(size, alignment);
+    }
+
+    void Reset() {
+        m_Current = 0;
+        m_Offset = 0;
+        m_Used = 0;
+    }
+
+    size_t GetUsed() const { return m_Used; }
+
+    size_t GetReserved() const {
+        size_t reserved = 0;
+        for (const Block& block : m_Blocks) {
+            reserved += block.capacity;
+        }
+        return reserved;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t capacity = 0;
+    };
+
+    std::vector<Block> m_Blocks;
+    size_t m_Current = 0;
+    size_t m_Offset = 0;
+    size_t m_Used = 0;
+};
+
+struct ThreadArenas {
+    Arena arenas[2];
+    uint64_t frame = 0;
+
+    Arena& Current() {
+        const uint64_t current = s_FrameIndex.load(std::memory_order_acquire);
+        if (current != frame) {
+            // The arena for this parity was last used two or more frames ago
+            arenas[current & 1].Reset();
+            frame = current;
+        }
+        return arenas[frame & 1];
+    }
+};
+
+thread_local ThreadArenas t_Arenas;
+
+class FrameMemoryResource final : public std::pmr::memory_resource {
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override { return t_Arenas.Current().Allocate(bytes, alignment); }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+FrameMemoryResource s_FrameResource;
+
+}  // namespace
+
+void FrameAllocator::BeginFrame() {
+    const uint64_t total = GetHeapAllocationCount();
+    s_LastFrameHeapAllocations.store(total - s_FrameStartHeapAllocations.load(std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+    s_FrameStartHeapAllocations.store(total, std::memory_order_relaxed);
+
+    s_FrameIndex.fetch_add(1, std::memory_order_acq_rel);
+}
+
+uint64_t FrameAllocator::GetFrameIndex() {
+    return s_FrameIndex.load(std::memory_order_acquire);
+}
+
+void* FrameAllocator::Allocate(size_t size, size_t alignment) {
+    return t_Arenas.Current().Allocate(size, alignment);
+}
+
+std::string_view FrameAllocator::CopyString(std::string_view text) {
+    char* copy = AllocateArray<char>(text.size() + 1);
+    std::memcpy(copy, text.data(), text.size());
+    copy[text.size()] = '\0';
+    return {copy, text.size()};
+}
+
+std::pmr::memory_resource* FrameAllocator::GetResource() {
+    return &s_FrameResource;
+}
+
+size_t FrameAllocator::GetBytesUsed() {
+    return t_Arenas.Current().GetUsed();
+}
+
+size_t FrameAllocator::GetBytesReserved() {
+    return t_Arenas.arenas[0].GetReserved() + t_Arenas.arenas[1].GetReserved();
+}
+
+bool FrameAllocator::IsHeapTrackingEnabled() {
+    return MemoryTracker::IsEnabled();
+}
+
+uint64_t FrameAllocator::GetHeapAllocationCount() {
+    return MemoryTracker::GetAllocationCount();
+}
+
+uint64_t FrameAllocator::GetLastFrameHeapAllocations() {
+    return s_LastFrameHeapAllocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace Vest
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Vest {
+
+/**
+ * @brief Per-thread bump allocator for data that lives at most one frame
+ *
+ * Each thread owns two arenas used on alternating frames. BeginFrame()
+ * (called at the top of Application::Run) advances the frame index and a
+ * thread rewinds its arena for the new frame on its next allocation. Memory
+ * is therefore valid until the end of the following frame, long enough for
+ * render commands recorded this frame to read it on the render thread.
+ *
+ * Deallocation is a no-op; arena blocks are kept and reused, so a warmed-up
+ * frame does not touch the heap. Use the pmr aliases below for containers:
+ * @code
+ *   FrameVector<float> vertices(FrameAllocator::GetResource());
+ * @endcode
+ */
+class FrameAllocator {
+public:
+    static constexpr size_t DefaultBlockSize = 256 * 1024;
+
+    static void BeginFrame();
+    static uint64_t GetFrameIndex();
+
+    static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    static T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief Copy @p text into frame memory; the copy is null-terminated
+     */
+    static std::string_view CopyString(std::string_view text);
+
+    /**
+     * @brief memory_resource backed by the calling thread's current arena
+     */
+    static std::pmr::memory_resource* GetResource();
+
+    // Calling thread's arena
+    static size_t GetBytesUsed();
+    static size_t GetBytesReserved();
+
+    /**
+     * @brief Global heap allocation counter (operator new), from MemoryTracker when VEST_TRACK_HEAP_ALLOCATIONS is defined
+     */
+    static bool IsHeapTrackingEnabled();
+    static uint64_t GetHeapAllocationCount();
+    static uint64_t GetLastFrameHeapAllocations();
+};
+
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameString = std::pmr::string;
+
+}  // namespace Vest
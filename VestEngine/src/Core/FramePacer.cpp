@@ -0,0 +1,105 @@
+#include "Core/FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace Vest {
+
+namespace {
+
+double ToMilliseconds(FramePacer::Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+void FramePacer::SetMode(FramePacingMode mode) {
+    m_Mode = mode;
+    m_DeadlineValid = false;
+}
+
+void FramePacer::SetTargetFps(double fps) {
+    m_TargetFps = std::max(fps, MinTargetFps);
+    m_DeadlineValid = false;
+}
+
+Timestep FramePacer::BeginFrame() {
+    const Clock::time_point now = Clock::now();
+    float delta = 0.0f;
+    if (m_Started) {
+        delta = std::chrono::duration<float>(now - m_FrameStart).count();
+        // The previous frame ends here; anything after EndFrame() is loop overhead, count it as waiting
+        m_LastFrame.cpuMs = m_CpuMs;
+        m_LastFrame.frameMs = ToMilliseconds(now - m_FrameStart);
+        m_LastFrame.waitMs = std::max(0.0, m_LastFrame.frameMs - m_CpuMs);
+        m_LastFrame.updateMs = m_UpdateMs;
+        m_LastFrame.imguiMs = m_ImGuiMs;
+        m_LastFrame.presentMs = std::max(0.0, m_LastFrame.frameMs - m_UpdateMs - m_ImGuiMs);
+        ++m_FrameCount;
+    }
+    m_Started = true;
+    m_FrameStart = now;
+    m_WorkEnd = now;
+    m_UpdateMs = 0.0;
+    m_ImGuiMs = 0.0;
+    return Timestep(delta);
+}
+
+void FramePacer::EndUpdate() {
+    m_UpdateMs = ToMilliseconds(Clock::now() - m_FrameStart);
+}
+
+void FramePacer::EndImGui() {
+    m_ImGuiMs = std::max(0.0, ToMilliseconds(Clock::now() - m_FrameStart) - m_UpdateMs);
+}
+
+void FramePacer::EndWork() {
+    m_WorkEnd = Clock::now();
+    m_CpuMs = ToMilliseconds(m_WorkEnd - m_FrameStart);
+}
+
+void FramePacer::EndFrame() {
+    if (m_Mode != FramePacingMode::FixedRate) {
+        return;
+    }
+
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_TargetFps));
+    const Clock::time_point now = Clock::now();
+    if (!m_DeadlineValid) {
+        m_Deadline = m_FrameStart;
+        m_DeadlineValid = true;
+    }
+    m_Deadline += period;
+    if (now - m_Deadline > period) {
+        // Fell more than a frame behind (hitch, breakpoint); resynchronize
+        m_Deadline = now;
+        return;
+    }
+    WaitUntil(m_Deadline);
+}
+
+void FramePacer::WaitUntil(Clock::time_point deadline) {
+    using namespace std::chrono;
+
+    double remaining = duration<double>(deadline - Clock::now()).count();
+    while (remaining > m_SleepEstimate) {
+        const Clock::time_point start = Clock::now();
+        std::this_thread::sleep_for(milliseconds(1));
+        const double observed = duration<double>(Clock::now() - start).count();
+        remaining -= observed;
+
+        ++m_SleepSamples;
+        const double delta = observed - m_SleepMean;
+        m_SleepMean += delta / static_cast<double>(m_SleepSamples);
+        m_SleepM2 += delta * (observed - m_SleepMean);
+        const double stddev = std::sqrt(m_SleepM2 / static_cast<double>(m_SleepSamples - 1));
+        m_SleepEstimate = m_SleepMean + stddev;
+    }
+
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+}  // namespace Vest
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "Core/Timestep.h"
+
+namespace Vest {
+
+enum class FramePacingMode {
+    VSync = 0,  // Swap interval 1; the wait happens inside SwapBuffers on the render thread
+    Uncapped,   // Swap interval 0, no limiter
+    FixedRate   // Swap interval 0, limiter sleeps until the next frame deadline
+};
+
+/**
+ * @brief Where the last frame's time went, in milliseconds
+ */
+struct FrameTiming {
+    double cpuMs = 0.0;    // Layer updates, UI and command recording on the main thread
+    double waitMs = 0.0;   // Blocked on the render thread (and swap with vsync) plus the limiter
+    double frameMs = 0.0;  // Start of this frame to start of the next
+
+    // The same frame split by phase; the three add up to frameMs
+    double updateMs = 0.0;   // Events and layer updates
+    double imguiMs = 0.0;    // Building the UI
+    double presentMs = 0.0;  // Window update, handing the frame to the render thread and waiting
+};
+
+/**
+ * @brief Paces the main loop and splits each frame into CPU work and waiting
+ *
+ * Application::Run() calls BeginFrame() at the top of the loop, EndUpdate()
+ * and EndImGui() after those phases, EndWork() once the frame is recorded
+ * and EndFrame() after handing it to the render thread. With FixedRate, EndFrame() waits for an absolute deadline that
+ * advances by one period per frame, so sleep overshoot does not accumulate;
+ * if a frame runs over by more than a period the schedule restarts instead
+ * of bursting to catch up.
+ *
+ * The wait sleeps while the remaining time exceeds an estimate of the OS
+ * sleep overshoot and spins for the rest. The estimate tracks the observed
+ * mean plus one standard deviation of 1 ms sleeps, so coarse timers spin a
+ * little longer and fine ones hardly at all.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double DefaultTargetFps = 60.0;
+    static constexpr double MinTargetFps = 1.0;
+
+    void SetMode(FramePacingMode mode);
+    FramePacingMode GetMode() const { return m_Mode; }
+
+    /**
+     * @brief Frame rate for FixedRate, clamped to at least MinTargetFps
+     */
+    void SetTargetFps(double fps);
+    double GetTargetFps() const { return m_TargetFps; }
+
+    /**
+     * @brief Start a frame
+     * @return Time since the previous BeginFrame(), zero for the first frame
+     */
+    Timestep BeginFrame();
+
+    /**
+     * @brief Mark the end of the update phase; optional
+     */
+    void EndUpdate();
+
+    /**
+     * @brief Mark the end of the UI phase; optional, after EndUpdate()
+     */
+    void EndImGui();
+
+    /**
+     * @brief The frame's CPU work is done; everything until the next frame counts as waiting
+     */
+    void EndWork();
+
+    /**
+     * @brief Apply the limiter and finish the frame's timing
+     */
+    void EndFrame();
+
+    const FrameTiming& GetLastFrame() const { return m_LastFrame; }
+    uint64_t GetFrameCount() const { return m_FrameCount; }
+
+    /**
+     * @brief Sleep and then spin until @p deadline
+     */
+    void WaitUntil(Clock::time_point deadline);
+
+private:
+    FramePacingMode m_Mode = FramePacingMode::VSync;
+    double m_TargetFps = DefaultTargetFps;
+
+    Clock::time_point m_FrameStart;
+    Clock::time_point m_WorkEnd;
+    Clock::time_point m_Deadline;
+    bool m_Started = false;
+    bool m_DeadlineValid = false;
+    double m_CpuMs = 0.0;
+    double m_WaitMs = 0.0;
+    double m_UpdateMs = 0.0;
+    double m_ImGuiMs = 0.0;
+    FrameTiming m_LastFrame;
+    uint64_t m_FrameCount = 0;
+
+    // Running statistics of observed 1 ms sleeps, in seconds (Welford)
+    double m_SleepEstimate = 5.0e-3;
+    double m_SleepMean = 5.0e-3;
+    double m_SleepM2 = 0.0;
+    uint64_t m_SleepSamples = 1;
+};
+
+}  // namespace Vest
@@ -0,0 +1,120 @@
+#include "Core/FrameStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <spdlog/fmt/fmt.h>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+namespace {
+
+// Nearest rank: the smallest value with at least @p percent of the samples at or below it
+double Percentile(const std::vector<double>& sorted, double percent) {
+    const size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+}  // namespace
+
+FrameStats::FrameStats(size_t capacity) : m_Samples(std::max<size_t>(capacity, 1)) {
+    m_Sorted.reserve(m_Samples.size());
+}
+
+void FrameStats::Add(const FrameTiming& timing) {
+    const size_t capacity = m_Samples.size();
+    m_Samples[(m_Head + m_Count) % capacity] = timing;
+    if (m_Count == capacity) {
+        m_Head = (m_Head + 1) % capacity;
+    } else {
+        ++m_Count;
+    }
+
+    if (m_Recording) {
+        m_Recorded.push_back(timing);
+    }
+}
+
+void FrameStats::Clear() {
+    m_Head = 0;
+    m_Count = 0;
+}
+
+const FrameTiming& FrameStats::GetSample(size_t index) const {
+    return m_Samples[(m_Head + index) % m_Samples.size()];
+}
+
+double FrameStats::GetValue(const FrameTiming& timing, FrameMetric metric) {
+    switch (metric) {
+        case FrameMetric::Frame:
+            return timing.frameMs;
+        case FrameMetric::Update:
+            return timing.updateMs;
+        case FrameMetric::ImGui:
+            return timing.imguiMs;
+        case FrameMetric::Present:
+            return timing.presentMs;
+    }
+    return 0.0;
+}
+
+FrameMetricSummary FrameStats::Summarize(FrameMetric metric) const {
+    FrameMetricSummary summary;
+    if (m_Count == 0) {
+        return summary;
+    }
+
+    m_Sorted.clear();
+    double total = 0.0;
+    for (size_t i = 0; i < m_Count; ++i) {
+        const double value = GetValue(GetSample(i), metric);
+        m_Sorted.push_back(value);
+        total += value;
+    }
+    std::sort(m_Sorted.begin(), m_Sorted.end());
+
+    summary.meanMs = total / static_cast<double>(m_Count);
+    summary.p50Ms = Percentile(m_Sorted, 50.0);
+    summary.p95Ms = Percentile(m_Sorted, 95.0);
+    summary.p99Ms = Percentile(m_Sorted, 99.0);
+    summary.maxMs = m_Sorted.back();
+    return summary;
+}
+
+size_t FrameStats::GetSpikeCount() const {
+    size_t spikes = 0;
+    for (size_t i = 0; i < m_Count; ++i) {
+        spikes += IsSpike(GetSample(i)) ? 1 : 0;
+    }
+    return spikes;
+}
+
+void FrameStats::StartRecording() {
+    m_Recorded.clear();
+    m_Recording = true;
+}
+
+bool FrameStats::ExportCsv(const std::filesystem::path& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        VEST_CORE_ERROR("Failed to write frame stats {0}", path.string());
+        return false;
+    }
+
+    fmt::memory_buffer buffer;
+    auto append = std::back_inserter(buffer);
+    fmt::format_to(append, "frame,frame_ms,cpu_ms,wait_ms,update_ms,imgui_ms,present_ms,spike\n");
+    for (size_t i = 0; i < m_Recorded.size(); ++i) {
+        const FrameTiming& timing = m_Recorded[i];
+        fmt::format_to(append, "{0},{1:.4f},{2:.4f},{3:.4f},{4:.4f},{5:.4f},{6:.4f},{7}\n", i, timing.frameMs,
+                       timing.cpuMs, timing.waitMs, timing.updateMs, timing.imguiMs, timing.presentMs,
+                       IsSpike(timing) ? 1 : 0);
+    }
+
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
+}  // namespace Vest
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Core/FramePacer.h"
+
+namespace Vest {
+
+enum class FrameMetric {
+    Frame = 0,  // FrameTiming::frameMs
+    Update,
+    ImGui,
+    Present
+};
+
+/**
+ * @brief Distribution of one metric over the frames in the window, in milliseconds
+ */
+struct FrameMetricSummary {
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+/**
+ * @brief Rolling frame-time statistics over the last GetCapacity() frames
+ *
+ * Application::Run() adds the pacer's timing for every finished frame.
+ * Percentiles use the nearest rank over the window, so p99 of a full
+ * 300-frame window is rank 297, its fourth-slowest frame. A frame whose
+ * total time exceeds the budget is a spike.
+ *
+ * Separately from the window, a recording keeps every frame from
+ * StartRecording() on, for export as CSV and comparison between builds.
+ */
+class FrameStats {
+public:
+    static constexpr size_t DefaultCapacity = 300;
+    static constexpr double DefaultBudgetMs = 1000.0 / 60.0;
+
+    explicit FrameStats(size_t capacity = DefaultCapacity);
+
+    void Add(const FrameTiming& timing);
+
+    /**
+     * @brief Empty the window; a running recording is kept
+     */
+    void Clear();
+
+    size_t GetCount() const { return m_Count; }
+    size_t GetCapacity() const { return m_Samples.size(); }
+
+    /**
+     * @brief Frames in the window, oldest first
+     */
+    const FrameTiming& GetSample(size_t index) const;
+
+    FrameMetricSummary Summarize(FrameMetric metric) const;
+    static double GetValue(const FrameTiming& timing, FrameMetric metric);
+
+    void SetBudgetMs(double budgetMs) { m_BudgetMs = budgetMs; }
+    double GetBudgetMs() const { return m_BudgetMs; }
+    bool IsSpike(const FrameTiming& timing) const { return timing.frameMs > m_BudgetMs; }
+
+    /**
+     * @brief Spikes in the window
+     */
+    size_t GetSpikeCount() const;
+
+    /**
+     * @brief Start a new recording, discarding the previous one
+     */
+    void StartRecording();
+    void StopRecording() { m_Recording = false; }
+    bool IsRecording() const { return m_Recording; }
+    const std::vector<FrameTiming>& GetRecording() const { return m_Recorded; }
+
+    /**
+     * @brief Write the recording as CSV, one row per frame, spikes judged against the current budget
+     */
+    bool ExportCsv(const std::filesystem::path& path) const;
+
+private:
+    std::vector<FrameTiming> m_Samples;  // Ring of GetCapacity() frames
+    size_t m_Head = 0;                   // Oldest frame
+    size_t m_Count = 0;
+    double m_BudgetMs = DefaultBudgetMs;
+
+    bool m_Recording = false;
+    std::vector<FrameTiming> m_Recorded;
+
+    mutable std::vector<double> m_Sorted;  // Reused by Summarize()
+};
+
+}  // namespace Vest
@@ -1,23 +1,40 @@
 #include "Core/Input.h"
 
-#include <GLFW/glfw3.h>
+namespace Vest {
 
-#include "Core/Application.h"
+namespace {
 
-namespace Vest {
+InputState s_State;
+
+}  // namespace
 
 bool Input::IsKeyPressed(int keycode) {
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    int state = glfwGetKey(window, keycode);
-    return state == GLFW_PRESS || state == GLFW_REPEAT;
+    return keycode >= 0 && keycode < InputState::KeyCount && s_State.keys.test(static_cast<size_t>(keycode));
+}
+
+bool Input::IsMouseButtonPressed(int button) {
+    return button >= 0 && button < InputState::MouseButtonCount &&
+           s_State.mouseButtons.test(static_cast<size_t>(button));
 }
 
 glm::vec2 Input::GetMousePosition() {
-    GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    double xPos = 0.0;
-    double yPos = 0.0;
-    glfwGetCursorPos(window, &xPos, &yPos);
-    return {static_cast<float>(xPos), static_cast<float>(yPos)};
+    return s_State.mousePosition;
+}
+
+glm::vec2 Input::GetScrollDelta() {
+    return s_State.scrollDelta;
+}
+
+bool Input::IsWindowFocused() {
+    return s_State.focused;
+}
+
+const InputState& Input::GetState() {
+    return s_State;
+}
+
+void Input::SetState(const InputState& state) {
+    s_State = state;
 }
 
 }  // namespace Vest
@@ -1,13 +1,49 @@
 #pragma once
 
+#include <bitset>
+
 #include <glm/glm.hpp>
 
 namespace Vest {
 
+/**
+ * @brief Keyboard and mouse state at one point in time
+ *
+ * Key and button codes are GLFW's. The window keeps a live copy up to date
+ * from its callbacks; Application hands a copy to Input once per frame.
+ */
+struct InputState {
+    static constexpr int KeyCount = 512;  // Above GLFW_KEY_LAST
+    static constexpr int MouseButtonCount = 8;
+
+    std::bitset<KeyCount> keys;
+    std::bitset<MouseButtonCount> mouseButtons;
+    glm::vec2 mousePosition = glm::vec2(0.0f);
+    glm::vec2 scrollDelta = glm::vec2(0.0f);  // Accumulated since the previous snapshot
+    bool focused = true;
+};
+
+/**
+ * @brief Input queries against the snapshot taken at the start of the frame
+ *
+ * The snapshot is immutable for the rest of the frame, so every query is a
+ * plain memory load and all layers see the same state regardless of when
+ * they ask. Main-thread only.
+ */
 class Input {
 public:
     static bool IsKeyPressed(int keycode);
+    static bool IsMouseButtonPressed(int button);
     static glm::vec2 GetMousePosition();
+    static glm::vec2 GetScrollDelta();
+    static bool IsWindowFocused();
+
+    static const InputState& GetState();
+
+    /**
+     * @brief Replace the snapshot; called by Application before layers update
+     */
+    static void SetState(const InputState& state);
 };
 
 }  // namespace Vest
@@ -0,0 +1,288 @@
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+#include "Core/Log.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Profiler.h"
+
+namespace Vest {
+
+struct Job {
+    JobSystem::JobFunction function;
+    JobCounter* counter = nullptr;
+};
+
+namespace {
+
+// Which system (if any) the current thread belongs to, and its deque
+thread_local JobSystem* t_System = nullptr;
+thread_local uint32_t t_QueueIndex = 0;
+
+constexpr uint32_t SpinsBeforeSleep = 64;
+
+uint32_t NextRandom(uint32_t& state) {
+    // xorshift32; only used to spread steal attempts
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+}  // namespace
+
+Scope<JobSystem> JobSystem::s_Instance;
+
+JobSystem::JobSystem(uint32_t workerCount) {
+    m_Queues.reserve(workerCount + 1);
+    for (uint32_t i = 0; i <= workerCount; ++i) {
+        m_Queues.push_back(CreateScope<WorkStealingDeque<Job*>>());
+    }
+
+    t_System = this;
+    t_QueueIndex = 0;
+
+    m_Workers.reserve(workerCount);
+    for (uint32_t i = 1; i <= workerCount; ++i) {
+        m_Workers.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_Running.store(false, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_SleepCondition.notify_all();
+    }
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+
+    // Jobs nobody waited for are dropped
+    Job* job = nullptr;
+    for (auto& queue : m_Queues) {
+        while (queue->Steal(job)) {
+            delete job;
+        }
+    }
+    for (Job* injected : m_Injected) {
+        delete injected;
+    }
+
+    if (t_System == this) {
+        t_System = nullptr;
+    }
+}
+
+uint32_t JobSystem::DefaultWorkerCount() {
+    const uint32_t hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 1;
+}
+
+void JobSystem::Init(uint32_t workerCount) {
+    assert(!s_Instance && "JobSystem already initialized");
+    s_Instance = CreateScope<JobSystem>(workerCount);
+    VEST_CORE_INFO("JobSystem initialized with {0} worker threads", workerCount);
+}
+
+void JobSystem::Shutdown() {
+    s_Instance.reset();
+}
+
+void JobSystem::Run(JobFunction function, JobCounter* counter, JobCounter* dependency) {
+    Job* job = new Job{std::move(function), counter};
+    if (counter) {
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (dependency) {
+        std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+        if (!dependency->IsDone()) {
+            // Scheduled by Complete() when the dependency's last job finishes
+            dependency->m_Waiters.push_back(job);
+            return;
+        }
+    }
+    Schedule(job);
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+    const bool own = IsOwnThread();
+    uint32_t rng = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&counter)) | 1u;
+    uint32_t idleSpins = 0;
+
+    while (!counter.IsDone()) {
+        Job* job = FindJob(own ? t_QueueIndex : UINT32_MAX, rng);
+        if (job) {
+            Execute(job);
+            idleSpins = 0;
+            continue;
+        }
+        // Remaining work is running on other threads
+        if (++idleSpins > SpinsBeforeSleep) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Synchronize with the final Complete() so the caller may destroy the counter
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+void JobSystem::ParallelFor(uint32_t count, const RangeFunction& function, uint32_t minGrain) {
+    if (count == 0) {
+        return;
+    }
+
+    const uint32_t target = GetThreadCount() * 8;
+    const uint32_t grain = std::max({minGrain, count / target, 1u});
+    if (count <= grain || m_Workers.empty()) {
+        function(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    std::function<void(uint32_t, uint32_t)> split;
+    split = [&](uint32_t begin, uint32_t end) {
+        // Keep the lower half, publish the upper half for thieves
+        while (end - begin > grain) {
+            const uint32_t middle = begin + (end - begin) / 2;
+            Run([&split, middle, end]() { split(middle, end); }, &counter);
+            end = middle;
+        }
+        function(begin, end);
+    };
+
+    split(0, count);
+    Wait(counter);
+}
+
+void JobSystem::WorkerLoop(uint32_t queueIndex) {
+    t_System = this;
+    t_QueueIndex = queueIndex;
+    Profiler::SetThreadName("Worker " + std::to_string(queueIndex));
+    uint32_t rng = 0x9E3779B9u * (queueIndex + 1);
+
+    while (true) {
+        const uint64_t epoch = m_WorkEpoch.load(std::memory_order_seq_cst);
+
+        Job* job = nullptr;
+        for (uint32_t spin = 0; spin < SpinsBeforeSleep && !job; ++spin) {
+            job = FindJob(queueIndex, rng);
+            if (!job && spin > SpinsBeforeSleep / 2) {
+                std::this_thread::yield();
+            }
+        }
+        if (job) {
+            Execute(job);
+            continue;
+        }
+
+        if (!m_Running.load(std::memory_order_seq_cst)) {
+            break;
+        }
+
+        // Sleep until something is scheduled after our last scan. Paired with
+        // WakeWorkers: either it sees m_Sleeping > 0 or we see the new epoch.
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+        m_SleepCondition.wait(lock, [&]() {
+            return m_WorkEpoch.load(std::memory_order_seq_cst) != epoch ||
+                   !m_Running.load(std::memory_order_seq_cst);
+        });
+        m_Sleeping.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+Job* JobSystem::FindJob(uint32_t queueIndex, uint32_t& rng) {
+    Job* job = nullptr;
+    if (queueIndex < m_Queues.size() && m_Queues[queueIndex]->Pop(job)) {
+        return job;
+    }
+
+    if (m_InjectedCount.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        if (!m_Injected.empty()) {
+            job = m_Injected.front();
+            m_Injected.pop_front();
+            m_InjectedCount.fetch_sub(1, std::memory_order_release);
+            return job;
+        }
+    }
+
+    const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+    const uint32_t start = NextRandom(rng) % queueCount;
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        const uint32_t victim = (start + i) % queueCount;
+        if (victim != queueIndex && m_Queues[victim]->Steal(job)) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::Schedule(Job* job) {
+    if (IsOwnThread()) {
+        m_Queues[t_QueueIndex]->Push(job);
+    } else {
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        m_Injected.push_back(job);
+        m_InjectedCount.fetch_add(1, std::memory_order_release);
+    }
+    WakeWorkers();
+}
+
+void JobSystem::Execute(Job* job) {
+    JobCounter* counter = job->counter;
+    {
+        VEST_PROFILE_SCOPE("Job");
+        VEST_MEMORY_TAG(Jobs);
+        job->function();
+    }
+    // Release captures before signalling, so waiters observe them destroyed
+    delete job;
+    if (counter) {
+        Complete(*counter);
+    } else if (DetachedCompletionCallback callback = m_DetachedCompletion.load(std::memory_order_acquire)) {
+        callback();
+    }
+}
+
+void JobSystem::Complete(JobCounter& counter) {
+    // Non-final decrements are lock-free. The final one happens under the
+    // counter's mutex so that Wait(), which takes the mutex before returning,
+    // cannot let the counter be destroyed while it is still being touched.
+    uint32_t pending = counter.m_Pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter.m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                                    std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    std::vector<Job*> released;
+    {
+        std::lock_guard<std::mutex> lock(counter.m_Mutex);
+        if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            released.swap(counter.m_Waiters);
+        }
+    }
+    for (Job* job : released) {
+        Schedule(job);
+    }
+}
+
+bool JobSystem::IsOwnThread() const {
+    return t_System == this;
+}
+
+void JobSystem::WakeWorkers() {
+    m_WorkEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_Sleeping.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_SleepCondition.notify_one();
+    }
+}
+
+}  // namespace Vest
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Core/Base.h"
+#include "Core/WorkStealingDeque.h"
+
+namespace Vest {
+
+struct Job;
+
+/**
+ * @brief Completion counter for a group of jobs
+ *
+ * Incremented when a job is submitted against it and decremented when that
+ * job finishes. Jobs submitted with this counter as a dependency are held
+ * back until it reaches zero. Must outlive every job that references it.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+    uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Pending{0};
+    mutable std::mutex m_Mutex;
+    std::vector<Job*> m_Waiters;  // Jobs depending on this counter
+};
+
+/**
+ * @brief Work-stealing job scheduler
+ *
+ * Each worker thread owns a Chase-Lev deque: it pushes and pops its own
+ * work LIFO and, when empty, steals FIFO from a random victim. The thread
+ * that creates the JobSystem gets a deque too, so jobs it submits are
+ * local and Wait() lets it execute work instead of blocking. Submissions
+ * from any other thread go through a shared, locked queue.
+ *
+ * Idle workers spin briefly and then sleep until new work is submitted.
+ */
+class JobSystem {
+public:
+    using JobFunction = std::function<void()>;
+    using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+    using DetachedCompletionCallback = void (*)();
+
+    /**
+     * @param workerCount Background threads to start; the creating thread
+     *        participates too. Defaults to hardware concurrency minus one.
+     */
+    explicit JobSystem(uint32_t workerCount = DefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Submit a job
+     * @param counter Optional; incremented now, decremented when the job finishes
+     * @param dependency Optional; the job is not started before this counter reaches zero
+     */
+    void Run(JobFunction function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+    /**
+     * @brief Block until @p counter reaches zero, executing pending jobs meanwhile
+     */
+    void Wait(const JobCounter& counter);
+
+    /**
+     * @brief Split [0, count) into ranges and run them in parallel, returning when all are done
+     *
+     * Ranges are split in halves until they reach the grain size, which is
+     * derived from the count and thread count (about eight ranges per
+     * thread) but never below @p minGrain. Halves are published as
+     * stealable jobs, so idle threads pick up large ranges first.
+     */
+    void ParallelFor(uint32_t count, const RangeFunction& function, uint32_t minGrain = 1);
+
+    /**
+     * @brief Called, on the thread that ran it, after every job submitted without a counter
+     *
+     * Nobody waits for such jobs, so their results are picked up by polling;
+     * Application uses this to wake its main loop when it is idle.
+     */
+    void SetDetachedCompletionCallback(DetachedCompletionCallback callback) {
+        m_DetachedCompletion.store(callback, std::memory_order_release);
+    }
+
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+    uint32_t GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    static uint32_t DefaultWorkerCount();
+
+    /**
+     * @brief Engine-wide instance, created by Application
+     */
+    static void Init(uint32_t workerCount = DefaultWorkerCount());
+    static void Shutdown();
+    static bool IsInitialized() { return s_Instance != nullptr; }
+    static JobSystem& Get() { return *s_Instance; }
+
+private:
+    void WorkerLoop(uint32_t queueIndex);
+    Job* FindJob(uint32_t queueIndex, uint32_t& rng);
+    void Schedule(Job* job);
+    void Execute(Job* job);
+    void Complete(JobCounter& counter);
+    bool IsOwnThread() const;
+    void WakeWorkers();
+
+    std::vector<Scope<WorkStealingDeque<Job*>>> m_Queues;  // [0] = creating thread
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_InjectMutex;
+    std::deque<Job*> m_Injected;
+    std::atomic<uint32_t> m_InjectedCount{0};
+
+    std::mutex m_SleepMutex;
+    std::condition_variable m_SleepCondition;
+    std::atomic<uint64_t> m_WorkEpoch{0};
+    std::atomic<uint32_t> m_Sleeping{0};
+    std::atomic<bool> m_Running{true};
+    std::atomic<DetachedCompletionCallback> m_DetachedCompletion{nullptr};
+
+    static Scope<JobSystem> s_Instance;
+};
+
+}  // namespace Vest
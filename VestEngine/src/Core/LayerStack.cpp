@@ -5,10 +5,16 @@
 namespace Vest {
 
 LayerStack::~LayerStack() {
+    Clear();
+}
+
+void LayerStack::Clear() {
     for (Layer* layer : m_Layers) {
         layer->OnDetach();
         delete layer;
     }
+    m_Layers.clear();
+    m_LayerInsertIndex = 0;
 }
 
 void LayerStack::PushLayer(Layer* layer) {
@@ -16,6 +16,11 @@ public:
     void PopLayer(Layer* layer);
     void PopOverlay(Layer* overlay);
 
+    /**
+     * @brief Detach and delete every layer, overlays included
+     */
+    void Clear();
+
     std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
     std::vector<Layer*>::iterator end() { return m_Layers.end(); }
     std::vector<Layer*>::reverse_iterator rbegin() { return m_Layers.rbegin(); }
@@ -1,36 +1,105 @@
 #include "Core/Log.h"
 
+#include "Core/BinaryLog.h"
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
 namespace Vest {
 
+LogConfig Log::s_Config;
 std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
-void Log::Init() {
+namespace {
+
+// Shared by both async loggers; they only hold a weak reference
+std::shared_ptr<spdlog::details::thread_pool> s_ThreadPool;
+
+std::shared_ptr<spdlog::logger> CreateLogger(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks,
+                                             const LogConfig& config) {
+    std::shared_ptr<spdlog::logger> logger;
+    if (config.async) {
+        const spdlog::async_overflow_policy policy = config.overflowPolicy == LogOverflowPolicy::Block
+                                                         ? spdlog::async_overflow_policy::block
+                                                         : spdlog::async_overflow_policy::overrun_oldest;
+        logger = std::make_shared<spdlog::async_logger>(name, begin(sinks), end(sinks), s_ThreadPool, policy);
+    } else {
+        logger = std::make_shared<spdlog::logger>(name, begin(sinks), end(sinks));
+    }
+    spdlog::register_logger(logger);
+    // Runtime filtering stays fully open; VEST_LOG_ACTIVE_LEVEL already removed what is not wanted
+    logger->set_level(spdlog::level::trace);
+    logger->flush_on(config.flushLevel);
+    return logger;
+}
+
+}  // namespace
+
+void Log::Init(const LogConfig& config) {
+    if (s_CoreLogger) {
+        Shutdown();
+    }
+    s_Config = config;
+
     std::vector<spdlog::sink_ptr> logSinks;
     
     // Console sink with color
-    logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+    if (config.consoleToStderr) {
+        logSinks.emplace_back(std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+    } else {
+        logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+    }
     logSinks[0]->set_pattern("%^[%T] %n: %v%$");
     
     // File sink
-    logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("VestEngine.log", true));
-    logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+    if (!config.filePath.empty()) {
+        logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(config.filePath, true));
+        logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+    }
     
+    if (config.async) {
+        // One worker keeps messages from both loggers in submission order
+        s_ThreadPool = std::make_shared<spdlog::details::thread_pool>(config.queueSize, 1);
+    }
+
     // Create loggers
-    s_CoreLogger = std::make_shared<spdlog::logger>("VEST", begin(logSinks), end(logSinks));
-    spdlog::register_logger(s_CoreLogger);
-    s_CoreLogger->set_level(spdlog::level::trace);
-    s_CoreLogger->flush_on(spdlog::level::trace);
-    
-    s_ClientLogger = std::make_shared<spdlog::logger>("APP", begin(logSinks), end(logSinks));
-    spdlog::register_logger(s_ClientLogger);
-    s_ClientLogger->set_level(spdlog::level::trace);
-    s_ClientLogger->flush_on(spdlog::level::trace);
-    
-    VEST_CORE_INFO("VestEngine logging initialized");
+    s_CoreLogger = CreateLogger("VEST", logSinks, config);
+    s_ClientLogger = CreateLogger("APP", logSinks, config);
+
+    // Replaces (or, with a zero interval, stops) the flusher from an earlier Init()
+    spdlog::flush_every(config.flushInterval);
+
+    VEST_CORE_INFO("VestEngine logging initialized ({0})", config.async ? "async" : "sync");
+
+    if (!config.binaryLogPath.empty()) {
+        BinaryLog::Open(config.binaryLogPath);
+    }
+}
+
+void Log::Flush() {
+    if (s_CoreLogger) {
+        s_CoreLogger->flush();
+        s_ClientLogger->flush();
+    }
+}
+
+void Log::Shutdown() {
+    if (!s_CoreLogger) {
+        return;
+    }
+    // Closing may report dropped records, so do it while the loggers still exist
+    BinaryLog::Close();
+    spdlog::flush_every(std::chrono::seconds(0));
+    Flush();
+    spdlog::drop(s_CoreLogger->name());
+    spdlog::drop(s_ClientLogger->name());
+    s_CoreLogger.reset();
+    s_ClientLogger.reset();
+    // Joins the worker once it has written everything queued so far
+    s_ThreadPool.reset();
 }
 
 }  // namespace Vest
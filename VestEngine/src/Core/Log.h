@@ -1,36 +1,144 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
+// Severities for VEST_LOG_ACTIVE_LEVEL, matching spdlog::level::level_enum
+#define VEST_LOG_LEVEL_TRACE    0
+#define VEST_LOG_LEVEL_DEBUG    1
+#define VEST_LOG_LEVEL_INFO     2
+#define VEST_LOG_LEVEL_WARN     3
+#define VEST_LOG_LEVEL_ERROR    4
+#define VEST_LOG_LEVEL_CRITICAL 5
+#define VEST_LOG_LEVEL_OFF      6
+
+// Log macros below this severity compile to nothing and do not evaluate their arguments
+#ifndef VEST_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define VEST_LOG_ACTIVE_LEVEL VEST_LOG_LEVEL_INFO
+#else
+#define VEST_LOG_ACTIVE_LEVEL VEST_LOG_LEVEL_TRACE
+#endif
+#endif
+
 namespace Vest {
 
+enum class LogOverflowPolicy {
+    Block,        // The logging thread waits for room in the queue
+    DiscardOldest // The oldest queued message is overwritten; logging never blocks
+};
+
+/**
+ * @brief How Log::Init() sets up the loggers
+ */
+struct LogConfig {
+    // Empty logs to the console only
+    std::string filePath = "VestEngine.log";
+    // Keeps stdout free for a command-line tool's own output
+    bool consoleToStderr = false;
+
+    // Format and write messages on a background thread instead of the caller's
+    bool async = true;
+    size_t queueSize = 8192;
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+
+    // Messages at or above this level flush the sinks immediately
+    spdlog::level::level_enum flushLevel = spdlog::level::warn;
+    // Everything else is flushed periodically; zero disables the periodic flush
+    std::chrono::seconds flushInterval{1};
+
+    // Where VEST_BINLOG records go (see BinaryLog); empty leaves the binary log closed
+    std::string binaryLogPath;
+};
+
 class Log {
 public:
-    static void Init();
-    
+    /**
+     * @brief Create the core and client loggers, replacing any from an earlier call
+     */
+    static void Init(const LogConfig& config = LogConfig());
+
+    /**
+     * @brief Flush both loggers
+     *
+     * With async logging the flush is queued behind pending messages and
+     * returns immediately; Shutdown() is the call that waits for them.
+     */
+    static void Flush();
+
+    /**
+     * @brief Flush and release the loggers and the background thread, and close the binary log
+     *
+     * Call before exit so no queued messages are lost. The log macros must
+     * not be used afterwards until Init() is called again.
+     */
+    static void Shutdown();
+
+    static const LogConfig& GetConfig() { return s_Config; }
+
     static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
     static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
 
 private:
+    static LogConfig s_Config;
     static std::shared_ptr<spdlog::logger> s_CoreLogger;
     static std::shared_ptr<spdlog::logger> s_ClientLogger;
 };
 
 }  // namespace Vest
 
+#define VEST_LOG_DISCARD(...) static_cast<void>(0)
+
 // Core logging macros
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_TRACE
 #define VEST_CORE_TRACE(...)    ::Vest::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define VEST_CORE_INFO(...)     ::Vest::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define VEST_CORE_WARN(...)     ::Vest::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define VEST_CORE_ERROR(...)    ::Vest::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define VEST_CORE_CRITICAL(...) ::Vest::Log::GetCoreLogger()->critical(__VA_ARGS__)
-
-// Client logging macros
 #define VEST_TRACE(...)         ::Vest::Log::GetClientLogger()->trace(__VA_ARGS__)
+#else
+#define VEST_CORE_TRACE(...)    VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_TRACE(...)         VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_DEBUG
+#define VEST_CORE_DEBUG(...)    ::Vest::Log::GetCoreLogger()->debug(__VA_ARGS__)
+#define VEST_DEBUG(...)         ::Vest::Log::GetClientLogger()->debug(__VA_ARGS__)
+#else
+#define VEST_CORE_DEBUG(...)    VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_DEBUG(...)         VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_INFO
+#define VEST_CORE_INFO(...)     ::Vest::Log::GetCoreLogger()->info(__VA_ARGS__)
 #define VEST_INFO(...)          ::Vest::Log::GetClientLogger()->info(__VA_ARGS__)
+#else
+#define VEST_CORE_INFO(...)     VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_INFO(...)          VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_WARN
+#define VEST_CORE_WARN(...)     ::Vest::Log::GetCoreLogger()->warn(__VA_ARGS__)
 #define VEST_WARN(...)          ::Vest::Log::GetClientLogger()->warn(__VA_ARGS__)
+#else
+#define VEST_CORE_WARN(...)     VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_WARN(...)          VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_ERROR
+#define VEST_CORE_ERROR(...)    ::Vest::Log::GetCoreLogger()->error(__VA_ARGS__)
 #define VEST_ERROR(...)         ::Vest::Log::GetClientLogger()->error(__VA_ARGS__)
+#else
+#define VEST_CORE_ERROR(...)    VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_ERROR(...)         VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VEST_LOG_ACTIVE_LEVEL <= VEST_LOG_LEVEL_CRITICAL
+#define VEST_CORE_CRITICAL(...) ::Vest::Log::GetCoreLogger()->critical(__VA_ARGS__)
 #define VEST_CRITICAL(...)      ::Vest::Log::GetClientLogger()->critical(__VA_ARGS__)
+#else
+#define VEST_CORE_CRITICAL(...) VEST_LOG_DISCARD(__VA_ARGS__)
+#define VEST_CRITICAL(...)      VEST_LOG_DISCARD(__VA_ARGS__)
+#endif
@@ -0,0 +1,303 @@
+#include "Core/MemoryTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <spdlog/fmt/fmt.h>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+namespace {
+
+struct TagCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+    std::atomic<uint64_t> bytesFreed{0};
+};
+
+// Only its own thread writes a slot, except the shared overflow slot
+struct alignas(64) ThreadCounters {
+    TagCounters tags[MemoryTracker::TagCount];
+};
+
+// Constant-initialized: the hooks run before main() and after static destructors
+constexpr size_t MaxThreadSlots = 256;
+ThreadCounters s_Slots[MaxThreadSlots + 1];  // The last is shared by threads beyond the limit
+std::atomic<size_t> s_SlotCount{0};
+
+thread_local ThreadCounters* t_Counters = nullptr;
+thread_local MemoryTag t_Tag = MemoryTag::Untagged;
+
+// Last BeginFrame() sample
+MemoryTagStats s_Stats[MemoryTracker::TagCount];
+MemoryTagStats s_Total;
+uint64_t s_BytesAllocated[MemoryTracker::TagCount + 1];  // Index TagCount is the total
+
+constexpr const char* TagNames[] = {"Untagged", "Scene", "Strings", "Commands", "Rendering",
+                                    "Textures", "ImGui", "Serialization", "Jobs"};
+static_assert(std::size(TagNames) == MemoryTracker::TagCount, "Name every MemoryTag");
+
+[[maybe_unused]] ThreadCounters& GetThreadCounters() {
+    if (!t_Counters) {
+        const size_t slot = s_SlotCount.fetch_add(1, std::memory_order_relaxed);
+        t_Counters = &s_Slots[std::min(slot, MaxThreadSlots)];
+    }
+    return *t_Counters;
+}
+
+size_t GetUsedSlots() {
+    return std::min(s_SlotCount.load(std::memory_order_relaxed), MaxThreadSlots + 1);
+}
+
+void UpdateStats(MemoryTagStats& stats, uint64_t& lastBytesAllocated, uint64_t allocations, uint64_t frees,
+                 uint64_t bytesAllocated, uint64_t bytesFreed) {
+    stats.frameAllocations = allocations - stats.allocations;
+    stats.frameBytes = bytesAllocated - lastBytesAllocated;
+    stats.allocations = allocations;
+    stats.frees = frees;
+    stats.currentBytes = static_cast<int64_t>(bytesAllocated - bytesFreed);
+    stats.peakBytes = std::max(stats.peakBytes, stats.currentBytes);
+    lastBytesAllocated = bytesAllocated;
+}
+
+}  // namespace
+
+bool MemoryTracker::IsEnabled() {
+#ifdef VEST_TRACK_HEAP_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag) {
+    const size_t index = static_cast<size_t>(tag);
+    return index < TagCount ? TagNames[index] : "Unknown";
+}
+
+MemoryTag MemoryTracker::SetThreadTag(MemoryTag tag) {
+    const MemoryTag previous = t_Tag;
+    t_Tag = tag;
+    return previous;
+}
+
+MemoryTag MemoryTracker::GetThreadTag() {
+    return t_Tag;
+}
+
+void MemoryTracker::BeginFrame() {
+    const size_t slots = GetUsedSlots();
+    uint64_t total[4] = {};
+    for (size_t tag = 0; tag < TagCount; ++tag) {
+        uint64_t sums[4] = {};
+        for (size_t slot = 0; slot < slots; ++slot) {
+            const TagCounters& counters = s_Slots[slot].tags[tag];
+            sums[0] += counters.allocations.load(std::memory_order_relaxed);
+            sums[1] += counters.frees.load(std::memory_order_relaxed);
+            sums[2] += counters.bytesAllocated.load(std::memory_order_relaxed);
+            sums[3] += counters.bytesFreed.load(std::memory_order_relaxed);
+        }
+        UpdateStats(s_Stats[tag], s_BytesAllocated[tag], sums[0], sums[1], sums[2], sums[3]);
+        for (size_t i = 0; i < 4; ++i) {
+            total[i] += sums[i];
+        }
+    }
+    UpdateStats(s_Total, s_BytesAllocated[TagCount], total[0], total[1], total[2], total[3]);
+}
+
+const MemoryTagStats& MemoryTracker::GetStats(MemoryTag tag) {
+    return s_Stats[std::min(static_cast<size_t>(tag), TagCount - 1)];
+}
+
+const MemoryTagStats& MemoryTracker::GetTotal() {
+    return s_Total;
+}
+
+uint64_t MemoryTracker::GetAllocationCount() {
+    uint64_t allocations = 0;
+    const size_t slots = GetUsedSlots();
+    for (size_t slot = 0; slot < slots; ++slot) {
+        for (const TagCounters& counters : s_Slots[slot].tags) {
+            allocations += counters.allocations.load(std::memory_order_relaxed);
+        }
+    }
+    return allocations;
+}
+
+bool MemoryTracker::ExportCsv(const std::filesystem::path& path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        VEST_CORE_ERROR("Failed to write memory stats {0}", path.string());
+        return false;
+    }
+
+    fmt::memory_buffer buffer;
+    auto append = std::back_inserter(buffer);
+    auto appendRow = [&append](const char* name, const MemoryTagStats& stats) {
+        fmt::format_to(append, "{0},{1},{2},{3},{4},{5},{6}\n", name, stats.allocations, stats.frees,
+                       stats.currentBytes, stats.peakBytes, stats.frameAllocations, stats.frameBytes);
+    };
+    fmt::format_to(append, "tag,allocations,frees,current_bytes,peak_bytes,frame_allocations,frame_bytes\n");
+    for (size_t tag = 0; tag < TagCount; ++tag) {
+        appendRow(TagNames[tag], s_Stats[tag]);
+    }
+    appendRow("Total", s_Total);
+
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
+}  // namespace Vest
+
+#ifdef VEST_TRACK_HEAP_ALLOCATIONS
+
+// Replacements for every replaceable global allocation function. A block is
+// laid out as [padding][AllocationHeader][user memory]; every form must be
+// replaced, or a block from the default allocator would reach these deletes.
+namespace {
+
+struct AllocationHeader {
+    uint64_t size;
+    uint32_t offset;  // From the start of the block to the user memory
+    Vest::MemoryTag tag;
+};
+
+constexpr size_t HeaderSpace = 16;
+static_assert(sizeof(AllocationHeader) <= HeaderSpace && alignof(std::max_align_t) <= HeaderSpace);
+
+void* TrackedAllocate(size_t size, size_t alignment) {
+    // Over-aligned blocks are aligned by hand inside a larger malloc block rather
+    // than with std::aligned_alloc, which MSVC does not provide
+    const size_t padding = alignment > alignof(std::max_align_t) ? alignment - 1 : 0;
+    if (alignment - 1 > std::numeric_limits<uint32_t>::max() - HeaderSpace ||
+        size > std::numeric_limits<size_t>::max() - HeaderSpace - padding) {
+        return nullptr;
+    }
+    void* block = std::malloc(size + HeaderSpace + padding);
+    if (!block) {
+        return nullptr;
+    }
+
+    const uintptr_t start = reinterpret_cast<uintptr_t>(block);
+    const size_t offset = ((start + HeaderSpace + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - start;
+    std::byte* memory = static_cast<std::byte*>(block) + offset;
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory) - 1;
+    header->size = size;
+    header->offset = static_cast<uint32_t>(offset);
+    header->tag = Vest::t_Tag;
+
+    Vest::TagCounters& counters = Vest::GetThreadCounters().tags[static_cast<size_t>(header->tag)];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    return memory;
+}
+
+void TrackedFree(void* memory) noexcept {
+    if (!memory) {
+        return;
+    }
+    const AllocationHeader* header = static_cast<const AllocationHeader*>(memory) - 1;
+    Vest::TagCounters& counters = Vest::GetThreadCounters().tags[static_cast<size_t>(header->tag)];
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesFreed.fetch_add(header->size, std::memory_order_relaxed);
+    std::free(static_cast<std::byte*>(memory) - header->offset);
+}
+
+void* TrackedAllocateOrThrow(size_t size, size_t alignment) {
+    if (void* memory = TrackedAllocate(size, alignment)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+    return TrackedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size) {
+    return TrackedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    TrackedFree(memory);
+}
+
+#endif
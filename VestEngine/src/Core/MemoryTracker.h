@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Vest {
+
+/**
+ * @brief Subsystem a heap allocation is charged to, set per thread with VEST_MEMORY_TAG
+ */
+enum class MemoryTag : uint8_t {
+    Untagged = 0,
+    Scene,
+    Strings,
+    Commands,
+    Rendering,
+    Textures,
+    ImGui,
+    Serialization,
+    Jobs,
+    Count
+};
+
+struct MemoryTagStats {
+    uint64_t allocations = 0;  // Since startup
+    uint64_t frees = 0;
+    int64_t currentBytes = 0;  // Requested sizes, without allocator overhead
+    int64_t peakBytes = 0;     // Highest currentBytes seen at a frame boundary
+    uint64_t frameAllocations = 0;  // During the last frame
+    uint64_t frameBytes = 0;
+};
+
+/**
+ * @brief Heap use by subsystem, from replaced global operator new/delete
+ *
+ * With VEST_TRACK_HEAP_ALLOCATIONS defined (CMake
+ * VEST_ENABLE_MEMORY_TRACKING=ON) every operator new records its size and
+ * the calling thread's current tag in a small header in front of the block,
+ * and bumps counters owned by the calling thread, so tracking takes no lock.
+ * A free is charged to the tag the block was allocated under, whichever
+ * thread frees it. Without the define there are no hooks, VEST_MEMORY_TAG
+ * expands to nothing and every statistic reads zero.
+ *
+ * Application::Run() calls BeginFrame() once per frame to sum the thread
+ * counters into the statistics below. Peaks are sampled there, so a
+ * transient peak inside a frame is not seen.
+ */
+class MemoryTracker {
+public:
+    static constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+    static bool IsEnabled();
+    static const char* GetTagName(MemoryTag tag);
+
+    /**
+     * @brief Tag of the calling thread's allocations; returns the previous tag
+     */
+    static MemoryTag SetThreadTag(MemoryTag tag);
+    static MemoryTag GetThreadTag();
+
+    /**
+     * @brief Sample the thread counters at a frame boundary; main thread only
+     */
+    static void BeginFrame();
+
+    /**
+     * @brief Statistics as of the last BeginFrame(); main thread only
+     */
+    static const MemoryTagStats& GetStats(MemoryTag tag);
+    static const MemoryTagStats& GetTotal();
+
+    /**
+     * @brief operator new calls so far, summed live; callable from any thread
+     */
+    static uint64_t GetAllocationCount();
+
+    /**
+     * @brief Write the last sample as CSV, one row per tag plus a total
+     */
+    static bool ExportCsv(const std::filesystem::path& path);
+};
+
+/**
+ * @brief Charges the calling thread's allocations to a tag until the end of the scope
+ */
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag) : m_Previous(MemoryTracker::SetThreadTag(tag)) {}
+    ~MemoryTagScope() { MemoryTracker::SetThreadTag(m_Previous); }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_Previous;
+};
+
+}  // namespace Vest
+
+#define VEST_MEMORY_CONCAT_IMPL(a, b) a##b
+#define VEST_MEMORY_CONCAT(a, b) VEST_MEMORY_CONCAT_IMPL(a, b)
+
+#ifdef VEST_TRACK_HEAP_ALLOCATIONS
+// @p tag is a MemoryTag enumerator name, e.g. VEST_MEMORY_TAG(Scene)
+#define VEST_MEMORY_TAG(tag) \
+    ::Vest::MemoryTagScope VEST_MEMORY_CONCAT(vestMemoryTag, __LINE__)(::Vest::MemoryTag::tag)
+#else
+#define VEST_MEMORY_TAG(tag) static_cast<void>(0)
+#endif
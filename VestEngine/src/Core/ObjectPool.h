@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Vest {
+
+/**
+ * @brief Slab allocator for objects of a single type
+ *
+ * Objects are constructed in fixed-size slabs and freed slots are kept on
+ * an intrusive free list, so once the pool has grown to its working set
+ * Create() and Destroy() never touch the global heap. Slabs are only
+ * released when the pool itself is destroyed, and every object must be
+ * destroyed before that.
+ *
+ * Not thread-safe.
+ */
+template <typename T, size_t SlabSize = 64>
+class ObjectPool {
+public:
+    static_assert(SlabSize > 0, "SlabSize must be non-zero");
+
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ~ObjectPool() { assert(m_LiveCount == 0 && "ObjectPool destroyed with live objects"); }
+
+    template <typename... Args>
+    T* Create(Args&&... args) {
+        if (!m_FreeList) {
+            AddSlab();
+        }
+
+        Slot* slot = m_FreeList;
+        m_FreeList = slot->next;
+        try {
+            T* object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            ++m_LiveCount;
+            return object;
+        } catch (...) {
+            slot->next = m_FreeList;
+            m_FreeList = slot;
+            throw;
+        }
+    }
+
+    void Destroy(T* object) {
+        if (!object) {
+            return;
+        }
+
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = m_FreeList;
+        m_FreeList = slot;
+        --m_LiveCount;
+    }
+
+    size_t GetLiveCount() const { return m_LiveCount; }
+    size_t GetCapacity() const { return m_Slabs.size() * SlabSize; }
+    size_t GetSlabCount() const { return m_Slabs.size(); }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    void AddSlab() {
+        m_Slabs.push_back(std::make_unique<Slot[]>(SlabSize));
+        Slot* slab = m_Slabs.back().get();
+        for (size_t i = SlabSize; i > 0; --i) {
+            slab[i - 1].next = m_FreeList;
+            m_FreeList = &slab[i - 1];
+        }
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_Slabs;
+    Slot* m_FreeList = nullptr;
+    size_t m_LiveCount = 0;
+};
+
+}  // namespace Vest
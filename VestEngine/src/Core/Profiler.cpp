@@ -0,0 +1,428 @@
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <spdlog/fmt/fmt.h>
+
+#include "Core/Log.h"
+#include "Core/StringTable.h"
+
+namespace Vest {
+
+std::atomic<bool> Profiler::s_Active{false};
+
+namespace {
+
+/**
+ * @brief Single-producer, single-consumer ring of completed scopes
+ *
+ * The owning thread pushes; the thread calling Profiler::EndFrame() or
+ * EndCapture() drains. Positions grow monotonically.
+ */
+class EventRing {
+public:
+    EventRing() : m_Events(std::make_unique<ProfileEvent[]>(Profiler::RingCapacity)) {}
+
+    void Push(const ProfileEvent& event) {
+        const uint64_t head = m_Head.load(std::memory_order_relaxed);
+        if (head - m_Tail.load(std::memory_order_acquire) == Profiler::RingCapacity) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_Events[head % Profiler::RingCapacity] = event;
+        m_Head.store(head + 1, std::memory_order_release);
+    }
+
+    template <typename F>
+    void Drain(F&& consume) {
+        const uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+        const uint64_t head = m_Head.load(std::memory_order_acquire);
+        for (uint64_t i = tail; i < head; ++i) {
+            consume(m_Events[i % Profiler::RingCapacity]);
+        }
+        m_Tail.store(head, std::memory_order_release);
+    }
+
+    uint64_t TakeDropped() { return m_Dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<ProfileEvent[]> m_Events;
+    alignas(64) std::atomic<uint64_t> m_Head{0};
+    alignas(64) std::atomic<uint64_t> m_Tail{0};
+    std::atomic<uint64_t> m_Dropped{0};
+};
+
+struct ThreadBuffer {
+    uint32_t id = 0;
+    std::string name;  // Guarded by State::threadsMutex
+    EventRing ring;
+};
+
+void SortEvents(std::vector<ProfileEvent>& events) {
+    std::sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+        return a.startNs != b.startNs ? a.startNs < b.startNs : a.depth < b.depth;
+    });
+}
+
+struct State {
+    // Never shrinks: threads keep a raw pointer to their buffer for the life of the process
+    std::mutex threadsMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threads;
+
+    // Consumer side
+    std::mutex captureMutex;
+    std::atomic<bool> capturing{false};
+    bool historyEnabled = false;
+    ProfileCapture current;
+    ProfileCapture last;
+    std::vector<size_t> slots;  // Thread id -> index in current.threads, or npos
+
+    // Scopes drained since the last frame boundary, indexed by thread id
+    std::vector<std::vector<ProfileEvent>> pending;
+    uint64_t pendingDropped = 0;
+
+    // Ring of records; entries are reused so a steady frame does not allocate
+    std::vector<ProfileFrameRecord> history;
+    size_t historyCapacity = Profiler::DefaultHistoryCapacity;
+    size_t historyHead = 0;  // Oldest record
+    size_t historyCount = 0;
+
+    uint64_t frameIndex = 0;
+    int64_t frameStartNs = 0;
+
+    bool IsRecording() const { return capturing.load(std::memory_order_relaxed) || historyEnabled; }
+
+    // The rest requires captureMutex
+    void Collect() {
+        std::vector<ThreadBuffer*> buffers;
+        {
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            for (const auto& buffer : threads) {
+                buffers.push_back(buffer.get());
+            }
+        }
+
+        if (pending.size() < buffers.size()) {
+            pending.resize(buffers.size());
+        }
+        for (ThreadBuffer* buffer : buffers) {
+            pendingDropped += buffer->ring.TakeDropped();
+            std::vector<ProfileEvent>& events = pending[buffer->id];
+            buffer->ring.Drain([&events](const ProfileEvent& event) { events.push_back(event); });
+        }
+    }
+
+    void DiscardPending() {
+        for (std::vector<ProfileEvent>& events : pending) {
+            events.clear();
+        }
+        pendingDropped = 0;
+    }
+
+    void AppendToCapture() {
+        current.dropped += pendingDropped;
+        pendingDropped = 0;
+        for (uint32_t id = 0; id < pending.size(); ++id) {
+            for (const ProfileEvent& event : pending[id]) {
+                // Entered before the capture began and closed after
+                if (event.startNs >= current.startNs) {
+                    GetThread(id).events.push_back(event);
+                }
+            }
+        }
+    }
+
+    void AppendToHistory(const ProfileFrame& frame) {
+        if (history.size() < historyCapacity) {
+            history.resize(historyCapacity);
+        }
+        const size_t slot = (historyHead + historyCount) % historyCapacity;
+        if (historyCount == historyCapacity) {
+            historyHead = (historyHead + 1) % historyCapacity;
+        } else {
+            ++historyCount;
+        }
+
+        ProfileFrameRecord& record = history[slot];
+        record.frame = frame;
+        size_t used = 0;
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        for (uint32_t id = 0; id < pending.size(); ++id) {
+            if (pending[id].empty()) {
+                continue;
+            }
+            if (record.threads.size() == used) {
+                record.threads.emplace_back();
+            }
+            ProfileThread& thread = record.threads[used++];
+            thread.id = id;
+            thread.name = threads[id]->name;
+            thread.events.assign(pending[id].begin(), pending[id].end());
+            SortEvents(thread.events);
+        }
+        record.threads.resize(used);
+    }
+
+    ProfileThread& GetThread(uint32_t id) {
+        if (slots.size() <= id) {
+            slots.resize(id + 1, std::string::npos);
+        }
+        if (slots[id] == std::string::npos) {
+            slots[id] = current.threads.size();
+            ProfileThread& thread = current.threads.emplace_back();
+            thread.id = id;
+        }
+        return current.threads[slots[id]];
+    }
+};
+
+State& GetState() {
+    static State state;
+    return state;
+}
+
+thread_local ThreadBuffer* t_Buffer = nullptr;
+thread_local uint32_t t_Depth = 0;
+
+ThreadBuffer& GetThreadBuffer() {
+    if (!t_Buffer) {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.threadsMutex);
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->id = static_cast<uint32_t>(state.threads.size());
+        buffer->name = fmt::format("Thread {0}", buffer->id);
+        state.threads.push_back(std::move(buffer));
+        t_Buffer = state.threads.back().get();
+    }
+    return *t_Buffer;
+}
+
+void AppendJsonString(fmt::memory_buffer& out, std::string_view text) {
+    out.push_back('"');
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+}  // namespace
+
+size_t ProfileCapture::GetEventCount() const {
+    size_t count = 0;
+    for (const ProfileThread& thread : threads) {
+        count += thread.events.size();
+    }
+    return count;
+}
+
+bool ProfileCapture::ExportChromeTrace(const std::filesystem::path& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        VEST_CORE_ERROR("Failed to write trace {0}", path.string());
+        return false;
+    }
+
+    // Microseconds since the capture started; tid 0 is the frame track
+    auto micros = [this](int64_t ns) { return static_cast<double>(ns - startNs) * 1.0e-3; };
+    fmt::memory_buffer buffer;
+    auto append = std::back_inserter(buffer);
+    fmt::format_to(append, "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fmt::format_to(append, R"({{"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{{"name":"Frames"}}}})");
+    for (const ProfileFrame& frame : frames) {
+        fmt::format_to(append, ",\n{{\"name\":\"Frame {0}\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":{1:.3f},\"dur\":{2:.3f},"
+                               "\"pid\":1,\"tid\":0}}",
+                       frame.index, micros(frame.startNs), static_cast<double>(frame.endNs - frame.startNs) * 1.0e-3);
+    }
+    for (const ProfileThread& thread : threads) {
+        fmt::format_to(append, ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":",
+                       thread.id + 1);
+        AppendJsonString(buffer, thread.name);
+        fmt::format_to(append, "}}}}");
+        fmt::format_to(append, ",\n{{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},"
+                               "\"args\":{{\"sort_index\":{0}}}}}",
+                       thread.id + 1);
+        for (const ProfileEvent& event : thread.events) {
+            fmt::format_to(append, ",\n{{\"name\":");
+            AppendJsonString(buffer, event.name);
+            fmt::format_to(append, ",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":{0:.3f},\"dur\":{1:.3f},\"pid\":1,\"tid\":{2}}}",
+                           micros(event.startNs), static_cast<double>(event.endNs - event.startNs) * 1.0e-3,
+                           thread.id + 1);
+        }
+    }
+    fmt::format_to(append, "\n]}}\n");
+
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
+void Profiler::BeginCapture() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    if (!state.IsRecording()) {
+        // Scopes that closed after recording stopped belong to nothing
+        state.Collect();
+        state.DiscardPending();
+    }
+    state.current = ProfileCapture();
+    state.slots.clear();
+    state.current.startNs = Now();
+    state.capturing.store(true, std::memory_order_relaxed);
+    s_Active.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::EndCapture() {
+    if (!IsCapturing()) {
+        return;
+    }
+
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    state.capturing.store(false, std::memory_order_relaxed);
+    s_Active.store(state.IsRecording(), std::memory_order_relaxed);
+    state.Collect();
+    state.AppendToCapture();
+    // The history still takes these at the end of the frame
+    if (!state.historyEnabled) {
+        state.DiscardPending();
+    }
+    state.current.endNs = Now();
+
+    {
+        std::lock_guard<std::mutex> threadsLock(state.threadsMutex);
+        for (ProfileThread& thread : state.current.threads) {
+            thread.name = state.threads[thread.id]->name;
+        }
+    }
+    for (ProfileThread& thread : state.current.threads) {
+        SortEvents(thread.events);
+    }
+    std::sort(state.current.threads.begin(), state.current.threads.end(),
+              [](const ProfileThread& a, const ProfileThread& b) { return a.id < b.id; });
+
+    if (state.current.dropped > 0) {
+        VEST_CORE_WARN("Profiler dropped {0} scopes to full thread buffers", state.current.dropped);
+    }
+    state.last = std::move(state.current);
+    state.current = ProfileCapture();
+}
+
+bool Profiler::IsCapturing() {
+    return GetState().capturing.load(std::memory_order_relaxed);
+}
+
+const ProfileCapture& Profiler::GetCapture() {
+    return GetState().last;
+}
+
+void Profiler::EndFrame() {
+    State& state = GetState();
+    const int64_t now = Now();
+    const ProfileFrame frame{state.frameIndex++, state.frameStartNs, now};
+    state.frameStartNs = now;
+    if (!IsRecording()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    state.Collect();
+    if (state.capturing.load(std::memory_order_relaxed)) {
+        ProfileFrame captured = frame;
+        captured.startNs = std::max(captured.startNs, state.current.startNs);
+        state.current.frames.push_back(captured);
+        state.AppendToCapture();
+    }
+    if (state.historyEnabled) {
+        state.AppendToHistory(frame);
+    }
+    state.DiscardPending();
+}
+
+void Profiler::SetHistoryEnabled(bool enabled) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    if (enabled == state.historyEnabled) {
+        return;
+    }
+    if (enabled && !state.IsRecording()) {
+        state.Collect();
+        state.DiscardPending();
+    }
+    state.historyEnabled = enabled;
+    s_Active.store(state.IsRecording(), std::memory_order_relaxed);
+}
+
+bool Profiler::IsHistoryEnabled() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    return state.historyEnabled;
+}
+
+void Profiler::SetHistoryCapacity(size_t frames) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    state.history.clear();
+    state.historyCapacity = std::max<size_t>(frames, 1);
+    state.historyHead = 0;
+    state.historyCount = 0;
+}
+
+size_t Profiler::GetHistoryCapacity() {
+    return GetState().historyCapacity;
+}
+
+size_t Profiler::GetHistoryCount() {
+    return GetState().historyCount;
+}
+
+const ProfileFrameRecord& Profiler::GetHistoryFrame(size_t index) {
+    State& state = GetState();
+    return state.history[(state.historyHead + index) % state.historyCapacity];
+}
+
+void Profiler::ClearHistory() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    state.historyHead = 0;
+    state.historyCount = 0;
+}
+
+void Profiler::SetThreadName(std::string_view name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(GetState().threadsMutex);
+    buffer.name = std::string(name);
+}
+
+const char* Profiler::InternName(std::string_view name) {
+    return StringTable::Lookup(StringTable::Intern(name)).data();
+}
+
+int64_t Profiler::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint32_t Profiler::EnterScope() {
+    return t_Depth++;
+}
+
+void Profiler::LeaveScope(const char* name, int64_t startNs, uint32_t depth) {
+    const int64_t endNs = Now();
+    t_Depth = depth;
+    // A scope still open when recording stopped is not kept
+    if (IsRecording()) {
+        GetThreadBuffer().ring.Push({name, startNs, endNs, depth});
+    }
+}
+
+}  // namespace Vest
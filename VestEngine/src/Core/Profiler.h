@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Set to 0 to compile every VEST_PROFILE_* macro out
+#ifndef VEST_PROFILE
+#define VEST_PROFILE 1
+#endif
+
+namespace Vest {
+
+/**
+ * @brief One completed instrumented scope
+ */
+struct ProfileEvent {
+    const char* name = "";  // Static or interned; never freed
+    int64_t startNs = 0;    // Profiler::Now() at entry
+    int64_t endNs = 0;
+    uint32_t depth = 0;  // Scopes already open on the thread at entry
+};
+
+struct ProfileThread {
+    uint32_t id = 0;  // Order in which threads first recorded a scope, starting at 0
+    std::string name;
+    std::vector<ProfileEvent> events;  // Ordered by start time, parents before children
+};
+
+struct ProfileFrame {
+    uint64_t index = 0;
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+};
+
+/**
+ * @brief Everything recorded between Profiler::BeginCapture() and EndCapture()
+ */
+struct ProfileCapture {
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+    std::vector<ProfileFrame> frames;
+    std::vector<ProfileThread> threads;  // Only threads that recorded something
+    uint64_t dropped = 0;                // Scopes lost to full thread buffers
+
+    bool Empty() const { return threads.empty() && frames.empty(); }
+    size_t GetEventCount() const;
+
+    /**
+     * @brief Write Chrome trace_event JSON (chrome://tracing, ui.perfetto.dev)
+     *
+     * Scopes become complete ("X") events on their thread's track and frames
+     * become spans on a separate "Frames" track.
+     */
+    bool ExportChromeTrace(const std::filesystem::path& path) const;
+};
+
+/**
+ * @brief The scopes of one frame kept in the rolling history
+ */
+struct ProfileFrameRecord {
+    ProfileFrame frame;
+    std::vector<ProfileThread> threads;  // Only threads that recorded something, ordered by id
+};
+
+/**
+ * @brief CPU scope instrumentation with per-thread lock-free buffers
+ *
+ * VEST_PROFILE_SCOPE / VEST_PROFILE_FUNCTION record a begin and end
+ * timestamp into a fixed-size ring owned by the calling thread, with no
+ * locks and no allocation. While nothing is recording, a scope costs one
+ * relaxed atomic load. The main thread calls EndFrame() once per frame,
+ * which marks the frame boundary and drains every thread's ring into the
+ * current capture and history; a ring that fills up between drains drops scopes and
+ * counts them.
+ *
+ * Besides explicit captures, the profiler can keep a rolling history of the
+ * last GetHistoryCapacity() frames for in-process inspection. Scopes are
+ * recorded while either is active.
+ *
+ * Define VEST_PROFILE to 0 (CMake VEST_ENABLE_PROFILING=OFF) to remove the
+ * macros entirely.
+ */
+class Profiler {
+public:
+    static constexpr size_t RingCapacity = 16384;  // Scopes per thread between drains
+    static constexpr size_t DefaultHistoryCapacity = 300;
+
+    static void BeginCapture();
+
+    /**
+     * @brief Stop recording and make the result available through GetCapture()
+     */
+    static void EndCapture();
+
+    static bool IsCapturing();
+
+    /**
+     * @brief Whether scopes are being recorded, for a capture or the history
+     */
+    static bool IsRecording() { return s_Active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief The last finished capture
+     */
+    static const ProfileCapture& GetCapture();
+
+    /**
+     * @brief Mark the end of a frame and collect the scopes recorded so far; main thread only
+     */
+    static void EndFrame();
+
+    /**
+     * @brief Start or pause the rolling history; pausing keeps the recorded frames
+     */
+    static void SetHistoryEnabled(bool enabled);
+    static bool IsHistoryEnabled();
+
+    /**
+     * @brief Number of frames the history keeps; changing it clears the history
+     */
+    static void SetHistoryCapacity(size_t frames);
+    static size_t GetHistoryCapacity();
+
+    /**
+     * @brief Frames in the history, oldest first; main thread only
+     *
+     * References stay valid until the next EndFrame() while the history is
+     * enabled, or until it is cleared or resized.
+     */
+    static size_t GetHistoryCount();
+    static const ProfileFrameRecord& GetHistoryFrame(size_t index);
+    static void ClearHistory();
+
+    /**
+     * @brief Name the calling thread in captures and exported traces
+     */
+    static void SetThreadName(std::string_view name);
+
+    /**
+     * @brief Stable C string for a name built at runtime, for VEST_PROFILE_SCOPE_DYNAMIC
+     */
+    static const char* InternName(std::string_view name);
+
+    /**
+     * @brief Nanoseconds on the steady clock the timestamps use
+     */
+    static int64_t Now();
+
+    // Used by ProfileScope
+    static uint32_t EnterScope();
+    static void LeaveScope(const char* name, int64_t startNs, uint32_t depth);
+
+private:
+    static std::atomic<bool> s_Active;
+};
+
+/**
+ * @brief Records the enclosing scope if the profiler was recording when it was entered
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        if (name && Profiler::IsRecording()) {
+            m_Name = name;
+            m_Depth = Profiler::EnterScope();
+            m_StartNs = Profiler::Now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (m_Name) {
+            Profiler::LeaveScope(m_Name, m_StartNs, m_Depth);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name = nullptr;
+    int64_t m_StartNs = 0;
+    uint32_t m_Depth = 0;
+};
+
+}  // namespace Vest
+
+#if defined(_MSC_VER)
+#define VEST_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define VEST_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+#define VEST_PROFILE_CONCAT_IMPL(a, b) a##b
+#define VEST_PROFILE_CONCAT(a, b) VEST_PROFILE_CONCAT_IMPL(a, b)
+
+#if VEST_PROFILE
+// @p name must outlive the capture: a string literal or Profiler::InternName()
+#define VEST_PROFILE_SCOPE(name) ::Vest::ProfileScope VEST_PROFILE_CONCAT(vestProfileScope, __LINE__)(name)
+#define VEST_PROFILE_FUNCTION() VEST_PROFILE_SCOPE(VEST_FUNCTION_SIGNATURE)
+// Interns @p name (any string type) only while recording
+#define VEST_PROFILE_SCOPE_DYNAMIC(name)                                                \
+    ::Vest::ProfileScope VEST_PROFILE_CONCAT(vestProfileScope, __LINE__)(               \
+        ::Vest::Profiler::IsRecording() ? ::Vest::Profiler::InternName(name) : nullptr)
+#else
+#define VEST_PROFILE_SCOPE(name) static_cast<void>(0)
+#define VEST_PROFILE_FUNCTION() static_cast<void>(0)
+#define VEST_PROFILE_SCOPE_DYNAMIC(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,150 @@
+#include "Core/StringTable.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/Log.h"
+#include "Core/MemoryTracker.h"
+
+namespace Vest {
+
+namespace {
+
+constexpr size_t ArenaBlockSize = 64 * 1024;
+constexpr size_t EntriesPerPage = 4096;
+constexpr size_t MaxPages = 4096;
+
+/**
+ * Entries live in fixed-size pages that are never moved, and the page
+ * directory is a fixed array, so Lookup() can read without the lock while
+ * Intern() appends on another thread.
+ */
+struct StringTableData {
+    std::mutex mutex;
+    std::unordered_map<std::string_view, uint32_t> ids;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t blockUsed = ArenaBlockSize;
+    size_t arenaBytes = 0;
+    bool full = false;  // Capacity error already reported
+
+    std::array<std::atomic<std::string_view*>, MaxPages> pages{};
+    std::atomic<uint32_t> count{0};
+
+    StringTableData() {
+        Append(std::string_view("", 0));
+    }
+
+    ~StringTableData() {
+        for (auto& page : pages) {
+            delete[] page.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::string_view Store(std::string_view str) {
+        const size_t size = str.size() + 1;
+        char* dest = nullptr;
+        if (size > ArenaBlockSize / 4) {
+            // Oversized strings get a dedicated block so they don't waste the current one
+            blocks.push_back(std::make_unique<char[]>(size));
+            dest = blocks.back().get();
+        } else {
+            if (blockUsed + size > ArenaBlockSize) {
+                blocks.push_back(std::make_unique<char[]>(ArenaBlockSize));
+                blockUsed = 0;
+            }
+            dest = blocks.back().get() + blockUsed;
+            blockUsed += size;
+        }
+        std::memcpy(dest, str.data(), str.size());
+        dest[str.size()] = '\0';
+        arenaBytes += size;
+        return std::string_view(dest, str.size());
+    }
+
+    uint32_t Append(std::string_view str) {
+        const uint32_t id = count.load(std::memory_order_relaxed);
+        const size_t pageIndex = id / EntriesPerPage;
+        if (pageIndex >= MaxPages) {
+            // The page directory is fixed so lookups stay lock-free; overflow degrades to the empty name
+            if (!full) {
+                VEST_CORE_ERROR("StringTable is full ({0} strings); new strings resolve to the empty string", id);
+                full = true;
+            }
+            return StringTable::EmptyId;
+        }
+
+        std::string_view* page = pages[pageIndex].load(std::memory_order_relaxed);
+        if (!page) {
+            page = new std::string_view[EntriesPerPage];
+            pages[pageIndex].store(page, std::memory_order_release);
+        }
+
+        std::string_view stored = str.empty() ? std::string_view("", 0) : Store(str);
+        page[id % EntriesPerPage] = stored;
+        ids.emplace(stored, id);
+        count.store(id + 1, std::memory_order_release);
+        return id;
+    }
+};
+
+StringTableData& GetData() {
+    static StringTableData data;
+    return data;
+}
+
+}  // namespace
+
+uint32_t StringTable::Intern(std::string_view str) {
+    if (str.empty()) {
+        return EmptyId;
+    }
+
+    VEST_MEMORY_TAG(Strings);
+    StringTableData& data = GetData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    auto it = data.ids.find(str);
+    if (it != data.ids.end()) {
+        return it->second;
+    }
+    return data.Append(str);
+}
+
+std::optional<uint32_t> StringTable::Find(std::string_view str) {
+    if (str.empty()) {
+        return EmptyId;
+    }
+
+    StringTableData& data = GetData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    auto it = data.ids.find(str);
+    if (it == data.ids.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::string_view StringTable::Lookup(uint32_t id) {
+    StringTableData& data = GetData();
+    if (id >= data.count.load(std::memory_order_acquire)) {
+        return std::string_view("", 0);
+    }
+    const std::string_view* page = data.pages[id / EntriesPerPage].load(std::memory_order_acquire);
+    return page[id % EntriesPerPage];
+}
+
+size_t StringTable::GetStringCount() {
+    return GetData().count.load(std::memory_order_acquire);
+}
+
+size_t StringTable::GetArenaBytes() {
+    StringTableData& data = GetData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    return data.arenaBytes;
+}
+
+}  // namespace Vest
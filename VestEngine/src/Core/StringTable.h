@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace Vest {
+
+/**
+ * @brief Process-wide string intern table
+ *
+ * Each distinct string is copied once into an append-only arena and given a
+ * 32-bit ID. Interning takes a lock; resolving an ID back to its characters
+ * is lock-free, so names can be read from any thread. Strings are never
+ * released until process exit. ID 0 is always the empty string.
+ */
+class StringTable {
+public:
+    static constexpr uint32_t EmptyId = 0;
+
+    /**
+     * @brief Return the ID for a string, adding it to the table if new
+     */
+    static uint32_t Intern(std::string_view str);
+
+    /**
+     * @brief ID of a string already in the table; unlike Intern() it never adds one
+     */
+    static std::optional<uint32_t> Find(std::string_view str);
+
+    /**
+     * @brief Resolve an ID; the returned view is null-terminated and stays valid forever
+     */
+    static std::string_view Lookup(uint32_t id);
+
+    static size_t GetStringCount();
+    static size_t GetArenaBytes();
+};
+
+/**
+ * @brief 32-bit handle to an interned string
+ *
+ * Copying and comparing are integer operations and never allocate, which
+ * makes it suitable for per-entity data that gets duplicated by snapshots
+ * and undo history. Implicitly constructible from string types so it can be
+ * assigned like a std::string.
+ */
+class InternedString {
+public:
+    InternedString() = default;
+    InternedString(std::string_view str) : m_Id(StringTable::Intern(str)) {}
+    InternedString(const std::string& str) : InternedString(std::string_view(str)) {}
+    InternedString(const char* str) : InternedString(std::string_view(str)) {}
+
+    static InternedString FromId(uint32_t id) {
+        InternedString result;
+        result.m_Id = id;
+        return result;
+    }
+
+    uint32_t GetId() const { return m_Id; }
+    bool Empty() const { return m_Id == StringTable::EmptyId; }
+
+    std::string_view View() const { return StringTable::Lookup(m_Id); }
+    const char* CStr() const { return View().data(); }
+    std::string Str() const { return std::string(View()); }
+
+    friend bool operator==(InternedString a, InternedString b) { return a.m_Id == b.m_Id; }
+    friend bool operator==(InternedString a, std::string_view b) { return a.View() == b; }
+    friend bool operator==(InternedString a, const std::string& b) { return a.View() == b; }
+    friend bool operator==(InternedString a, const char* b) { return a.View() == b; }
+
+    friend std::ostream& operator<<(std::ostream& os, InternedString str) { return os << str.View(); }
+
+private:
+    uint32_t m_Id = StringTable::EmptyId;
+};
+
+}  // namespace Vest
+
+template <>
+struct std::hash<Vest::InternedString> {
+    size_t operator()(const Vest::InternedString& str) const noexcept {
+        return std::hash<uint32_t>{}(str.GetId());
+    }
+};
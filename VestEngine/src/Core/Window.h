@@ -1,10 +1,12 @@
 #pragma once
 
-#include <functional>
+#include <cstdint>
 #include <string>
 
 #include "Core/Base.h"
 #include "Core/Event.h"
+#include "Core/EventQueue.h"
+#include "Core/Input.h"
 
 namespace Vest {
 
@@ -16,21 +18,48 @@ struct WindowProps {
 
 class Window {
 public:
-    using EventCallbackFn = std::function<void(Event&)>;
-
     virtual ~Window() = default;
 
     virtual void OnUpdate() = 0;
 
+    /**
+     * @brief Block until an event arrives, PostEmptyEvent() is called or @p timeoutSeconds pass
+     */
+    virtual void WaitEvents(double timeoutSeconds) = 0;
+
+    /**
+     * @brief Wake a WaitEvents() in progress; callable from any thread
+     */
+    virtual void PostEmptyEvent() = 0;
+
+    /**
+     * @brief Input and window events received so far; a change means the user did something
+     */
+    virtual uint64_t GetEventCount() const = 0;
+
     virtual unsigned int GetWidth() const = 0;
     virtual unsigned int GetHeight() const = 0;
 
-    virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
+    /**
+     * @brief Events received by the last OnUpdate()/WaitEvents(), waiting to be drained
+     */
+    virtual EventQueue& GetEventQueue() = 0;
+
+    /**
+     * @brief Copy of the live input state; resets the per-snapshot accumulators (scroll)
+     */
+    virtual InputState TakeInputState() = 0;
+
     virtual void SetVSync(bool enabled) = 0;
     virtual bool IsVSync() const = 0;
 
     virtual void* GetNativeWindow() const = 0;
 
+    // Bind or unbind the graphics context on the calling thread; used to hand
+    // it over to the render thread
+    virtual void MakeContextCurrent() = 0;
+    virtual void ReleaseContext() = 0;
+
     static Scope<Window> Create(const WindowProps& props = WindowProps());
 };
 
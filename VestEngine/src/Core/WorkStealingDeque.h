@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Vest {
+
+/**
+ * @brief Lock-free Chase-Lev work-stealing deque
+ *
+ * The owning thread pushes and pops at the bottom (LIFO, cache-warm work);
+ * any other thread may steal from the top (FIFO, oldest and usually
+ * largest work). The ring buffer grows on demand. Buffers that were
+ * replaced are kept until destruction because a concurrent thief may still
+ * be reading from them.
+ *
+ * Memory ordering follows Le et al., "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (PPoPP 2013).
+ */
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque stores trivially copyable values (e.g. pointers)");
+
+public:
+    explicit WorkStealingDeque(size_t initialCapacity = 1024) {
+        size_t capacity = 1;
+        while (capacity < initialCapacity) {
+            capacity <<= 1;
+        }
+        m_Buffers.push_back(std::make_unique<Buffer>(static_cast<int64_t>(capacity)));
+        m_Buffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Owner only: add an item at the bottom
+     */
+    void Push(T item) {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_acquire);
+        Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = Grow(buffer, bottom, top);
+        }
+        buffer->Store(bottom, item);
+        // Publishes the item to thieves (their acquire load of m_Bottom)
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Owner only: take the most recently pushed item
+     */
+    bool Pop(T& out) {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = buffer->Load(bottom);
+        if (top == bottom) {
+            // Last item: race against thieves for it
+            const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                           std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Any thread: take the oldest item
+     * @return false if empty or another thread won the race
+     */
+    bool Steal(T& out) {
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+        T item = buffer->Load(top);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        out = item;
+        return true;
+    }
+
+    /**
+     * @brief Approximate item count; exact only when no other thread is active
+     */
+    size_t Size() const {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+private:
+    struct Buffer {
+        explicit Buffer(int64_t size)
+            : capacity(size), mask(size - 1), items(std::make_unique<std::atomic<T>[]>(static_cast<size_t>(size))) {}
+
+        T Load(int64_t index) const { return items[index & mask].load(std::memory_order_relaxed); }
+        void Store(int64_t index, T item) { items[index & mask].store(item, std::memory_order_relaxed); }
+
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    Buffer* Grow(Buffer* old, int64_t bottom, int64_t top) {
+        auto grown = std::make_unique<Buffer>(old->capacity * 2);
+        for (int64_t i = top; i < bottom; ++i) {
+            grown->Store(i, old->Load(i));
+        }
+        Buffer* result = grown.get();
+        m_Buffers.push_back(std::move(grown));
+        m_Buffer.store(result, std::memory_order_release);
+        return result;
+    }
+
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) std::atomic<Buffer*> m_Buffer{nullptr};
+    std::vector<std::unique_ptr<Buffer>> m_Buffers;  // Owner only; includes retired buffers
+};
+
+}  // namespace Vest
@@ -1,5 +1,8 @@
 #include "ImGui/ImGuiLayer.h"
 
+#include <cstring>
+#include <new>
+
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <backends/imgui_impl_glfw.h>
@@ -7,21 +10,109 @@
 
 #include "Core/Application.h"
 #include "Core/Event.h"
+#include "Core/MemoryTracker.h"
 #include "Core/Window.h"
+#include "Rendering/RenderThread.h"
 
 #include <GLFW/glfw3.h>
 
 namespace Vest {
 
-ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer") {}
+namespace {
+
+template <typename T>
+void CopyVector(ImVector<T>& destination, const ImVector<T>& source) {
+    // resize() keeps the existing capacity, unlike ImVector's operator=
+    destination.resize(source.Size);
+    if (source.Size > 0) {
+        std::memcpy(destination.Data, source.Data, static_cast<size_t>(source.size_in_bytes()));
+    }
+}
+
+#ifdef VEST_TRACK_HEAP_ALLOCATIONS
+// ImGui allocates with malloc by default, which the tracker does not see
+void* TrackedImGuiAllocate(size_t size, void*) {
+    VEST_MEMORY_TAG(ImGui);
+    return ::operator new(size, std::nothrow);
+}
+
+void TrackedImGuiFree(void* memory, void*) {
+    ::operator delete(memory);
+}
+#endif
+
+}  // namespace
+
+// Copies of a frame's draw data, so the render thread can draw it while the
+// main thread already builds the next ImGui frame. Two copies alternate and
+// their buffers are reused, so a steady frame copies without allocating.
+struct ImGuiLayer::DrawDataSnapshots {
+    struct Snapshot {
+        ImDrawData data;
+        ImVector<ImDrawList*> lists;
+    };
+
+    Snapshot snapshots[2];
+    uint32_t next = 0;
+
+    ~DrawDataSnapshots() {
+        for (Snapshot& snapshot : snapshots) {
+            for (ImDrawList* list : snapshot.lists) {
+                IM_DELETE(list);
+            }
+        }
+    }
+
+    ImDrawData* Capture(ImDrawData& source) {
+        Snapshot& snapshot = snapshots[next];
+        next ^= 1;
+
+        // Copy the header fields without ImVector's reallocating assignment
+        ImVector<ImDrawList*> ownLists;
+        ImVector<ImDrawList*> sourceLists;
+        ownLists.swap(snapshot.data.CmdLists);
+        sourceLists.swap(source.CmdLists);
+        snapshot.data = source;
+        source.CmdLists.swap(sourceLists);
+        snapshot.data.CmdLists.swap(ownLists);
+
+        const int count = source.CmdLists.Size;
+        while (snapshot.lists.Size < count) {
+            snapshot.lists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+        }
+        snapshot.data.CmdLists.resize(count);
+        for (int i = 0; i < count; ++i) {
+            const ImDrawList* from = source.CmdLists[i];
+            ImDrawList* to = snapshot.lists[i];
+            CopyVector(to->CmdBuffer, from->CmdBuffer);
+            CopyVector(to->IdxBuffer, from->IdxBuffer);
+            CopyVector(to->VtxBuffer, from->VtxBuffer);
+            to->Flags = from->Flags;
+            snapshot.data.CmdLists[i] = to;
+        }
+        return &snapshot.data;
+    }
+};
+
+ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer"), m_DrawDataSnapshots(CreateScope<DrawDataSnapshots>()) {}
+
+ImGuiLayer::~ImGuiLayer() = default;
 
 void ImGuiLayer::OnAttach() {
     IMGUI_CHECKVERSION();
+#ifdef VEST_TRACK_HEAP_ALLOCATIONS
+    ImGui::SetAllocatorFunctions(TrackedImGuiAllocate, TrackedImGuiFree);
+#endif
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
     io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+    if (RenderThread::GetPolicy() == RenderThreadPolicy::MultiThreaded) {
+        // Platform windows create and render with their own GL contexts on the
+        // main thread, which would conflict with the render thread's context
+        io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+    }
 
     ImGui::StyleColorsDark();
     ImGuiStyle& style = ImGui::GetStyle();
@@ -34,11 +125,17 @@ void ImGuiLayer::OnAttach() {
     GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
 
     ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 410");
+    RenderThread::Submit([]() {
+        ImGui_ImplOpenGL3_Init("#version 410");
+        // Creates the shaders and font texture before the first frame is recorded
+        ImGui_ImplOpenGL3_NewFrame();
+    });
+    RenderThread::Flush();
 }
 
 void ImGuiLayer::OnDetach() {
-    ImGui_ImplOpenGL3_Shutdown();
+    RenderThread::Submit([]() { ImGui_ImplOpenGL3_Shutdown(); });
+    RenderThread::Flush();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 }
@@ -48,12 +145,14 @@ void ImGuiLayer::OnEvent(Event& event) {
         return;
     }
 
+    // Input aimed at an ImGui window does not reach the layers below
     ImGuiIO& io = ImGui::GetIO();
-    event.handled |= event.GetEventType() == EventType::WindowResize && io.WantCaptureMouse;
+    event.handled |= event.IsInCategory(EventCategoryMouse) && io.WantCaptureMouse;
+    event.handled |= event.IsInCategory(EventCategoryKeyboard) && io.WantCaptureKeyboard;
 }
 
 void ImGuiLayer::Begin() {
-    ImGui_ImplOpenGL3_NewFrame();
+    RenderThread::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
 }
@@ -62,9 +161,16 @@ void ImGuiLayer::End() {
     ImGuiIO& io = ImGui::GetIO();
     Application& app = Application::Get();
     io.DisplaySize = ImVec2(static_cast<float>(app.GetWindow().GetWidth()), static_cast<float>(app.GetWindow().GetHeight()));
+    if (io.WantTextInput) {
+        // Keeps the text cursor blinking while the main loop would otherwise idle
+        app.RequestFrame();
+    }
 
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (ImDrawData* drawData = ImGui::GetDrawData(); drawData && drawData->Valid) {
+        ImDrawData* snapshot = m_DrawDataSnapshots->Capture(*drawData);
+        RenderThread::Submit([snapshot]() { ImGui_ImplOpenGL3_RenderDrawData(snapshot); });
+    }
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
         GLFWwindow* backupCurrentContext = glfwGetCurrentContext();
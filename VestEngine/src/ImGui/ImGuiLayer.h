@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Base.h"
 #include "Core/Layer.h"
 
 namespace Vest {
@@ -7,7 +8,7 @@ namespace Vest {
 class ImGuiLayer : public Layer {
 public:
     ImGuiLayer();
-    ~ImGuiLayer() override = default;
+    ~ImGuiLayer() override;
 
     void OnAttach() override;
     void OnDetach() override;
@@ -19,6 +20,9 @@ public:
     void SetBlockEvents(bool block) { m_BlockEvents = block; }
 
 private:
+    struct DrawDataSnapshots;
+
+    Scope<DrawDataSnapshots> m_DrawDataSnapshots;
     bool m_BlockEvents = false;
     float m_Time = 0.0f;
 };
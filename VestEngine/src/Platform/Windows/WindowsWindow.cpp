@@ -4,6 +4,7 @@
 
 #include "Core/Event.h"
 #include "Rendering/Platform/OpenGL/OpenGLContext.h"
+#include "Rendering/RenderThread.h"
 
 namespace Vest {
 
@@ -59,24 +60,88 @@ void WindowsWindow::Init(const WindowProps& props) {
     glfwSetWindowUserPointer(m_Window, &m_Data);
     SetVSync(true);
 
+    double cursorX = 0.0;
+    double cursorY = 0.0;
+    glfwGetCursorPos(m_Window, &cursorX, &cursorY);
+    m_Data.input.mousePosition = glm::vec2(static_cast<float>(cursorX), static_cast<float>(cursorY));
+
+    // Callbacks only record: events are queued for Application to drain next
+    // frame and the live input state is updated for the next snapshot. The
+    // ImGui backend installs its own callbacks later and chains to these.
     glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
-        WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        WindowData& data = OnWindowEvent(window);
         data.width = static_cast<unsigned int>(width);
         data.height = static_cast<unsigned int>(height);
+        data.events.Push(WindowResizeEvent(data.width, data.height));
+    });
+
+    glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
+        OnWindowEvent(window).events.Push(WindowCloseEvent());
+    });
 
-        WindowResizeEvent event(data.width, data.height);
-        if (data.eventCallback) {
-            data.eventCallback(event);
+    glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, int focused) {
+        WindowData& data = OnWindowEvent(window);
+        data.input.focused = focused == GLFW_TRUE;
+        if (!data.input.focused) {
+            // Releases are not reported to an unfocused window
+            data.input.keys.reset();
+            data.input.mouseButtons.reset();
         }
+        data.events.Push(WindowFocusEvent(data.input.focused));
     });
 
-    glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
-        WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-        WindowCloseEvent event;
-        if (data.eventCallback) {
-            data.eventCallback(event);
+    glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int, int action, int mods) {
+        WindowData& data = OnWindowEvent(window);
+        if (key >= 0 && key < InputState::KeyCount) {
+            data.input.keys.set(static_cast<size_t>(key), action != GLFW_RELEASE);
+        }
+        if (action == GLFW_RELEASE) {
+            data.events.Push(KeyReleasedEvent(key, mods));
+        } else {
+            data.events.Push(KeyPressedEvent(key, mods, action == GLFW_REPEAT));
+        }
+    });
+
+    glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int codepoint) {
+        OnWindowEvent(window).events.Push(KeyTypedEvent(codepoint));
+    });
+
+    glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods) {
+        WindowData& data = OnWindowEvent(window);
+        if (button >= 0 && button < InputState::MouseButtonCount) {
+            data.input.mouseButtons.set(static_cast<size_t>(button), action == GLFW_PRESS);
         }
+        if (action == GLFW_PRESS) {
+            data.events.Push(MouseButtonPressedEvent(button, mods));
+        } else {
+            data.events.Push(MouseButtonReleasedEvent(button, mods));
+        }
+    });
+
+    glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double x, double y) {
+        WindowData& data = OnWindowEvent(window);
+        data.input.mousePosition = glm::vec2(static_cast<float>(x), static_cast<float>(y));
+        data.events.Push(MouseMovedEvent(data.input.mousePosition.x, data.input.mousePosition.y));
     });
+
+    glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset) {
+        WindowData& data = OnWindowEvent(window);
+        const glm::vec2 offset(static_cast<float>(xOffset), static_cast<float>(yOffset));
+        data.input.scrollDelta += offset;
+        data.events.Push(MouseScrolledEvent(offset.x, offset.y));
+    });
+
+    // Not forwarded as events, but they still mean the window needs a frame
+    glfwSetCursorEnterCallback(m_Window, [](GLFWwindow* window, int) { OnWindowEvent(window); });
+    glfwSetWindowRefreshCallback(m_Window, [](GLFWwindow* window) { OnWindowEvent(window); });
+    glfwSetDropCallback(m_Window, [](GLFWwindow* window, int, const char**) { OnWindowEvent(window); });
+}
+
+WindowsWindow::WindowData& WindowsWindow::OnWindowEvent(GLFWwindow* window) {
+    WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+    // Counts activity for the idle main loop
+    ++data.eventCount;
+    return data;
 }
 
 void WindowsWindow::Shutdown() {
@@ -88,12 +153,36 @@ void WindowsWindow::Shutdown() {
 
 void WindowsWindow::OnUpdate() {
     glfwPollEvents();
-    m_Context->SwapBuffers();
+
+    OpenGLContext* context = m_Context.get();
+    RenderThread::Submit([context]() { context->SwapBuffers(); });
+}
+
+void WindowsWindow::WaitEvents(double timeoutSeconds) {
+    glfwWaitEventsTimeout(timeoutSeconds);
+}
+
+void WindowsWindow::PostEmptyEvent() {
+    glfwPostEmptyEvent();
+}
+
+InputState WindowsWindow::TakeInputState() {
+    InputState state = m_Data.input;
+    m_Data.input.scrollDelta = glm::vec2(0.0f);
+    return state;
 }
 
 void WindowsWindow::SetVSync(bool enabled) {
-    glfwSwapInterval(enabled ? 1 : 0);
+    RenderThread::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
     m_Data.vSync = enabled;
 }
 
+void WindowsWindow::MakeContextCurrent() {
+    m_Context->MakeCurrent();
+}
+
+void WindowsWindow::ReleaseContext() {
+    m_Context->Release();
+}
+
 }  // namespace Vest
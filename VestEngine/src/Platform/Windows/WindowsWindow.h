@@ -16,16 +16,23 @@ public:
     ~WindowsWindow() override;
 
     void OnUpdate() override;
+    void WaitEvents(double timeoutSeconds) override;
+    void PostEmptyEvent() override;
+    uint64_t GetEventCount() const override { return m_Data.eventCount; }
 
     unsigned int GetWidth() const override { return m_Data.width; }
     unsigned int GetHeight() const override { return m_Data.height; }
 
-    void SetEventCallback(const EventCallbackFn& callback) override { m_Data.eventCallback = callback; }
+    EventQueue& GetEventQueue() override { return m_Data.events; }
+    InputState TakeInputState() override;
     void SetVSync(bool enabled) override;
     bool IsVSync() const override { return m_Data.vSync; }
 
     void* GetNativeWindow() const override { return m_Window; }
 
+    void MakeContextCurrent() override;
+    void ReleaseContext() override;
+
 private:
     void Init(const WindowProps& props);
     void Shutdown();
@@ -38,8 +45,12 @@ private:
         unsigned int width = 0;
         unsigned int height = 0;
         bool vSync = true;
-        EventCallbackFn eventCallback;
+        uint64_t eventCount = 0;
+        EventQueue events;
+        InputState input;
     } m_Data;
+
+    static WindowData& OnWindowEvent(GLFWwindow* window);
 };
 
 }  // namespace Vest
@@ -2,6 +2,8 @@
 
 #include <cassert>
 
+#include "Rendering/RenderThread.h"
+#include "Rendering/Platform/Null/NullBuffer.h"
 #include "Rendering/Platform/OpenGL/OpenGLBuffer.h"
 #include "Rendering/Platform/Vulkan/VulkanBuffer.h"
 
@@ -46,12 +48,14 @@ void BufferLayout::CalculateOffsetsAndStride() {
     }
 }
 
-Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+Ref<VertexBuffer> VertexBuffer::Create(uint32_t size, const std::source_location& site) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLVertexBuffer>(size);
+            return CreateRenderResource<OpenGLVertexBuffer>(size, site);
         case RenderAPI::Vulkan:
             return CreateRef<VulkanVertexBuffer>(size);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullVertexBuffer>(size, site);
         case RenderAPI::None:
         default:
             assert(false && "Unknown RenderAPI");
@@ -59,12 +63,14 @@ Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
     }
 }
 
-Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
+Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size, const std::source_location& site) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLVertexBuffer>(vertices, size);
+            return CreateRenderResource<OpenGLVertexBuffer>(vertices, size, site);
         case RenderAPI::Vulkan:
             return CreateRef<VulkanVertexBuffer>(vertices, size);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullVertexBuffer>(vertices, size, site);
         case RenderAPI::None:
         default:
             assert(false && "Unknown RenderAPI");
@@ -72,12 +78,14 @@ Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
     }
 }
 
-Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
+Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count, const std::source_location& site) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLIndexBuffer>(indices, count);
+            return CreateRenderResource<OpenGLIndexBuffer>(indices, count, site);
         case RenderAPI::Vulkan:
             return CreateRef<VulkanIndexBuffer>(indices, count);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullIndexBuffer>(indices, count, site);
         case RenderAPI::None:
         default:
             assert(false && "Unknown RenderAPI");
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <initializer_list>
+#include <source_location>
 #include <string>
 #include <vector>
 
@@ -97,8 +98,10 @@ public:
     virtual const BufferLayout& GetLayout() const = 0;
     virtual void SetLayout(const BufferLayout& layout) = 0;
 
-    static Ref<VertexBuffer> Create(uint32_t size);
-    static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
+    static Ref<VertexBuffer> Create(uint32_t size,
+                                    const std::source_location& site = std::source_location::current());
+    static Ref<VertexBuffer> Create(float* vertices, uint32_t size,
+                                    const std::source_location& site = std::source_location::current());
 };
 
 class IndexBuffer {
@@ -110,7 +113,8 @@ public:
 
     virtual uint32_t GetCount() const = 0;
 
-    static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
+    static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count,
+                                   const std::source_location& site = std::source_location::current());
 };
 
 }  // namespace Vest
@@ -3,14 +3,18 @@
 #include <cassert>
 
 #include "Rendering/RendererAPI.h"
+#include "Rendering/RenderThread.h"
+#include "Rendering/Platform/Null/NullFramebuffer.h"
 #include "Rendering/Platform/OpenGL/OpenGLFramebuffer.h"
 
 namespace Vest {
 
-Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& spec) {
+Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& spec, const std::source_location& site) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLFramebuffer>(spec);
+            return CreateRenderResource<OpenGLFramebuffer>(spec, site);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullFramebuffer>(spec, site);
         case RenderAPI::Vulkan:
         case RenderAPI::None:
         default:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <source_location>
 
 #include "Core/Base.h"
 
@@ -20,11 +21,20 @@ public:
     virtual void Bind() = 0;
     virtual void Unbind() = 0;
 
+    /**
+     * @brief Reallocate the attachments in place; renderer IDs stay the same
+     */
+    virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+    /**
+     * @brief Assigned on the render thread: valid once a RenderThread::Flush() has followed creation
+     */
     virtual uint32_t GetColorAttachmentRendererID() const = 0;
 
     virtual const FramebufferSpecification& GetSpecification() const = 0;
 
-    static Ref<Framebuffer> Create(const FramebufferSpecification& spec);
+    static Ref<Framebuffer> Create(const FramebufferSpecification& spec,
+                                   const std::source_location& site = std::source_location::current());
 };
 
 }  // namespace Vest
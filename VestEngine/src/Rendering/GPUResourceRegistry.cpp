@@ -0,0 +1,168 @@
+#include "Rendering/GPUResourceRegistry.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+#include "Core/Log.h"
+
+namespace Vest {
+
+namespace {
+
+constexpr const char* TypeNames[] = {"Texture", "VertexBuffer", "IndexBuffer", "Framebuffer"};
+static_assert(std::size(TypeNames) == GPUResourceRegistry::TypeCount, "Name every GPUResourceType");
+
+struct State {
+    std::mutex mutex;
+    std::unordered_map<GPUResourceID, GPUResourceInfo> resources;
+    GPUResourceTotals totals[GPUResourceRegistry::TypeCount];
+    GPUResourceTotals total;
+    GPUResourceID nextID = 1;
+    uint64_t budget = 0;
+    bool overBudget = false;
+
+    void Add(GPUResourceType type, int64_t count, int64_t bytes) {
+        GPUResourceTotals& totalsOfType = totals[static_cast<size_t>(type)];
+        totalsOfType.count += static_cast<size_t>(count);
+        totalsOfType.bytes += static_cast<uint64_t>(bytes);
+        total.count += static_cast<size_t>(count);
+        total.bytes += static_cast<uint64_t>(bytes);
+        CheckBudget();
+    }
+
+    void CheckBudget() {
+        const bool over = budget > 0 && total.bytes > budget;
+        if (over && !overBudget) {
+            VEST_CORE_WARN("GPU memory {0:.1f} MB exceeds the {1:.1f} MB budget", total.bytes / (1024.0 * 1024.0),
+                           budget / (1024.0 * 1024.0));
+        }
+        overBudget = over;
+    }
+};
+
+State& GetState() {
+    static State state;
+    return state;
+}
+
+}  // namespace
+
+const char* GPUResourceRegistry::GetTypeName(GPUResourceType type) {
+    const size_t index = static_cast<size_t>(type);
+    return index < TypeCount ? TypeNames[index] : "Unknown";
+}
+
+GPUResourceID GPUResourceRegistry::Register(GPUResourceType type, uint64_t bytes, std::string name,
+                                            const std::source_location& site) {
+    GPUResourceInfo info;
+    info.type = type;
+    info.bytes = bytes;
+    info.site = std::filesystem::path(site.file_name()).filename().string() + ":" + std::to_string(site.line());
+    info.name = name.empty() ? std::string(GetTypeName(type)) + " " + info.site : std::move(name);
+
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    info.id = state.nextID++;
+    const GPUResourceID id = info.id;
+    state.resources.emplace(id, std::move(info));
+    state.Add(type, 1, static_cast<int64_t>(bytes));
+    return id;
+}
+
+void GPUResourceRegistry::Unregister(GPUResourceID id) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.resources.find(id);
+    if (it == state.resources.end()) {
+        return;
+    }
+    state.Add(it->second.type, -1, -static_cast<int64_t>(it->second.bytes));
+    state.resources.erase(it);
+}
+
+void GPUResourceRegistry::Resize(GPUResourceID id, uint64_t bytes) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.resources.find(id);
+    if (it == state.resources.end()) {
+        return;
+    }
+    state.Add(it->second.type, 0, static_cast<int64_t>(bytes) - static_cast<int64_t>(it->second.bytes));
+    it->second.bytes = bytes;
+}
+
+std::string GPUResourceRegistry::GetName(GPUResourceID id) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.resources.find(id);
+    return it != state.resources.end() ? it->second.name : std::string();
+}
+
+GPUResourceTotals GPUResourceRegistry::GetTotals(GPUResourceType type) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.totals[std::min(static_cast<size_t>(type), TypeCount - 1)];
+}
+
+GPUResourceTotals GPUResourceRegistry::GetTotal() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.total;
+}
+
+std::vector<GPUResourceInfo> GPUResourceRegistry::GetResources() {
+    std::vector<GPUResourceInfo> resources;
+    {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        resources.reserve(state.resources.size());
+        for (const auto& [id, info] : state.resources) {
+            resources.push_back(info);
+        }
+    }
+    std::sort(resources.begin(), resources.end(), [](const GPUResourceInfo& a, const GPUResourceInfo& b) {
+        return a.bytes != b.bytes ? a.bytes > b.bytes : a.id < b.id;
+    });
+    return resources;
+}
+
+void GPUResourceRegistry::SetBudget(uint64_t bytes) {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.budget = bytes;
+    state.CheckBudget();
+}
+
+uint64_t GPUResourceRegistry::GetBudget() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.budget;
+}
+
+bool GPUResourceRegistry::IsOverBudget() {
+    State& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.overBudget;
+}
+
+size_t GPUResourceRegistry::ReportLeaks() {
+    const std::vector<GPUResourceInfo> resources = GetResources();
+    if (resources.empty()) {
+        VEST_CORE_INFO("No GPU resources leaked");
+        return 0;
+    }
+
+    uint64_t bytes = 0;
+    for (const GPUResourceInfo& info : resources) {
+        VEST_CORE_WARN("Leaked {0} '{1}' ({2} bytes), created at {3}", GetTypeName(info.type), info.name, info.bytes,
+                       info.site);
+        bytes += info.bytes;
+    }
+    VEST_CORE_WARN("{0} GPU resources leaked, {1:.1f} KB", resources.size(), bytes / 1024.0);
+    return resources.size();
+}
+
+}  // namespace Vest
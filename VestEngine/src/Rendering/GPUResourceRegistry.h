@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string>
+#include <vector>
+
+namespace Vest {
+
+enum class GPUResourceType : uint8_t {
+    Texture = 0,
+    VertexBuffer,
+    IndexBuffer,
+    Framebuffer,
+    Count
+};
+
+using GPUResourceID = uint64_t;  // 0 is never assigned
+
+struct GPUResourceInfo {
+    GPUResourceID id = 0;
+    GPUResourceType type = GPUResourceType::Texture;
+    uint64_t bytes = 0;  // Estimated from the requested storage, without driver padding
+    std::string name;    // Also the graphics API debug label
+    std::string site;    // file:line of the Create() call
+};
+
+struct GPUResourceTotals {
+    size_t count = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Every live GPU resource with its estimated size and creation site
+ *
+ * Backends register a resource when the object is constructed on the main
+ * thread and unregister it in the destructor, which runs on the render
+ * thread; all functions are therefore thread-safe. Totals are kept per
+ * type so the stats panel can show VRAM use without walking the list.
+ *
+ * Application reports every resource still registered once the layers
+ * and renderer have shut down, which catches e.g. framebuffers recreated
+ * on resize and never released. With a budget set, crossing it logs one
+ * warning until usage falls back below it.
+ */
+class GPUResourceRegistry {
+public:
+    static constexpr size_t TypeCount = static_cast<size_t>(GPUResourceType::Count);
+
+    static const char* GetTypeName(GPUResourceType type);
+
+    /**
+     * @param name Debug name; empty derives one from the type and @p site
+     */
+    static GPUResourceID Register(GPUResourceType type, uint64_t bytes, std::string name,
+                                  const std::source_location& site);
+    static void Unregister(GPUResourceID id);
+
+    /**
+     * @brief Update the size after the storage was respecified, e.g. on framebuffer resize
+     */
+    static void Resize(GPUResourceID id, uint64_t bytes);
+
+    static std::string GetName(GPUResourceID id);
+
+    static GPUResourceTotals GetTotals(GPUResourceType type);
+    static GPUResourceTotals GetTotal();
+
+    /**
+     * @brief Snapshot of the live resources, largest first
+     */
+    static std::vector<GPUResourceInfo> GetResources();
+
+    /**
+     * @brief Warn once the total exceeds @p bytes; 0 disables the budget
+     */
+    static void SetBudget(uint64_t bytes);
+    static uint64_t GetBudget();
+    static bool IsOverBudget();
+
+    /**
+     * @brief Log every resource still registered; returns how many there are
+     */
+    static size_t ReportLeaks();
+};
+
+}  // namespace Vest
@@ -0,0 +1,47 @@
+#include "Rendering/Platform/Null/NullBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Core/FrameAllocator.h"
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/RenderThread.h"
+
+namespace Vest {
+
+NullVertexBuffer::NullVertexBuffer(uint32_t size, const std::source_location& site)
+    : m_RendererID(NullRendererAPI::GenerateID()),
+      m_Resource(GPUResourceRegistry::Register(GPUResourceType::VertexBuffer, size, {}, site)),
+      m_Data(size) {}
+
+NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size, const std::source_location& site)
+    : m_RendererID(NullRendererAPI::GenerateID()),
+      m_Resource(GPUResourceRegistry::Register(GPUResourceType::VertexBuffer, size, {}, site)) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(vertices);
+    m_Data.assign(bytes, bytes + size);
+}
+
+NullVertexBuffer::~NullVertexBuffer() {
+    GPUResourceRegistry::Unregister(m_Resource);
+}
+
+void NullVertexBuffer::SetData(const void* data, uint32_t size) {
+    // Copied through frame memory like OpenGLVertexBuffer, so the submission cost matches
+    void* copy = FrameAllocator::Allocate(size);
+    std::memcpy(copy, data, size);
+    RenderThread::Submit([this, copy, size]() {
+        std::memcpy(m_Data.data(), copy, std::min<size_t>(size, m_Data.size()));
+    });
+}
+
+NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count, const std::source_location& site)
+    : m_RendererID(NullRendererAPI::GenerateID()),
+      m_Resource(GPUResourceRegistry::Register(GPUResourceType::IndexBuffer,
+                                               static_cast<uint64_t>(count) * sizeof(uint32_t), {}, site)),
+      m_Indices(indices, indices + count) {}
+
+NullIndexBuffer::~NullIndexBuffer() {
+    GPUResourceRegistry::Unregister(m_Resource);
+}
+
+}  // namespace Vest
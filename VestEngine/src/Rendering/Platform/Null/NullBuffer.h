@@ -0,0 +1,61 @@
+#pragma once
+
+#include <source_location>
+#include <vector>
+
+#include "Rendering/Buffer.h"
+#include "Rendering/GPUResourceRegistry.h"
+
+namespace Vest {
+
+/**
+ * @brief Vertex data kept in CPU memory; SetData() lands in frame order like an upload
+ */
+class NullVertexBuffer : public VertexBuffer {
+public:
+    NullVertexBuffer(uint32_t size, const std::source_location& site);
+    NullVertexBuffer(float* vertices, uint32_t size, const std::source_location& site);
+    ~NullVertexBuffer() override;
+
+    void Bind() const override {}
+    void Unbind() const override {}
+
+    void SetData(const void* data, uint32_t size) override;
+
+    const BufferLayout& GetLayout() const override { return m_Layout; }
+    void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+    /**
+     * @brief Render thread only
+     */
+    const std::vector<uint8_t>& GetData() const { return m_Data; }
+
+private:
+    uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
+    BufferLayout m_Layout;
+    std::vector<uint8_t> m_Data;
+};
+
+class NullIndexBuffer : public IndexBuffer {
+public:
+    NullIndexBuffer(uint32_t* indices, uint32_t count, const std::source_location& site);
+    ~NullIndexBuffer() override;
+
+    void Bind() const override {}
+    void Unbind() const override {}
+
+    uint32_t GetCount() const override { return static_cast<uint32_t>(m_Indices.size()); }
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+    const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+
+private:
+    uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
+    std::vector<uint32_t> m_Indices;
+};
+
+}  // namespace Vest
@@ -0,0 +1,50 @@
+#include "Rendering/Platform/Null/NullFramebuffer.h"
+
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/RenderThread.h"
+
+namespace Vest {
+
+namespace {
+
+uint64_t GetAttachmentBytes(const FramebufferSpecification& spec) {
+    return static_cast<uint64_t>(spec.width) * spec.height * 4;
+}
+
+}  // namespace
+
+NullFramebuffer::NullFramebuffer(const FramebufferSpecification& spec, const std::source_location& site)
+    : m_RendererID(NullRendererAPI::GenerateID()),
+      m_ColorAttachment(NullRendererAPI::GenerateID()),
+      m_Resource(GPUResourceRegistry::Register(GPUResourceType::Framebuffer, GetAttachmentBytes(spec), {}, site)),
+      m_Specification(spec) {}
+
+NullFramebuffer::~NullFramebuffer() {
+    GPUResourceRegistry::Unregister(m_Resource);
+}
+
+void NullFramebuffer::Bind() {
+    const uint32_t width = m_Specification.width;
+    const uint32_t height = m_Specification.height;
+    // Sets the viewport like OpenGLFramebuffer::Bind()
+    RenderThread::Submit([this, width, height]() {
+        NullRendererAPI::BindFramebuffer(m_RendererID);
+        NullRendererAPI::BindViewport(0, 0, width, height);
+    });
+}
+
+void NullFramebuffer::Unbind() {
+    RenderThread::Submit([]() { NullRendererAPI::BindFramebuffer(0); });
+}
+
+void NullFramebuffer::Resize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || (width == m_Specification.width && height == m_Specification.height)) {
+        return;
+    }
+
+    m_Specification.width = width;
+    m_Specification.height = height;
+    GPUResourceRegistry::Resize(m_Resource, GetAttachmentBytes(m_Specification));
+}
+
+}  // namespace Vest
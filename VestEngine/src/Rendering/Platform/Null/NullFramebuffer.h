@@ -0,0 +1,33 @@
+#pragma once
+
+#include <source_location>
+
+#include "Rendering/Framebuffer.h"
+#include "Rendering/GPUResourceRegistry.h"
+
+namespace Vest {
+
+class NullFramebuffer : public Framebuffer {
+public:
+    NullFramebuffer(const FramebufferSpecification& spec, const std::source_location& site);
+    ~NullFramebuffer() override;
+
+    void Bind() override;
+    void Unbind() override;
+
+    void Resize(uint32_t width, uint32_t height) override;
+
+    uint32_t GetColorAttachmentRendererID() const override { return m_ColorAttachment; }
+
+    const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+private:
+    uint32_t m_RendererID = 0;
+    uint32_t m_ColorAttachment = 0;
+    GPUResourceID m_Resource = 0;
+    FramebufferSpecification m_Specification;
+};
+
+}  // namespace Vest
@@ -0,0 +1,144 @@
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+
+#include <atomic>
+
+#include "Core/Log.h"
+#include "Rendering/Platform/Null/NullShader.h"
+#include "Rendering/VertexArray.h"
+
+namespace Vest {
+
+namespace {
+
+struct Recorder {
+    NullRenderState state;
+    const NullShader* shader = nullptr;
+    NullRenderStats stats;
+    std::vector<NullDrawCall> drawCalls;
+    bool recordDrawCalls = true;
+};
+
+Recorder s_Recorder;
+std::atomic<uint32_t> s_NextID{1};
+
+template <typename T>
+void SetState(T& current, const T& value) {
+    if (current == value) {
+        ++s_Recorder.stats.redundantChanges;
+        return;
+    }
+    current = value;
+    ++s_Recorder.stats.stateChanges;
+}
+
+void RecordDraw(NullDrawMode mode, uint32_t count) {
+    ++s_Recorder.stats.drawCalls;
+    s_Recorder.stats.elements += count;
+    if (!s_Recorder.recordDrawCalls) {
+        return;
+    }
+
+    NullDrawCall& call = s_Recorder.drawCalls.emplace_back();
+    call.mode = mode;
+    call.count = count;
+    call.state = s_Recorder.state;
+    if (s_Recorder.shader) {
+        call.shaderName = s_Recorder.shader->GetName();
+        const auto& uniforms = s_Recorder.shader->GetUniforms();
+        call.uniforms.assign(uniforms.begin(), uniforms.end());
+    }
+}
+
+}  // namespace
+
+void NullRendererAPI::Init() {
+    VEST_CORE_INFO("Null renderer initializing: draw calls are recorded, nothing is drawn");
+    s_Recorder.state = NullRenderState();
+    s_Recorder.shader = nullptr;
+    ResetRecording();
+}
+
+void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    BindViewport(x, y, width, height);
+}
+
+void NullRendererAPI::SetClearColor(const glm::vec4& color) {
+    SetState(s_Recorder.state.clearColor, color);
+}
+
+void NullRendererAPI::Clear() {
+    ++s_Recorder.stats.clears;
+}
+
+void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+    RecordDraw(NullDrawMode::Triangles, indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount());
+}
+
+void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) {
+    // Binds its vertex array like the OpenGL backend
+    vertexArray->Bind();
+    RecordDraw(NullDrawMode::Lines, vertexCount);
+}
+
+const NullRenderState& NullRendererAPI::GetState() {
+    return s_Recorder.state;
+}
+
+const NullRenderStats& NullRendererAPI::GetStats() {
+    return s_Recorder.stats;
+}
+
+const std::vector<NullDrawCall>& NullRendererAPI::GetDrawCalls() {
+    return s_Recorder.drawCalls;
+}
+
+void NullRendererAPI::SetRecordDrawCalls(bool record) {
+    s_Recorder.recordDrawCalls = record;
+}
+
+void NullRendererAPI::ResetRecording() {
+    s_Recorder.stats = NullRenderStats();
+    s_Recorder.drawCalls.clear();
+}
+
+uint32_t NullRendererAPI::GenerateID() {
+    return s_NextID.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NullRendererAPI::BindShader(const NullShader* shader, uint32_t id) {
+    s_Recorder.shader = shader;
+    SetState(s_Recorder.state.shader, id);
+}
+
+void NullRendererAPI::BindVertexArray(uint32_t id) {
+    SetState(s_Recorder.state.vertexArray, id);
+}
+
+void NullRendererAPI::BindTexture(uint32_t slot, uint32_t id) {
+    if (slot >= NullRenderState::MaxTextureSlots) {
+        VEST_CORE_ERROR("Texture slot {0} out of range", slot);
+        return;
+    }
+    SetState(s_Recorder.state.textures[slot], id);
+}
+
+void NullRendererAPI::BindFramebuffer(uint32_t id) {
+    SetState(s_Recorder.state.framebuffer, id);
+}
+
+void NullRendererAPI::BindViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    SetState(s_Recorder.state.viewport, glm::uvec4(x, y, width, height));
+}
+
+void NullRendererAPI::CountUniformUpload() {
+    ++s_Recorder.stats.uniformUploads;
+}
+
+void NullRendererAPI::OnShaderDestroyed(const NullShader* shader) {
+    if (s_Recorder.shader == shader) {
+        s_Recorder.shader = nullptr;
+        s_Recorder.state.shader = 0;
+    }
+}
+
+}  // namespace Vest
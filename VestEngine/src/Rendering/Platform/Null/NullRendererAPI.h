@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Rendering/RendererAPI.h"
+
+namespace Vest {
+
+class NullShader;
+
+using NullUniformValue = std::variant<int, glm::vec3, glm::vec4, glm::mat4>;
+
+/**
+ * @brief Pipeline state as seen by a draw call; IDs are 0 when nothing is bound
+ */
+struct NullRenderState {
+    static constexpr uint32_t MaxTextureSlots = 32;
+
+    uint32_t shader = 0;
+    uint32_t vertexArray = 0;
+    uint32_t framebuffer = 0;  // 0 is the default framebuffer
+    std::array<uint32_t, MaxTextureSlots> textures{};
+    glm::uvec4 viewport{0};  // x, y, width, height
+    glm::vec4 clearColor{0.0f};
+};
+
+enum class NullDrawMode : uint8_t {
+    Triangles = 0,  // DrawIndexed
+    Lines
+};
+
+struct NullDrawCall {
+    NullDrawMode mode = NullDrawMode::Triangles;
+    uint32_t count = 0;  // Indices or vertices
+    NullRenderState state;
+    std::string shaderName;
+    // The bound shader's uniforms, sorted by name
+    std::vector<std::pair<std::string, NullUniformValue>> uniforms;
+};
+
+struct NullRenderStats {
+    uint32_t drawCalls = 0;
+    uint64_t elements = 0;  // Indices and line vertices drawn
+    uint32_t clears = 0;
+    uint32_t stateChanges = 0;     // Binds and state setters that changed something
+    uint32_t redundantChanges = 0;  // Those that set the state already current
+    uint32_t uniformUploads = 0;
+};
+
+/**
+ * @brief RendererAPI that draws nothing and records every call instead
+ *
+ * Selected with RenderAPI::Null (VEST_RENDERER_API=Null, or
+ * RenderCommand::Init(RenderAPI::Null)). Buffers, shaders, textures,
+ * framebuffers and vertex arrays are CPU-side stand-ins whose binds update
+ * the state below, so rendering code runs unchanged without a GPU or a
+ * window, e.g. in VestTests on a headless CI machine.
+ *
+ * Like the real backends everything here runs on the thread executing
+ * render commands; read the recording after RenderThread::Flush(), or
+ * without a render thread, where commands run as they are submitted.
+ */
+class NullRendererAPI : public RendererAPI {
+public:
+    void Init() override;
+    void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    void SetClearColor(const glm::vec4& color) override;
+    void Clear() override;
+    void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) override;
+    void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) override;
+
+    static const NullRenderState& GetState();
+    static const NullRenderStats& GetStats();
+    static const std::vector<NullDrawCall>& GetDrawCalls();
+
+    /**
+     * @brief Keep each draw call with its state; off, only the statistics are kept (cheaper for benchmarks)
+     */
+    static void SetRecordDrawCalls(bool record);
+
+    /**
+     * @brief Clear the statistics and recorded draw calls; bound state is kept
+     */
+    static void ResetRecording();
+
+    // Called by the Null resources
+    static uint32_t GenerateID();
+    static void BindShader(const NullShader* shader, uint32_t id);
+    static void BindVertexArray(uint32_t id);
+    static void BindTexture(uint32_t slot, uint32_t id);
+    static void BindFramebuffer(uint32_t id);
+    static void BindViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+    static void CountUniformUpload();
+    static void OnShaderDestroyed(const NullShader* shader);
+};
+
+}  // namespace Vest
@@ -0,0 +1,57 @@
+#include "Rendering/Platform/Null/NullShader.h"
+
+#include <filesystem>
+
+#include "Core/FrameAllocator.h"
+#include "Rendering/RenderThread.h"
+
+namespace Vest {
+
+// Sources are not read or compiled; the name follows OpenGLShader
+NullShader::NullShader(const std::string& filepath)
+    : m_Name(std::filesystem::path(filepath).stem().string()), m_RendererID(NullRendererAPI::GenerateID()) {}
+
+NullShader::NullShader(const std::string& name, const std::string&, const std::string&)
+    : m_Name(name), m_RendererID(NullRendererAPI::GenerateID()) {}
+
+NullShader::~NullShader() {
+    NullRendererAPI::OnShaderDestroyed(this);
+}
+
+void NullShader::Bind() const {
+    RenderThread::Submit([this]() { NullRendererAPI::BindShader(this, m_RendererID); });
+}
+
+void NullShader::Unbind() const {
+    RenderThread::Submit([]() { NullRendererAPI::BindShader(nullptr, 0); });
+}
+
+void NullShader::SetInt(const std::string& name, int value) {
+    SetUniform(name, value);
+}
+
+void NullShader::SetFloat3(const std::string& name, const glm::vec3& value) {
+    SetUniform(name, value);
+}
+
+void NullShader::SetFloat4(const std::string& name, const glm::vec4& value) {
+    SetUniform(name, value);
+}
+
+void NullShader::SetMat4(const std::string& name, const glm::mat4& value) {
+    SetUniform(name, value);
+}
+
+void NullShader::SetUniform(const std::string& name, const NullUniformValue& value) {
+    RenderThread::Submit([this, name = FrameAllocator::CopyString(name), value]() {
+        NullRendererAPI::CountUniformUpload();
+        auto it = m_Uniforms.find(name);
+        if (it == m_Uniforms.end()) {
+            m_Uniforms.emplace(std::string(name), value);
+        } else {
+            it->second = value;
+        }
+    });
+}
+
+}  // namespace Vest
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <map>
+
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/Shader.h"
+
+namespace Vest {
+
+class NullShader : public Shader {
+public:
+    explicit NullShader(const std::string& filepath);
+    NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+    ~NullShader() override;
+
+    void Bind() const override;
+    void Unbind() const override;
+
+    const std::string& GetName() const override { return m_Name; }
+
+    void SetInt(const std::string& name, int value) override;
+    void SetFloat3(const std::string& name, const glm::vec3& value) override;
+    void SetFloat4(const std::string& name, const glm::vec4& value) override;
+    void SetMat4(const std::string& name, const glm::mat4& value) override;
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+    /**
+     * @brief Uniform values as uploaded so far; render thread only
+     */
+    const std::map<std::string, NullUniformValue, std::less<>>& GetUniforms() const { return m_Uniforms; }
+
+private:
+    void SetUniform(const std::string& name, const NullUniformValue& value);
+
+    std::string m_Name;
+    uint32_t m_RendererID = 0;
+    std::map<std::string, NullUniformValue, std::less<>> m_Uniforms;
+};
+
+}  // namespace Vest
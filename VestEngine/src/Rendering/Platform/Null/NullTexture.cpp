@@ -0,0 +1,41 @@
+#include "Rendering/Platform/Null/NullTexture.h"
+
+#include <filesystem>
+
+#include <stb_image.h>
+
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/RenderThread.h"
+
+namespace Vest {
+
+NullTexture2D::NullTexture2D(uint32_t width, uint32_t height, const std::source_location& site)
+    : m_Width(width), m_Height(height), m_RendererID(NullRendererAPI::GenerateID()) {
+    m_Resource = GPUResourceRegistry::Register(GPUResourceType::Texture, static_cast<uint64_t>(width) * height * 4, {},
+                                               site);
+}
+
+NullTexture2D::NullTexture2D(const std::string& path, const std::source_location& site)
+    : m_Path(path), m_RendererID(NullRendererAPI::GenerateID()) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    if (!stbi_info(path.c_str(), &width, &height, &channels)) {
+        // Same 1x1 fallback as OpenGLTexture2D
+        width = height = 1;
+    }
+    m_Width = static_cast<uint32_t>(width);
+    m_Height = static_cast<uint32_t>(height);
+    m_Resource = GPUResourceRegistry::Register(GPUResourceType::Texture, static_cast<uint64_t>(m_Width) * m_Height * 4,
+                                               std::filesystem::path(path).filename().string(), site);
+}
+
+NullTexture2D::~NullTexture2D() {
+    GPUResourceRegistry::Unregister(m_Resource);
+}
+
+void NullTexture2D::Bind(uint32_t slot) const {
+    RenderThread::Submit([this, slot]() { NullRendererAPI::BindTexture(slot, m_RendererID); });
+}
+
+}  // namespace Vest
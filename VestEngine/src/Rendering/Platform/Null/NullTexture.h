@@ -0,0 +1,35 @@
+#pragma once
+
+#include <source_location>
+#include <string>
+
+#include "Rendering/GPUResourceRegistry.h"
+#include "Rendering/Texture.h"
+
+namespace Vest {
+
+/**
+ * @brief Dimensions only; image files are probed for their size but not decoded
+ */
+class NullTexture2D : public Texture2D {
+public:
+    NullTexture2D(uint32_t width, uint32_t height, const std::source_location& site);
+    NullTexture2D(const std::string& path, const std::source_location& site);
+    ~NullTexture2D() override;
+
+    uint32_t GetWidth() const override { return m_Width; }
+    uint32_t GetHeight() const override { return m_Height; }
+
+    void Bind(uint32_t slot = 0) const override;
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+private:
+    std::string m_Path;
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
+};
+
+}  // namespace Vest
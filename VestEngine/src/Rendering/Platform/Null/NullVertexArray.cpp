@@ -0,0 +1,29 @@
+#include "Rendering/Platform/Null/NullVertexArray.h"
+
+#include <cassert>
+
+#include "Rendering/Platform/Null/NullRendererAPI.h"
+#include "Rendering/RenderThread.h"
+
+namespace Vest {
+
+NullVertexArray::NullVertexArray() : m_RendererID(NullRendererAPI::GenerateID()) {}
+
+void NullVertexArray::Bind() const {
+    RenderThread::Submit([this]() { NullRendererAPI::BindVertexArray(m_RendererID); });
+}
+
+void NullVertexArray::Unbind() const {
+    RenderThread::Submit([]() { NullRendererAPI::BindVertexArray(0); });
+}
+
+void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
+    assert(!vertexBuffer->GetLayout().GetElements().empty() && "Vertex buffer has no layout");
+    m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
+    m_IndexBuffer = indexBuffer;
+}
+
+}  // namespace Vest
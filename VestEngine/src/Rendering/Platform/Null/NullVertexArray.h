@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Rendering/VertexArray.h"
+
+namespace Vest {
+
+class NullVertexArray : public VertexArray {
+public:
+    NullVertexArray();
+    ~NullVertexArray() override = default;
+
+    void Bind() const override;
+    void Unbind() const override;
+
+    void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+    void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+    const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+    const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+private:
+    uint32_t m_RendererID = 0;
+    std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+    Ref<IndexBuffer> m_IndexBuffer;
+};
+
+}  // namespace Vest
@@ -1,52 +1,84 @@
 #include "Rendering/Platform/OpenGL/OpenGLBuffer.h"
 
+#include <cstring>
+#include <vector>
+
+#include "Core/FrameAllocator.h"
+#include "Rendering/Platform/OpenGL/OpenGLDebug.h"
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
-OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
-    glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, const std::source_location& site)
+    : m_Resource(GPUResourceRegistry::Register(GPUResourceType::VertexBuffer, size, {}, site)) {
+    RenderThread::Submit([this, size, label = GPUResourceRegistry::GetName(m_Resource)]() {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+        LabelGLObject(GL_BUFFER, m_RendererID, label);
+    });
 }
 
-OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
-    glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size, const std::source_location& site)
+    : m_Resource(GPUResourceRegistry::Register(GPUResourceType::VertexBuffer, size, {}, site)) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(vertices);
+    RenderThread::Submit([this, data = std::vector<uint8_t>(bytes, bytes + size),
+                          label = GPUResourceRegistry::GetName(m_Resource)]() {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(data.size()), data.data(), GL_STATIC_DRAW);
+        LabelGLObject(GL_BUFFER, m_RendererID, label);
+    });
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer() {
     glDeleteBuffers(1, &m_RendererID);
+    GPUResourceRegistry::Unregister(m_Resource);
 }
 
 void OpenGLVertexBuffer::Bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    RenderThread::Submit([this]() { glBindBuffer(GL_ARRAY_BUFFER, m_RendererID); });
 }
 
 void OpenGLVertexBuffer::Unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { glBindBuffer(GL_ARRAY_BUFFER, 0); });
 }
 
 void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    // Frame memory outlives the frame that executes this command
+    void* copy = FrameAllocator::Allocate(size);
+    std::memcpy(copy, data, size);
+    RenderThread::Submit([this, copy, size]() {
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, copy);
+    });
 }
 
-OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count) : m_Count(count) {
-    glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count, const std::source_location& site)
+    : m_Resource(GPUResourceRegistry::Register(GPUResourceType::IndexBuffer,
+                                               static_cast<uint64_t>(count) * sizeof(uint32_t), {}, site)),
+      m_Count(count) {
+    RenderThread::Submit([this, data = std::vector<uint32_t>(indices, indices + count),
+                          label = GPUResourceRegistry::GetName(m_Resource)]() {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(data.size() * sizeof(uint32_t)), data.data(),
+                     GL_STATIC_DRAW);
+        LabelGLObject(GL_BUFFER, m_RendererID, label);
+    });
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer() {
     glDeleteBuffers(1, &m_RendererID);
+    GPUResourceRegistry::Unregister(m_Resource);
 }
 
 void OpenGLIndexBuffer::Bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    RenderThread::Submit([this]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID); });
 }
 
 void OpenGLIndexBuffer::Unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
 }
 
 }  // namespace Vest
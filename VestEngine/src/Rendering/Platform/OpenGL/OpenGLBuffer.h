@@ -3,13 +3,14 @@
 #include <glad/glad.h>
 
 #include "Rendering/Buffer.h"
+#include "Rendering/GPUResourceRegistry.h"
 
 namespace Vest {
 
 class OpenGLVertexBuffer : public VertexBuffer {
 public:
-    explicit OpenGLVertexBuffer(uint32_t size);
-    OpenGLVertexBuffer(float* vertices, uint32_t size);
+    OpenGLVertexBuffer(uint32_t size, const std::source_location& site);
+    OpenGLVertexBuffer(float* vertices, uint32_t size, const std::source_location& site);
     ~OpenGLVertexBuffer() override;
 
     void Bind() const override;
@@ -22,12 +23,13 @@ public:
 
 private:
     uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
     BufferLayout m_Layout;
 };
 
 class OpenGLIndexBuffer : public IndexBuffer {
 public:
-    OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
+    OpenGLIndexBuffer(uint32_t* indices, uint32_t count, const std::source_location& site);
     ~OpenGLIndexBuffer() override;
 
     void Bind() const override;
@@ -37,6 +39,7 @@ public:
 
 private:
     uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
     uint32_t m_Count = 0;
 };
 
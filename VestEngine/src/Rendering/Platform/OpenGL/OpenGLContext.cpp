@@ -18,4 +18,14 @@ void OpenGLContext::SwapBuffers() {
     glfwSwapBuffers(m_WindowHandle);
 }
 
+void OpenGLContext::MakeCurrent() {
+    glfwMakeContextCurrent(m_WindowHandle);
+}
+
+void OpenGLContext::Release() {
+    if (glfwGetCurrentContext() == m_WindowHandle) {
+        glfwMakeContextCurrent(nullptr);
+    }
+}
+
 }  // namespace Vest
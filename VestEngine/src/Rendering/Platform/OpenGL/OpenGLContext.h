@@ -11,6 +11,9 @@ public:
     void Init();
     void SwapBuffers();
 
+    void MakeCurrent();
+    void Release();
+
 private:
     GLFWwindow* m_WindowHandle = nullptr;
 };
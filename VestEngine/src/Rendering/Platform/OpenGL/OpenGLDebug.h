@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include <glad/glad.h>
+
+namespace Vest {
+
+/**
+ * @brief Name a GL object for debuggers such as RenderDoc; a no-op before GL 4.3
+ *
+ * Render thread only. Buffers must have been bound once before labelling.
+ */
+inline void LabelGLObject(GLenum identifier, GLuint name, const std::string& label) {
+    if (glObjectLabel && name != 0) {
+        glObjectLabel(identifier, name, static_cast<GLsizei>(label.size()), label.data());
+    }
+}
+
+}  // namespace Vest
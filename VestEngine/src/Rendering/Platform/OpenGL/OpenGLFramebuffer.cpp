@@ -3,33 +3,52 @@
 #include <cassert>
 #include <glad/glad.h>
 
+#include "Rendering/Platform/OpenGL/OpenGLDebug.h"
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
-OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecification& spec) : m_Specification(spec) {
-    Invalidate();
+namespace {
+
+// One RGBA8 color attachment
+uint64_t GetAttachmentBytes(const FramebufferSpecification& spec) {
+    return static_cast<uint64_t>(spec.width) * spec.height * 4;
+}
+
+}  // namespace
+
+OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecification& spec, const std::source_location& site)
+    : m_Resource(GPUResourceRegistry::Register(GPUResourceType::Framebuffer, GetAttachmentBytes(spec), {}, site)),
+      m_Specification(spec) {
+    RenderThread::Submit([this, spec, label = GPUResourceRegistry::GetName(m_Resource)]() {
+        Invalidate(spec);
+        LabelGLObject(GL_FRAMEBUFFER, m_RendererID, label);
+        LabelGLObject(GL_TEXTURE, m_ColorAttachment, label + " color");
+    });
 }
 
 OpenGLFramebuffer::~OpenGLFramebuffer() {
     glDeleteFramebuffers(1, &m_RendererID);
     glDeleteTextures(1, &m_ColorAttachment);
+    GPUResourceRegistry::Unregister(m_Resource);
 }
 
-void OpenGLFramebuffer::Invalidate() {
-    if (m_RendererID) {
-        glDeleteFramebuffers(1, &m_RendererID);
-        glDeleteTextures(1, &m_ColorAttachment);
+void OpenGLFramebuffer::Invalidate(const FramebufferSpecification& spec) {
+    // Names are created once and the storage respecified on resize, so IDs
+    // handed out to the main thread (e.g. for ImGui::Image) never go stale
+    if (!m_RendererID) {
+        glGenFramebuffers(1, &m_RendererID);
+        glGenTextures(1, &m_ColorAttachment);
     }
 
-    glGenFramebuffers(1, &m_RendererID);
     glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
 
-    glGenTextures(1, &m_ColorAttachment);
     glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
     glTexImage2D(GL_TEXTURE_2D,
                  0,
                  GL_RGBA8,
-                 static_cast<GLsizei>(m_Specification.width),
-                 static_cast<GLsizei>(m_Specification.height),
+                 static_cast<GLsizei>(spec.width),
+                 static_cast<GLsizei>(spec.height),
                  0,
                  GL_RGBA,
                  GL_UNSIGNED_BYTE,
@@ -45,12 +64,27 @@ void OpenGLFramebuffer::Invalidate() {
 }
 
 void OpenGLFramebuffer::Bind() {
-    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
-    glViewport(0, 0, static_cast<GLsizei>(m_Specification.width), static_cast<GLsizei>(m_Specification.height));
+    const uint32_t width = m_Specification.width;
+    const uint32_t height = m_Specification.height;
+    RenderThread::Submit([this, width, height]() {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+        glViewport(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+    });
 }
 
 void OpenGLFramebuffer::Unbind() {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderThread::Submit([]() { glBindFramebuffer(GL_FRAMEBUFFER, 0); });
+}
+
+void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || (width == m_Specification.width && height == m_Specification.height)) {
+        return;
+    }
+
+    m_Specification.width = width;
+    m_Specification.height = height;
+    GPUResourceRegistry::Resize(m_Resource, GetAttachmentBytes(m_Specification));
+    RenderThread::Submit([this, spec = m_Specification]() { Invalidate(spec); });
 }
 
 }  // namespace Vest
@@ -1,26 +1,31 @@
 #pragma once
 
 #include "Rendering/Framebuffer.h"
+#include "Rendering/GPUResourceRegistry.h"
 
 namespace Vest {
 
 class OpenGLFramebuffer : public Framebuffer {
 public:
-    explicit OpenGLFramebuffer(const FramebufferSpecification& spec);
+    OpenGLFramebuffer(const FramebufferSpecification& spec, const std::source_location& site);
     ~OpenGLFramebuffer() override;
 
     void Bind() override;
     void Unbind() override;
 
+    void Resize(uint32_t width, uint32_t height) override;
+
     uint32_t GetColorAttachmentRendererID() const override { return m_ColorAttachment; }
 
     const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
 
-    void Invalidate();
-
 private:
+    // Render thread only
+    void Invalidate(const FramebufferSpecification& spec);
+
     uint32_t m_RendererID = 0;
     uint32_t m_ColorAttachment = 0;
+    GPUResourceID m_Resource = 0;
     FramebufferSpecification m_Specification;
 };
 
@@ -8,6 +8,9 @@
 #include <sstream>
 #include <vector>
 
+#include "Core/FrameAllocator.h"
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
 static GLenum ShaderTypeFromString(const std::string& type) {
@@ -23,8 +26,7 @@ static GLenum ShaderTypeFromString(const std::string& type) {
 
 OpenGLShader::OpenGLShader(const std::string& filepath) {
     std::string source = ReadFile(filepath);
-    auto shaderSources = PreProcess(source);
-    Compile(shaderSources);
+    RenderThread::Submit([this, shaderSources = PreProcess(source)]() { Compile(shaderSources); });
 
     auto lastSlash = filepath.find_last_of("/\\");
     auto lastDot = filepath.find_last_of('.');
@@ -36,7 +38,7 @@ OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc
     std::unordered_map<uint32_t, std::string> sources;
     sources[GL_VERTEX_SHADER] = vertexSrc;
     sources[GL_FRAGMENT_SHADER] = fragmentSrc;
-    Compile(sources);
+    RenderThread::Submit([this, sources = std::move(sources)]() { Compile(sources); });
 }
 
 OpenGLShader::~OpenGLShader() {
@@ -44,27 +46,27 @@ OpenGLShader::~OpenGLShader() {
 }
 
 void OpenGLShader::Bind() const {
-    glUseProgram(m_RendererID);
+    RenderThread::Submit([this]() { glUseProgram(m_RendererID); });
 }
 
 void OpenGLShader::Unbind() const {
-    glUseProgram(0);
+    RenderThread::Submit([]() { glUseProgram(0); });
 }
 
 void OpenGLShader::SetInt(const std::string& name, int value) {
-    UploadUniformInt(name, value);
+    RenderThread::Submit([this, name = FrameAllocator::CopyString(name), value]() { UploadUniformInt(name, value); });
 }
 
 void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value) {
-    UploadUniformFloat3(name, value);
+    RenderThread::Submit([this, name = FrameAllocator::CopyString(name), value]() { UploadUniformFloat3(name, value); });
 }
 
 void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value) {
-    UploadUniformFloat4(name, value);
+    RenderThread::Submit([this, name = FrameAllocator::CopyString(name), value]() { UploadUniformFloat4(name, value); });
 }
 
 void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value) {
-    UploadUniformMat4(name, value);
+    RenderThread::Submit([this, name = FrameAllocator::CopyString(name), value]() { UploadUniformMat4(name, value); });
 }
 
 std::string OpenGLShader::ReadFile(const std::string& filepath) {
@@ -152,30 +154,31 @@ void OpenGLShader::Compile(const std::unordered_map<uint32_t, std::string>& shad
     m_RendererID = program;
 }
 
-int OpenGLShader::GetUniformLocation(const std::string& name) {
+int OpenGLShader::GetUniformLocation(std::string_view name) {
     auto it = m_UniformLocationCache.find(name);
     if (it != m_UniformLocationCache.end()) {
         return it->second;
     }
 
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    m_UniformLocationCache[name] = location;
+    std::string key(name);
+    GLint location = glGetUniformLocation(m_RendererID, key.c_str());
+    m_UniformLocationCache.emplace(std::move(key), location);
     return location;
 }
 
-void OpenGLShader::UploadUniformInt(const std::string& name, int value) {
+void OpenGLShader::UploadUniformInt(std::string_view name, int value) {
     glUniform1i(GetUniformLocation(name), value);
 }
 
-void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& value) {
+void OpenGLShader::UploadUniformFloat3(std::string_view name, const glm::vec3& value) {
     glUniform3fv(GetUniformLocation(name), 1, glm::value_ptr(value));
 }
 
-void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& value) {
+void OpenGLShader::UploadUniformFloat4(std::string_view name, const glm::vec4& value) {
     glUniform4fv(GetUniformLocation(name), 1, glm::value_ptr(value));
 }
 
-void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix) {
+void OpenGLShader::UploadUniformMat4(std::string_view name, const glm::mat4& matrix) {
     glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
 }
 
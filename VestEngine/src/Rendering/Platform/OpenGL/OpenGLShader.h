@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <glm/glm.hpp>
@@ -30,15 +32,21 @@ private:
     std::unordered_map<uint32_t, std::string> PreProcess(const std::string& source);
     void Compile(const std::unordered_map<uint32_t, std::string>& shaderSources);
 
-    int GetUniformLocation(const std::string& name);
-    void UploadUniformInt(const std::string& name, int value);
-    void UploadUniformFloat3(const std::string& name, const glm::vec3& value);
-    void UploadUniformFloat4(const std::string& name, const glm::vec4& value);
-    void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
+    int GetUniformLocation(std::string_view name);
+    void UploadUniformInt(std::string_view name, int value);
+    void UploadUniformFloat3(std::string_view name, const glm::vec3& value);
+    void UploadUniformFloat4(std::string_view name, const glm::vec4& value);
+    void UploadUniformMat4(std::string_view name, const glm::mat4& matrix);
+
+    // Transparent hashing so lookups by string_view do not build a std::string
+    struct UniformNameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
 
     uint32_t m_RendererID = 0;
     std::string m_Name;
-    std::unordered_map<std::string, int> m_UniformLocationCache;
+    std::unordered_map<std::string, int, UniformNameHash, std::equal_to<>> m_UniformLocationCache;
 };
 
 }  // namespace Vest
@@ -1,19 +1,36 @@
 #include "Rendering/Platform/OpenGL/OpenGLTexture.h"
 
 #include <cassert>
+#include <filesystem>
 
 #include <stb_image.h>
 
+#include "Rendering/Platform/OpenGL/OpenGLDebug.h"
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
-OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height) : m_Width(width), m_Height(height) {
+namespace {
+
+uint64_t GetTextureBytes(uint32_t width, uint32_t height, GLenum internalFormat) {
+    return static_cast<uint64_t>(width) * height * (internalFormat == GL_RGB8 ? 3 : 4);
+}
+
+}  // namespace
+
+OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height, const std::source_location& site)
+    : m_Width(width), m_Height(height) {
     m_InternalFormat = GL_RGBA8;
     m_DataFormat = GL_RGBA;
-    Allocate();
-    InitializeParameters();
+    m_Resource = GPUResourceRegistry::Register(GPUResourceType::Texture,
+                                               GetTextureBytes(m_Width, m_Height, m_InternalFormat), {}, site);
+    RenderThread::Submit([this, label = GPUResourceRegistry::GetName(m_Resource)]() {
+        Allocate(label);
+        InitializeParameters();
+    });
 }
 
-OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path) {
+OpenGLTexture2D::OpenGLTexture2D(const std::string& path, const std::source_location& site) : m_Path(path) {
     int width = 0;
     int height = 0;
     int channels = 0;
@@ -53,20 +70,27 @@ OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_Path(path) {
         assert(false && "Unsupported texture format");
     }
 
-    Allocate(data);
-    InitializeParameters();
+    m_IsLoaded = loadedFromDisk && data;
+    m_Resource = GPUResourceRegistry::Register(GPUResourceType::Texture,
+                                               GetTextureBytes(m_Width, m_Height, m_InternalFormat),
+                                               std::filesystem::path(path).filename().string(), site);
 
-    if (loadedFromDisk && data) {
-        stbi_image_free(data);
-        m_IsLoaded = true;
-    }
+    // Decoding stays on the calling thread; the upload owns the pixels until it runs
+    RenderThread::Submit([this, data, ownsData = m_IsLoaded, label = GPUResourceRegistry::GetName(m_Resource)]() {
+        Allocate(label, data);
+        InitializeParameters();
+        if (ownsData) {
+            stbi_image_free(data);
+        }
+    });
 }
 
 OpenGLTexture2D::~OpenGLTexture2D() {
     glDeleteTextures(1, &m_RendererID);
+    GPUResourceRegistry::Unregister(m_Resource);
 }
 
-void OpenGLTexture2D::Allocate(const void* data) {
+void OpenGLTexture2D::Allocate(const std::string& label, const void* data) {
     glGenTextures(1, &m_RendererID);
     glBindTexture(GL_TEXTURE_2D, m_RendererID);
     glTexImage2D(GL_TEXTURE_2D,
@@ -78,6 +102,7 @@ void OpenGLTexture2D::Allocate(const void* data) {
                  m_DataFormat,
                  GL_UNSIGNED_BYTE,
                  data);
+    LabelGLObject(GL_TEXTURE, m_RendererID, label);
 }
 
 void OpenGLTexture2D::InitializeParameters() const {
@@ -89,8 +114,10 @@ void OpenGLTexture2D::InitializeParameters() const {
 }
 
 void OpenGLTexture2D::Bind(uint32_t slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    RenderThread::Submit([this, slot]() {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    });
 }
 
 }  // namespace Vest
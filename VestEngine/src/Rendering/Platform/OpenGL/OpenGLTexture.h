@@ -1,20 +1,20 @@
 #pragma once
 
-#include <string>
 #include <cstdint>
-
+#include <source_location>
 #include <string>
 
 #include <glad/glad.h>
 
+#include "Rendering/GPUResourceRegistry.h"
 #include "Rendering/Texture.h"
 
 namespace Vest {
 
 class OpenGLTexture2D : public Texture2D {
 public:
-    OpenGLTexture2D(uint32_t width, uint32_t height);
-    explicit OpenGLTexture2D(const std::string& path);
+    OpenGLTexture2D(uint32_t width, uint32_t height, const std::source_location& site);
+    OpenGLTexture2D(const std::string& path, const std::source_location& site);
     ~OpenGLTexture2D() override;
 
     uint32_t GetWidth() const override { return m_Width; }
@@ -23,7 +23,8 @@ public:
     void Bind(uint32_t slot = 0) const override;
 
 private:
-    void Allocate(const void* data = nullptr);
+    // Render thread only
+    void Allocate(const std::string& label, const void* data = nullptr);
     void InitializeParameters() const;
 
     std::string m_Path;
@@ -32,6 +33,7 @@ private:
     GLenum m_InternalFormat = 0;
     GLenum m_DataFormat = 0;
     uint32_t m_RendererID = 0;
+    GPUResourceID m_Resource = 0;
     bool m_IsLoaded = false;
 };
 
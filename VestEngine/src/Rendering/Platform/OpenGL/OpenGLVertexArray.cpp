@@ -3,6 +3,8 @@
 #include <cassert>
 #include <glad/glad.h>
 
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
 static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
@@ -27,7 +29,7 @@ static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
 }
 
 OpenGLVertexArray::OpenGLVertexArray() {
-    glGenVertexArrays(1, &m_RendererID);
+    RenderThread::Submit([this]() { glGenVertexArrays(1, &m_RendererID); });
 }
 
 OpenGLVertexArray::~OpenGLVertexArray() {
@@ -35,40 +37,47 @@ OpenGLVertexArray::~OpenGLVertexArray() {
 }
 
 void OpenGLVertexArray::Bind() const {
-    glBindVertexArray(m_RendererID);
+    RenderThread::Submit([this]() { glBindVertexArray(m_RendererID); });
 }
 
 void OpenGLVertexArray::Unbind() const {
-    glBindVertexArray(0);
+    RenderThread::Submit([]() { glBindVertexArray(0); });
 }
 
 void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
-    glBindVertexArray(m_RendererID);
-    vertexBuffer->Bind();
-
-    const auto& layout = vertexBuffer->GetLayout();
+    const BufferLayout& layout = vertexBuffer->GetLayout();
     assert(!layout.GetElements().empty() && "Vertex Buffer has no layout");
-    uint32_t index = m_VertexBufferIndex;
-    for (const auto& element : layout.GetElements()) {
-        glEnableVertexAttribArray(index);
-        glVertexAttribPointer(index,
-                              static_cast<GLint>(element.GetComponentCount()),
-                              ShaderDataTypeToOpenGLBaseType(element.type),
-                              element.normalized ? GL_TRUE : GL_FALSE,
-                              static_cast<GLsizei>(layout.GetStride()),
-                              reinterpret_cast<const void*>(element.offset));
-        ++index;
-    }
 
-    m_VertexBufferIndex = index;
+    // Attribute slots are assigned here so later calls see the updated index
+    const uint32_t firstIndex = m_VertexBufferIndex;
+    m_VertexBufferIndex += static_cast<uint32_t>(layout.GetElements().size());
     m_VertexBuffers.push_back(vertexBuffer);
+
+    RenderThread::Submit([this, vertexBuffer, layout, firstIndex]() {
+        glBindVertexArray(m_RendererID);
+        vertexBuffer->Bind();
+
+        uint32_t index = firstIndex;
+        for (const auto& element : layout.GetElements()) {
+            glEnableVertexAttribArray(index);
+            glVertexAttribPointer(index,
+                                  static_cast<GLint>(element.GetComponentCount()),
+                                  ShaderDataTypeToOpenGLBaseType(element.type),
+                                  element.normalized ? GL_TRUE : GL_FALSE,
+                                  static_cast<GLsizei>(layout.GetStride()),
+                                  reinterpret_cast<const void*>(element.offset));
+            ++index;
+        }
+    });
 }
 
 void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-    glBindVertexArray(m_RendererID);
-    indexBuffer->Bind();
-
     m_IndexBuffer = indexBuffer;
+
+    RenderThread::Submit([this, indexBuffer]() {
+        glBindVertexArray(m_RendererID);
+        indexBuffer->Bind();
+    });
 }
 
 }  // namespace Vest
@@ -8,7 +8,8 @@ namespace Vest {
 enum class RenderAPI {
     None = 0,
     OpenGL,
-    Vulkan
+    Vulkan,
+    Null  // Records draw calls without a GPU, see NullRendererAPI
 };
 
 inline std::string ToString(RenderAPI api) {
@@ -17,6 +18,8 @@ inline std::string ToString(RenderAPI api) {
             return "OpenGL";
         case RenderAPI::Vulkan:
             return "Vulkan";
+        case RenderAPI::Null:
+            return "Null";
         default:
             return "None";
     }
@@ -29,6 +32,9 @@ inline RenderAPI ParseRenderAPI(std::string_view name) {
     if (name == "OpenGL") {
         return RenderAPI::OpenGL;
     }
+    if (name == "Null") {
+        return RenderAPI::Null;
+    }
     return RenderAPI::None;
 }
 
@@ -3,6 +3,7 @@
 #include <cassert>
 
 #include "Core/Log.h"
+#include "Rendering/Platform/Null/NullRendererAPI.h"
 #include "Rendering/Platform/OpenGL/OpenGLRendererAPI.h"
 #include "Rendering/Platform/Vulkan/VulkanRendererAPI.h"
 
@@ -10,9 +11,9 @@ namespace Vest {
 
 Scope<RendererAPI> RenderCommand::s_RendererAPI;
 
-void RenderCommand::Init() {
-    RendererAPI::SetAPI(ResolveDefaultRenderAPI());
-    
+void RenderCommand::Init(RenderAPI api) {
+    RendererAPI::SetAPI(api);
+
     VEST_CORE_INFO("Initializing Render API: {0}", ToString(RendererAPI::GetAPI()));
 
     switch (RendererAPI::GetAPI()) {
@@ -23,13 +24,16 @@ void RenderCommand::Init() {
             VEST_CORE_WARN("Vulkan API selected but not fully implemented");
             s_RendererAPI = CreateScope<VulkanRendererAPI>();
             break;
+        case RenderAPI::Null:
+            s_RendererAPI = CreateScope<NullRendererAPI>();
+            break;
         case RenderAPI::None:
         default:
             VEST_CORE_CRITICAL("Unknown or unsupported RenderAPI");
             assert(false && "Unknown RenderAPI");
     }
 
-    s_RendererAPI->Init();
+    RenderThread::Submit([]() { s_RendererAPI->Init(); });
 }
 
 }  // namespace Vest
@@ -4,32 +4,44 @@
 
 #include "Core/Base.h"
 #include "Rendering/RendererAPI.h"
+#include "Rendering/RenderThread.h"
 #include "Rendering/VertexArray.h"
 
 namespace Vest {
 
+/**
+ * @brief Records draw state changes and draw calls for the render thread
+ *
+ * Arguments are captured by value (vertex arrays by Ref, keeping them
+ * alive) and replayed against the RendererAPI when the frame executes.
+ */
 class RenderCommand {
 public:
-    static void Init();
+    /**
+     * @brief Create the RendererAPI for @p api, which also becomes RendererAPI::GetAPI()
+     */
+    static void Init(RenderAPI api = ResolveDefaultRenderAPI());
 
     static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-        s_RendererAPI->SetViewport(x, y, width, height);
+        RenderThread::Submit([x, y, width, height]() { s_RendererAPI->SetViewport(x, y, width, height); });
     }
 
     static void SetClearColor(const glm::vec4& color) {
-        s_RendererAPI->SetClearColor(color);
+        RenderThread::Submit([color]() { s_RendererAPI->SetClearColor(color); });
     }
 
     static void Clear() {
-        s_RendererAPI->Clear();
+        RenderThread::Submit([]() { s_RendererAPI->Clear(); });
     }
 
     static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) {
-        s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+        // Resolved while recording so the render thread never reads the vertex array's bookkeeping
+        const uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        RenderThread::Submit([vertexArray, count]() { s_RendererAPI->DrawIndexed(vertexArray, count); });
     }
 
     static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) {
-        s_RendererAPI->DrawLines(vertexArray, vertexCount);
+        RenderThread::Submit([vertexArray, vertexCount]() { s_RendererAPI->DrawLines(vertexArray, vertexCount); });
     }
 
 private:
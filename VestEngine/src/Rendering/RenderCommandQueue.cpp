@@ -0,0 +1,90 @@
+#include "Rendering/RenderCommandQueue.h"
+
+#include <algorithm>
+
+namespace Vest {
+
+namespace {
+
+constexpr size_t CommandAlignment = alignof(std::max_align_t);
+
+constexpr size_t AlignUp(size_t value) {
+    return (value + CommandAlignment - 1) & ~(CommandAlignment - 1);
+}
+
+}  // namespace
+
+RenderCommandQueue::RenderCommandQueue(size_t blockSize) : m_BlockSize(std::max(AlignUp(blockSize), CommandAlignment)) {}
+
+RenderCommandQueue::~RenderCommandQueue() {
+    Clear();
+}
+
+void RenderCommandQueue::Execute() {
+    Drain(true);
+}
+
+void RenderCommandQueue::Clear() {
+    Drain(false);
+}
+
+size_t RenderCommandQueue::GetUsedBytes() const {
+    size_t used = 0;
+    for (const Block& block : m_Blocks) {
+        used += block.used;
+    }
+    return used;
+}
+
+size_t RenderCommandQueue::GetCapacityBytes() const {
+    size_t capacity = 0;
+    for (const Block& block : m_Blocks) {
+        capacity += block.capacity;
+    }
+    return capacity;
+}
+
+void* RenderCommandQueue::Allocate(size_t commandSize, ThunkFn thunk) {
+    const size_t headerSize = AlignUp(sizeof(CommandHeader));
+    const size_t entrySize = headerSize + AlignUp(commandSize);
+
+    // Move forward to the first block with room; blocks are never revisited
+    // within a frame, which keeps commands in submission order
+    while (m_CurrentBlock < m_Blocks.size() &&
+           m_Blocks[m_CurrentBlock].capacity - m_Blocks[m_CurrentBlock].used < entrySize) {
+        ++m_CurrentBlock;
+    }
+    if (m_CurrentBlock == m_Blocks.size()) {
+        Block block;
+        block.capacity = std::max(m_BlockSize, entrySize);
+        block.data = std::make_unique<std::byte[]>(block.capacity);
+        m_Blocks.push_back(std::move(block));
+    }
+
+    Block& block = m_Blocks[m_CurrentBlock];
+    std::byte* entry = block.data.get() + block.used;
+    block.used += entrySize;
+    ++m_CommandCount;
+
+    new (entry) CommandHeader{thunk, entrySize};
+    return entry + headerSize;
+}
+
+void RenderCommandQueue::Drain(bool execute) {
+    const size_t headerSize = AlignUp(sizeof(CommandHeader));
+
+    for (Block& block : m_Blocks) {
+        size_t offset = 0;
+        while (offset < block.used) {
+            CommandHeader* header = reinterpret_cast<CommandHeader*>(block.data.get() + offset);
+            header->thunk(block.data.get() + offset + headerSize, execute);
+            offset += header->size;
+        }
+        block.used = 0;
+    }
+
+    m_CurrentBlock = 0;
+    m_CommandCount = 0;
+}
+
+}  // namespace Vest
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Vest {
+
+/**
+ * @brief Linear buffer of type-erased render commands
+ *
+ * Commands are arbitrary callables constructed in place in large memory
+ * blocks, so recording a frame does not allocate once the blocks have
+ * grown to the frame's size. Execute() runs the commands in submission
+ * order, destroys them and rewinds the buffer for reuse; the blocks are kept.
+ */
+class RenderCommandQueue {
+public:
+    static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+    explicit RenderCommandQueue(size_t blockSize = DefaultBlockSize);
+    ~RenderCommandQueue();
+
+    RenderCommandQueue(const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+    template <typename F>
+    void Submit(F&& command) {
+        using Command = std::decay_t<F>;
+        static_assert(alignof(Command) <= alignof(std::max_align_t), "Over-aligned render command");
+
+        void* storage = Allocate(sizeof(Command), &Thunk<Command>);
+        new (storage) Command(std::forward<F>(command));
+    }
+
+    /**
+     * @brief Run every recorded command in order, then rewind the buffer
+     */
+    void Execute();
+
+    /**
+     * @brief Destroy recorded commands without running them
+     */
+    void Clear();
+
+    uint32_t GetCommandCount() const { return m_CommandCount; }
+    size_t GetUsedBytes() const;
+    size_t GetCapacityBytes() const;
+
+private:
+    using ThunkFn = void (*)(void* command, bool execute);
+
+    struct CommandHeader {
+        ThunkFn thunk;
+        size_t size;  // Header + command + padding, i.e. offset to the next header
+    };
+
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    template <typename Command>
+    static void Thunk(void* command, bool execute) {
+        Command* typed = static_cast<Command*>(command);
+        if (execute) {
+            (*typed)();
+        }
+        typed->~Command();
+    }
+
+    void* Allocate(size_t commandSize, ThunkFn thunk);
+    void Drain(bool execute);
+
+    std::vector<Block> m_Blocks;
+    size_t m_CurrentBlock = 0;
+    size_t m_BlockSize;
+    uint32_t m_CommandCount = 0;
+};
+
+}  // namespace Vest
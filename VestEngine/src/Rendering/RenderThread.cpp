@@ -0,0 +1,192 @@
+#include "Rendering/RenderThread.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Core/Log.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Profiler.h"
+#include "Core/Window.h"
+
+namespace Vest {
+
+namespace {
+
+// Set on the render thread, and on the main thread while it executes
+// commands for the SingleThreaded policy
+thread_local bool t_ExecutingCommands = false;
+
+}  // namespace
+
+struct RenderThread::State {
+    RenderThreadPolicy policy = RenderThreadPolicy::SingleThreaded;
+    Window* window = nullptr;
+
+    // [submitIndex] is recorded by the main thread, the other one executed
+    RenderCommandQueue commands[2];
+    RenderCommandQueue resourceFrees[2];
+    uint32_t submitIndex = 0;
+    uint32_t lastFrameCommandCount = 0;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool executing = false;  // Render thread owns the queues at 1 - submitIndex
+    bool running = true;
+
+    uint32_t ExecuteFrame(uint32_t index) {
+        VEST_PROFILE_SCOPE("RenderThread::ExecuteFrame");
+        VEST_MEMORY_TAG(Rendering);
+        const bool wasExecuting = t_ExecutingCommands;
+        t_ExecutingCommands = true;
+        const uint32_t count = commands[index].GetCommandCount();
+        commands[index].Execute();
+        resourceFrees[index].Execute();
+        t_ExecutingCommands = wasExecuting;
+        return count;
+    }
+
+    void ThreadLoop() {
+        t_ExecutingCommands = true;
+        Profiler::SetThreadName("Render");
+        if (window) {
+            window->MakeContextCurrent();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this]() { return executing || !running; });
+            if (!executing) {
+                break;
+            }
+
+            const uint32_t index = 1 - submitIndex;
+            lock.unlock();
+            const uint32_t count = ExecuteFrame(index);
+            lock.lock();
+
+            lastFrameCommandCount = count;
+            executing = false;
+            condition.notify_all();
+        }
+
+        if (window) {
+            window->ReleaseContext();
+        }
+    }
+
+    void WaitIdle(std::unique_lock<std::mutex>& lock) {
+        condition.wait(lock, [this]() { return !executing; });
+    }
+};
+
+Scope<RenderThread::State> RenderThread::s_Instance;
+
+void RenderThread::Init(RenderThreadPolicy policy, Window* window) {
+    assert(!s_Instance && "RenderThread already initialized");
+    s_Instance = CreateScope<State>();
+    s_Instance->policy = policy;
+    s_Instance->window = window;
+
+    if (policy == RenderThreadPolicy::MultiThreaded) {
+        if (window) {
+            window->ReleaseContext();
+        }
+        s_Instance->thread = std::thread([state = s_Instance.get()]() { state->ThreadLoop(); });
+    }
+
+    VEST_CORE_INFO("Render thread policy: {0}",
+                   policy == RenderThreadPolicy::MultiThreaded ? "multi-threaded" : "single-threaded");
+}
+
+void RenderThread::Shutdown() {
+    if (!s_Instance) {
+        return;
+    }
+
+    Flush();
+
+    State& state = *s_Instance;
+    if (state.thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.running = false;
+        }
+        state.condition.notify_all();
+        state.thread.join();
+
+        if (state.window) {
+            state.window->MakeContextCurrent();
+        }
+    }
+
+    s_Instance.reset();
+}
+
+RenderThreadPolicy RenderThread::GetPolicy() {
+    return s_Instance ? s_Instance->policy : RenderThreadPolicy::SingleThreaded;
+}
+
+RenderThreadPolicy RenderThread::DefaultPolicy() {
+#if defined(VEST_RENDER_THREAD) && VEST_RENDER_THREAD
+    return RenderThreadPolicy::MultiThreaded;
+#else
+    return RenderThreadPolicy::SingleThreaded;
+#endif
+}
+
+bool RenderThread::IsRenderThread() {
+    return t_ExecutingCommands;
+}
+
+void RenderThread::Kick() {
+    if (!s_Instance) {
+        return;
+    }
+
+    State& state = *s_Instance;
+    if (state.policy == RenderThreadPolicy::SingleThreaded) {
+        state.lastFrameCommandCount = state.ExecuteFrame(state.submitIndex);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.WaitIdle(lock);
+    state.submitIndex = 1 - state.submitIndex;
+    state.executing = true;
+    state.condition.notify_all();
+}
+
+void RenderThread::Flush() {
+    if (!s_Instance) {
+        return;
+    }
+
+    Kick();
+
+    State& state = *s_Instance;
+    if (state.policy == RenderThreadPolicy::MultiThreaded) {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.WaitIdle(lock);
+    }
+}
+
+uint32_t RenderThread::GetLastFrameCommandCount() {
+    if (!s_Instance) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(s_Instance->mutex);
+    return s_Instance->lastFrameCommandCount;
+}
+
+RenderCommandQueue& RenderThread::GetCommandQueue() {
+    return s_Instance->commands[s_Instance->submitIndex];
+}
+
+RenderCommandQueue& RenderThread::GetResourceFreeQueue() {
+    return s_Instance->resourceFrees[s_Instance->submitIndex];
+}
+
+}  // namespace Vest
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "Core/Base.h"
+#include "Rendering/RenderCommandQueue.h"
+
+namespace Vest {
+
+class Window;
+
+enum class RenderThreadPolicy {
+    SingleThreaded = 0,  // Recorded commands run on the main thread at Kick()
+    MultiThreaded        // A dedicated thread owns the graphics context and runs them
+};
+
+/**
+ * @brief Records render commands on the main thread and executes them on the render thread
+ *
+ * Commands are recorded into one of two RenderCommandQueues while the
+ * other is executed, so the main thread can build frame N+1 while frame N
+ * is submitted to the driver. Kick() ends a frame: it waits for the
+ * previous frame to finish executing and hands over the queue just
+ * recorded. The main thread is therefore never more than one frame ahead.
+ *
+ * Recording is main-thread only. Submissions made while commands are
+ * executing (e.g. from a resource destructor) run immediately. Before
+ * Init() and after Shutdown() every submission runs immediately, which
+ * keeps tools and tests working without a render thread.
+ */
+class RenderThread {
+public:
+    /**
+     * @param window Its graphics context is moved to the render thread
+     *        for the MultiThreaded policy and given back on Shutdown()
+     */
+    static void Init(RenderThreadPolicy policy = DefaultPolicy(), Window* window = nullptr);
+    static void Shutdown();
+
+    static bool IsInitialized() { return s_Instance != nullptr; }
+    static RenderThreadPolicy GetPolicy();
+    static RenderThreadPolicy DefaultPolicy();
+
+    /**
+     * @brief True on the thread currently executing render commands
+     */
+    static bool IsRenderThread();
+
+    template <typename F>
+    static void Submit(F&& command) {
+        if (!s_Instance || IsRenderThread()) {
+            command();
+            return;
+        }
+        GetCommandQueue().Submit(std::forward<F>(command));
+    }
+
+    /**
+     * @brief Queue work that must run after every command of the current frame
+     *
+     * Used to release GPU resources that commands recorded earlier in the
+     * frame may still reference.
+     */
+    template <typename F>
+    static void SubmitResourceFree(F&& command) {
+        if (!s_Instance || IsRenderThread()) {
+            command();
+            return;
+        }
+        GetResourceFreeQueue().Submit(std::forward<F>(command));
+    }
+
+    /**
+     * @brief End the frame: hand the recorded commands to the render thread
+     */
+    static void Kick();
+
+    /**
+     * @brief Kick() and block until everything recorded so far has executed
+     */
+    static void Flush();
+
+    static uint32_t GetLastFrameCommandCount();
+
+private:
+    struct State;
+
+    static RenderCommandQueue& GetCommandQueue();
+    static RenderCommandQueue& GetResourceFreeQueue();
+
+    static Scope<State> s_Instance;
+};
+
+/**
+ * @brief Create a GPU resource whose destruction is deferred to the render thread
+ *
+ * The returned Ref deletes the object through SubmitResourceFree(), so
+ * destructors that release GPU handles run with the graphics context
+ * current and only after every command that referenced the object.
+ */
+template <typename T, typename... Args>
+Ref<T> CreateRenderResource(Args&&... args) {
+    return Ref<T>(new T(std::forward<Args>(args)...), [](T* resource) {
+        RenderThread::SubmitResourceFree([resource]() { delete resource; });
+    });
+}
+
+}  // namespace Vest
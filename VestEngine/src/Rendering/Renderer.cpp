@@ -2,15 +2,21 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Core/BinaryLog.h"
+#include "Core/Profiler.h"
+#include "Rendering/RenderThread.h"
+
 namespace Vest {
 
 Scope<Renderer::SceneData> Renderer::s_SceneData = CreateScope<Renderer::SceneData>();
 
-void Renderer::Init() {
+void Renderer::Init(Window* window) {
+    RenderThread::Init(RenderThread::DefaultPolicy(), window);
     RenderCommand::Init();
 }
 
 void Renderer::Shutdown() {
+    RenderThread::Shutdown();
     s_SceneData.reset();
 }
 
@@ -25,12 +31,14 @@ void Renderer::BeginScene(const glm::mat4& viewProjectionMatrix) {
 void Renderer::EndScene() {}
 
 void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform) {
+    VEST_PROFILE_FUNCTION();
     shader->Bind();
     shader->SetMat4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
     shader->SetMat4("u_Transform", transform);
 
     vertexArray->Bind();
     RenderCommand::DrawIndexed(vertexArray);
+    VEST_BINLOG("Submit {0} indices, shader {1}", vertexArray->GetIndexBuffer()->GetCount(), shader->GetName());
 }
 
 }  // namespace Vest
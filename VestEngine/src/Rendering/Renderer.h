@@ -9,9 +9,14 @@
 
 namespace Vest {
 
+class Window;
+
 class Renderer {
 public:
-    static void Init();
+    /**
+     * @brief Start the render thread (taking over @p window's graphics context) and the RendererAPI
+     */
+    static void Init(Window* window = nullptr);
     static void Shutdown();
 
     static void OnWindowResize(uint32_t width, uint32_t height);
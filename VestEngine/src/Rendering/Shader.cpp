@@ -3,6 +3,8 @@
 #include <cassert>
 
 #include "Rendering/RendererAPI.h"
+#include "Rendering/RenderThread.h"
+#include "Rendering/Platform/Null/NullShader.h"
 #include "Rendering/Platform/OpenGL/OpenGLShader.h"
 #include "Rendering/Platform/Vulkan/VulkanShader.h"
 
@@ -11,9 +13,11 @@ namespace Vest {
 Ref<Shader> Shader::Create(const std::string& filepath) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLShader>(filepath);
+            return CreateRenderResource<OpenGLShader>(filepath);
         case RenderAPI::Vulkan:
             return CreateRef<VulkanShader>(filepath);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullShader>(filepath);
         case RenderAPI::None:
         default:
             assert(false && "Unknown RenderAPI");
@@ -24,9 +28,11 @@ Ref<Shader> Shader::Create(const std::string& filepath) {
 Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+            return CreateRenderResource<OpenGLShader>(name, vertexSrc, fragmentSrc);
         case RenderAPI::Vulkan:
             return CreateRef<VulkanShader>(name, vertexSrc, fragmentSrc);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullShader>(name, vertexSrc, fragmentSrc);
         case RenderAPI::None:
         default:
             assert(false && "Unknown RenderAPI");
@@ -5,15 +5,21 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include "Core/MemoryTracker.h"
 #include "Rendering/RendererAPI.h"
+#include "Rendering/RenderThread.h"
+#include "Rendering/Platform/Null/NullTexture.h"
 #include "Rendering/Platform/OpenGL/OpenGLTexture.h"
 
 namespace Vest {
 
-Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
+Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height, const std::source_location& site) {
+    VEST_MEMORY_TAG(Textures);
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLTexture2D>(width, height);
+            return CreateRenderResource<OpenGLTexture2D>(width, height, site);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullTexture2D>(width, height, site);
         case RenderAPI::Vulkan:
         case RenderAPI::None:
         default:
@@ -22,10 +28,13 @@ Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
     }
 }
 
-Ref<Texture2D> Texture2D::Create(const std::string& path) {
+Ref<Texture2D> Texture2D::Create(const std::string& path, const std::source_location& site) {
+    VEST_MEMORY_TAG(Textures);
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLTexture2D>(path);
+            return CreateRenderResource<OpenGLTexture2D>(path, site);
+        case RenderAPI::Null:
+            return CreateRenderResource<NullTexture2D>(path, site);
         case RenderAPI::Vulkan:
         case RenderAPI::None:
         default:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <source_location>
 #include <string>
 
 #include "Core/Base.h"
@@ -19,8 +20,10 @@ public:
 
 class Texture2D : public Texture {
 public:
-    static Ref<Texture2D> Create(uint32_t width, uint32_t height);
-    static Ref<Texture2D> Create(const std::string& path);
+    static Ref<Texture2D> Create(uint32_t width, uint32_t height,
+                                 const std::source_location& site = std::source_location::current());
+    static Ref<Texture2D> Create(const std::string& path,
+                                 const std::source_location& site = std::source_location::current());
 };
 
 }  // namespace Vest
@@ -2,6 +2,8 @@
 
 #include <cassert>
 
+#include "Rendering/RenderThread.h"
+#include "Rendering/Platform/Null/NullVertexArray.h"
 #include "Rendering/Platform/OpenGL/OpenGLVertexArray.h"
 
 namespace Vest {
@@ -9,7 +11,9 @@ namespace Vest {
 Ref<VertexArray> VertexArray::Create() {
     switch (RendererAPI::GetAPI()) {
         case RenderAPI::OpenGL:
-            return CreateRef<OpenGLVertexArray>();
+            return CreateRenderResource<OpenGLVertexArray>();
+        case RenderAPI::Null:
+            return CreateRenderResource<NullVertexArray>();
         case RenderAPI::Vulkan:
         case RenderAPI::None:
         default:
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Vest {
+
+/**
+ * @brief Stable 32-bit reference to an entity in a Scene
+ *
+ * Packs a slot index (low bits) and a generation counter (high bits).
+ * The generation is bumped every time a slot is freed, so handles to
+ * destroyed entities are rejected in O(1) instead of silently aliasing
+ * whatever entity later reuses the slot.
+ */
+struct EntityHandle {
+    static constexpr uint32_t IndexBits = 22;
+    static constexpr uint32_t GenerationBits = 32 - IndexBits;
+    static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32_t GenerationMask = (1u << GenerationBits) - 1;
+    static constexpr uint32_t NullValue = 0xFFFFFFFFu;
+
+    uint32_t value = NullValue;
+
+    constexpr EntityHandle() = default;
+    constexpr explicit EntityHandle(uint32_t raw) : value(raw) {}
+
+    static constexpr EntityHandle Make(uint32_t index, uint32_t generation) {
+        return EntityHandle(((generation & GenerationMask) << IndexBits) | (index & IndexMask));
+    }
+
+    constexpr uint32_t GetIndex() const { return value & IndexMask; }
+    constexpr uint32_t GetGeneration() const { return (value >> IndexBits) & GenerationMask; }
+
+    constexpr bool IsNull() const { return value == NullValue; }
+    constexpr explicit operator bool() const { return !IsNull(); }
+
+    constexpr bool operator==(const EntityHandle& other) const { return value == other.value; }
+    constexpr bool operator!=(const EntityHandle& other) const { return value != other.value; }
+};
+
+}  // namespace Vest
+
+template <>
+struct std::hash<Vest::EntityHandle> {
+    size_t operator()(const Vest::EntityHandle& handle) const noexcept {
+        return std::hash<uint32_t>{}(handle.value);
+    }
+};
@@ -0,0 +1,465 @@
+#include "Scene/Scene.h"
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <utility>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Core/MemoryTracker.h"
+
+namespace Vest {
+
+namespace {
+
+std::atomic<uint64_t> s_NextRevision{1};
+
+}  // namespace
+
+EntityHandle Scene::CreateEntity(const SceneObject& object) {
+    VEST_MEMORY_TAG(Scene);
+    uint32_t slotIndex = AcquireFreeSlot();
+    if (slotIndex == InvalidDenseIndex) {
+        return EntityHandle();
+    }
+
+    Insert(slotIndex, object);
+    return m_Handles.Back();
+}
+
+bool Scene::DestroyEntity(EntityHandle handle) {
+    VEST_MEMORY_TAG(Scene);
+    if (!IsValid(handle)) {
+        return false;
+    }
+
+    const uint32_t denseIndex = m_Slots[handle.GetIndex()].denseIndex;
+    RemoveFromNameIndex(m_Objects[denseIndex].name, handle);
+
+    const uint32_t lastIndex = static_cast<uint32_t>(m_Objects.Size()) - 1;
+    if (denseIndex != lastIndex) {
+        m_Objects.Mutate(denseIndex) = m_Objects[lastIndex];
+        const EntityHandle moved = m_Handles[lastIndex];
+        m_Handles.Mutate(denseIndex) = moved;
+        m_Slots.Mutate(moved.GetIndex()).denseIndex = denseIndex;
+    }
+    m_Objects.PopBack();
+    m_Handles.PopBack();
+
+    ReleaseSlot(handle.GetIndex());
+    m_HierarchyDirty = true;
+    Touch();
+    return true;
+}
+
+bool Scene::RestoreEntity(EntityHandle handle, const SceneObject& object) {
+    VEST_MEMORY_TAG(Scene);
+    if (handle.IsNull()) {
+        return false;
+    }
+
+    const uint32_t slotIndex = handle.GetIndex();
+    while (m_Slots.Size() <= slotIndex) {
+        m_FreeSlots.push_back(static_cast<uint32_t>(m_Slots.Size()));
+        m_Slots.PushBack(Slot{.queued = true});
+    }
+
+    if (m_Slots[slotIndex].denseIndex != InvalidDenseIndex) {
+        return false;
+    }
+
+    // The slot may still sit in m_FreeSlots; AcquireFreeSlot skips live
+    // entries, so there is no need to search the free list here.
+    Slot& slot = m_Slots.Mutate(slotIndex);
+    slot.generation = handle.GetGeneration();
+    if (slot.generation >= slot.nextGeneration) {
+        slot.nextGeneration = (slot.generation + 1) & EntityHandle::GenerationMask;
+    }
+    Insert(slotIndex, object);
+    return true;
+}
+
+size_t Scene::DestroyEntities(std::span<const EntityHandle> handles) {
+    VEST_MEMORY_TAG(Scene);
+    // Unlink every doomed entity first; an unlinked slot marks its dense
+    // entry for the compaction below and makes repeated handles invalid.
+    uint32_t firstRemoved = static_cast<uint32_t>(m_Objects.Size());
+    size_t removed = 0;
+    for (EntityHandle handle : handles) {
+        if (!IsValid(handle)) {
+            continue;
+        }
+        Slot& slot = m_Slots.Mutate(handle.GetIndex());
+        RemoveFromNameIndex(m_Objects[slot.denseIndex].name, handle);
+        firstRemoved = std::min(firstRemoved, slot.denseIndex);
+        slot.denseIndex = InvalidDenseIndex;
+        ++removed;
+    }
+    if (removed == 0) {
+        return 0;
+    }
+
+    const uint32_t count = static_cast<uint32_t>(m_Objects.Size());
+    uint32_t write = firstRemoved;
+    for (uint32_t read = firstRemoved; read < count; ++read) {
+        const EntityHandle handle = m_Handles[read];
+        if (m_Slots[handle.GetIndex()].denseIndex == InvalidDenseIndex) {
+            ReleaseSlot(handle.GetIndex());
+            continue;
+        }
+        if (write != read) {
+            m_Objects.Mutate(write) = m_Objects[read];
+            m_Handles.Mutate(write) = handle;
+            m_Slots.Mutate(handle.GetIndex()).denseIndex = write;
+        }
+        ++write;
+    }
+    for (uint32_t i = write; i < count; ++i) {
+        m_Objects.PopBack();
+        m_Handles.PopBack();
+    }
+
+    m_HierarchyDirty = true;
+    Touch();
+    return removed;
+}
+
+size_t Scene::RestoreEntities(std::span<const EntityHandle> handles, std::span<const SceneObject> objects) {
+    VEST_MEMORY_TAG(Scene);
+    const size_t count = std::min(handles.size(), objects.size());
+    size_t restored = 0;
+    for (size_t i = 0; i < count; ++i) {
+        restored += RestoreEntity(handles[i], objects[i]) ? 1 : 0;
+    }
+    return restored;
+}
+
+bool Scene::IsValid(EntityHandle handle) const {
+    if (handle.IsNull() || handle.GetIndex() >= m_Slots.Size()) {
+        return false;
+    }
+    const Slot& slot = m_Slots[handle.GetIndex()];
+    return slot.denseIndex != InvalidDenseIndex && slot.generation == handle.GetGeneration();
+}
+
+const SceneObject* Scene::TryGet(EntityHandle handle) const {
+    return IsValid(handle) ? &m_Objects[m_Slots[handle.GetIndex()].denseIndex] : nullptr;
+}
+
+SceneObject* Scene::TryGetMutable(EntityHandle handle) {
+    if (!IsValid(handle)) {
+        return nullptr;
+    }
+    MarkTransformDirty(handle);
+    return &m_Objects.Mutate(m_Slots[handle.GetIndex()].denseIndex);
+}
+
+SceneObject& Scene::GetMutableAt(size_t denseIndex) {
+    MarkTransformDirty(m_Handles[denseIndex]);
+    return m_Objects.Mutate(denseIndex);
+}
+
+bool Scene::RenameEntity(EntityHandle handle, InternedString name) {
+    const SceneObject* current = TryGet(handle);
+    if (!current) {
+        return false;
+    }
+    if (current->name != name) {
+        RemoveFromNameIndex(current->name, handle);
+        TryGetMutable(handle)->name = name;
+        MutableNameIndex().emplace(name, handle);
+    }
+    return true;
+}
+
+EntityHandle Scene::FindEntityByName(InternedString name) const {
+    if (!m_NameIndex) {
+        return EntityHandle();
+    }
+    auto it = m_NameIndex->find(name);
+    return it != m_NameIndex->end() ? it->second : EntityHandle();
+}
+
+EntityHandle Scene::FindEntityByName(std::string_view name) const {
+    const std::optional<uint32_t> id = StringTable::Find(name);
+    return id ? FindEntityByName(InternedString::FromId(*id)) : EntityHandle();
+}
+
+bool Scene::SetParent(EntityHandle child, EntityHandle parent) {
+    VEST_MEMORY_TAG(Scene);
+    const SceneObject* object = TryGet(child);
+    if (!object || (!parent.IsNull() && !IsValid(parent))) {
+        return false;
+    }
+
+    // Reject links that would make the child its own ancestor. The walk is
+    // bounded by the entity count in case a cycle was written directly.
+    size_t steps = 0;
+    for (EntityHandle ancestor = parent; IsValid(ancestor) && steps <= Size(); ++steps) {
+        if (ancestor == child) {
+            return false;
+        }
+        ancestor = TryGet(ancestor)->parent;
+    }
+
+    if (object->parent != parent) {
+        m_Objects.Mutate(m_Slots[child.GetIndex()].denseIndex).parent = parent;
+        m_HierarchyDirty = true;
+        Touch();
+    }
+    return true;
+}
+
+EntityHandle Scene::GetParent(EntityHandle handle) const {
+    const SceneObject* object = TryGet(handle);
+    return object && IsValid(object->parent) ? object->parent : EntityHandle();
+}
+
+void Scene::UpdateTransforms() {
+    VEST_MEMORY_TAG(Scene);
+    if (m_HierarchyDirty || !m_Hierarchy) {
+        RebuildHierarchy();
+        m_DirtyTransforms.clear();
+        return;
+    }
+    if (m_DirtyTransforms.empty()) {
+        return;
+    }
+
+    const HierarchyLayout& layout = *m_Hierarchy;
+    std::vector<uint32_t> roots;
+    roots.reserve(m_DirtyTransforms.size());
+    for (EntityHandle handle : m_DirtyTransforms) {
+        if (IsValid(handle)) {
+            roots.push_back(layout.positionBySlot[handle.GetIndex()]);
+        }
+    }
+    m_DirtyTransforms.clear();
+
+    // Sorted, a dirty entity nested inside an earlier dirty subtree is
+    // already covered by that subtree's range.
+    std::sort(roots.begin(), roots.end());
+    uint32_t coveredEnd = 0;
+    for (uint32_t position : roots) {
+        if (position < coveredEnd) {
+            continue;
+        }
+        coveredEnd = layout.subtreeEnd[position];
+        PropagateTransforms(position, coveredEnd);
+    }
+}
+
+const glm::mat4& Scene::GetWorldTransform(EntityHandle handle) const {
+    static const glm::mat4 identity(1.0f);
+    if (!IsValid(handle) || !m_Hierarchy || handle.GetIndex() >= m_Hierarchy->positionBySlot.size()) {
+        return identity;
+    }
+    const uint32_t position = m_Hierarchy->positionBySlot[handle.GetIndex()];
+    if (position >= m_WorldTransforms.Size() || m_Hierarchy->order[position] != handle) {
+        return identity;
+    }
+    return m_WorldTransforms[position];
+}
+
+glm::mat4 Scene::ComputeLocalTransform(const SceneObject& object) {
+    return glm::translate(glm::mat4(1.0f), object.position) *
+           glm::rotate(glm::mat4(1.0f), glm::radians(object.rotation.z), glm::vec3(0, 0, 1)) *
+           glm::scale(glm::mat4(1.0f), object.scale);
+}
+
+void Scene::Clear() {
+    for (size_t i = 0; i < m_Handles.Size(); ++i) {
+        ReleaseSlot(m_Handles[i].GetIndex());
+    }
+    m_Objects.Clear();
+    m_Handles.Clear();
+    m_NameIndex = CreateRef<NameIndex>();
+    m_HierarchyDirty = true;
+    Touch();
+}
+
+uint32_t Scene::AcquireFreeSlot() {
+    while (!m_FreeSlots.empty()) {
+        uint32_t slotIndex = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        Slot& slot = m_Slots.Mutate(slotIndex);
+        slot.queued = false;
+        if (slot.denseIndex == InvalidDenseIndex) {
+            return slotIndex;
+        }
+    }
+
+    // The all-ones index is reserved so that no live handle equals NullValue.
+    if (m_Slots.Size() >= EntityHandle::IndexMask) {
+        return InvalidDenseIndex;
+    }
+    m_Slots.PushBack(Slot{});
+    return static_cast<uint32_t>(m_Slots.Size()) - 1;
+}
+
+void Scene::ReleaseSlot(uint32_t slotIndex) {
+    Slot& slot = m_Slots.Mutate(slotIndex);
+    slot.denseIndex = InvalidDenseIndex;
+    slot.generation = slot.nextGeneration;
+    slot.nextGeneration = (slot.nextGeneration + 1) & EntityHandle::GenerationMask;
+    if (!slot.queued) {
+        slot.queued = true;
+        m_FreeSlots.push_back(slotIndex);
+    }
+}
+
+void Scene::Insert(uint32_t slotIndex, const SceneObject& object) {
+    Slot& slot = m_Slots.Mutate(slotIndex);
+    slot.denseIndex = static_cast<uint32_t>(m_Objects.Size());
+    m_Objects.PushBack(object);
+    m_Handles.PushBack(EntityHandle::Make(slotIndex, slot.generation));
+    MutableNameIndex().emplace(object.name, m_Handles.Back());
+    m_HierarchyDirty = true;
+    Touch();
+}
+
+void Scene::RemoveFromNameIndex(InternedString name, EntityHandle handle) {
+    NameIndex& index = MutableNameIndex();
+    auto [begin, end] = index.equal_range(name);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second == handle) {
+            index.erase(it);
+            return;
+        }
+    }
+}
+
+Scene::NameIndex& Scene::MutableNameIndex() {
+    // Snapshots share the index; the first structural change after a copy
+    // clones it. Plain property edits never touch it.
+    if (!m_NameIndex) {
+        m_NameIndex = CreateRef<NameIndex>();
+    } else if (m_NameIndex.use_count() > 1) {
+        m_NameIndex = CreateRef<NameIndex>(*m_NameIndex);
+    }
+    return *m_NameIndex;
+}
+
+void Scene::Touch() {
+    m_Revision = s_NextRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Scene::MarkTransformDirty(EntityHandle handle) {
+    // Every mutable access comes through here
+    Touch();
+    if (m_HierarchyDirty) {
+        return;
+    }
+    // Past this size a full rebuild is no more expensive than the
+    // per-subtree pass, and it bounds the list when nobody updates.
+    if (m_DirtyTransforms.size() >= m_Objects.Size()) {
+        m_HierarchyDirty = true;
+        m_DirtyTransforms.clear();
+        return;
+    }
+    m_DirtyTransforms.push_back(handle);
+}
+
+void Scene::RebuildHierarchy() {
+    constexpr uint32_t None = InvalidDenseIndex;
+    const uint32_t count = static_cast<uint32_t>(m_Objects.Size());
+    const size_t slotCount = m_Slots.Size();
+
+    // Child lists as slot-indexed linked lists. Iterating dense order
+    // backwards and pushing to the front keeps siblings in dense order.
+    std::vector<uint32_t> firstChild(slotCount, None);
+    std::vector<uint32_t> nextSibling(slotCount, None);
+    std::vector<uint32_t> roots;
+    for (uint32_t i = count; i-- > 0;) {
+        const uint32_t slot = m_Handles[i].GetIndex();
+        const EntityHandle parent = m_Objects[i].parent;
+        if (IsValid(parent) && parent.GetIndex() != slot) {
+            nextSibling[slot] = firstChild[parent.GetIndex()];
+            firstChild[parent.GetIndex()] = slot;
+        } else {
+            roots.push_back(slot);
+        }
+    }
+    std::reverse(roots.begin(), roots.end());
+
+    auto layout = CreateRef<HierarchyLayout>();
+    layout->order.reserve(count);
+    layout->parentPosition.reserve(count);
+    layout->subtreeEnd.reserve(count);
+    layout->depth.reserve(count);
+    layout->positionBySlot.assign(slotCount, None);
+
+    std::vector<uint32_t> stack;
+    auto visit = [&](uint32_t rootSlot) {
+        stack.push_back(rootSlot);
+        while (!stack.empty()) {
+            const uint32_t slot = stack.back();
+            const uint32_t position = layout->positionBySlot[slot];
+            if (position != None) {
+                // Second visit: every descendant has been emitted
+                layout->subtreeEnd[position] = static_cast<uint32_t>(layout->order.size());
+                stack.pop_back();
+                continue;
+            }
+
+            const uint32_t denseIndex = m_Slots[slot].denseIndex;
+            const EntityHandle parent = m_Objects[denseIndex].parent;
+            const bool isRoot = slot == rootSlot;
+            const uint32_t parentPosition = isRoot ? None : layout->positionBySlot[parent.GetIndex()];
+
+            const uint32_t newPosition = static_cast<uint32_t>(layout->order.size());
+            layout->positionBySlot[slot] = newPosition;
+            layout->order.push_back(m_Handles[denseIndex]);
+            layout->parentPosition.push_back(parentPosition);
+            layout->depth.push_back(isRoot ? 0 : layout->depth[parentPosition] + 1);
+            layout->subtreeEnd.push_back(newPosition + 1);
+
+            // Push children in reverse so they are emitted in sibling order
+            const size_t childrenBegin = stack.size();
+            for (uint32_t child = firstChild[slot]; child != None; child = nextSibling[child]) {
+                if (layout->positionBySlot[child] == None) {
+                    stack.push_back(child);
+                }
+            }
+            std::reverse(stack.begin() + childrenBegin, stack.end());
+        }
+    };
+
+    for (uint32_t root : roots) {
+        visit(root);
+    }
+    // Entities on a parent cycle are unreachable from any root; break the
+    // cycle by treating the first one found as a root.
+    for (uint32_t i = 0; i < count && layout->order.size() < count; ++i) {
+        const uint32_t slot = m_Handles[i].GetIndex();
+        if (layout->positionBySlot[slot] == None) {
+            visit(slot);
+        }
+    }
+
+    m_Hierarchy = std::move(layout);
+    m_HierarchyDirty = false;
+
+    m_WorldTransforms.Clear();
+    for (uint32_t i = 0; i < count; ++i) {
+        m_WorldTransforms.PushBack(glm::mat4(1.0f));
+    }
+    PropagateTransforms(0, count);
+}
+
+void Scene::PropagateTransforms(uint32_t begin, uint32_t end) {
+    const HierarchyLayout& layout = *m_Hierarchy;
+    for (uint32_t position = begin; position < end; ++position) {
+        const EntityHandle handle = layout.order[position];
+        const SceneObject& object = m_Objects[m_Slots[handle.GetIndex()].denseIndex];
+        const glm::mat4 local = ComputeLocalTransform(object);
+
+        // Parents precede children, so the parent's world matrix is final
+        const uint32_t parentPosition = layout.parentPosition[position];
+        m_WorldTransforms.Mutate(position) =
+            parentPosition == InvalidDenseIndex ? local : m_WorldTransforms[parentPosition] * local;
+    }
+}
+
+}  // namespace Vest
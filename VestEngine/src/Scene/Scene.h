@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Core/Base.h"
+#include "Core/CowChunkedArray.h"
+#include <Scene/EntityHandle.h>
+#include <Scene/SceneObject.h>
+
+namespace Vest {
+
+/**
+ * @brief Entity container addressed through generational handles
+ *
+ * Objects are kept densely packed for iteration and rendering. A sparse
+ * slot table maps handle indices to dense positions, so lookup, validation
+ * and removal (swap-and-pop) are all O(1). Dense order is therefore not
+ * stable across removals; anything that needs to remember an entity must
+ * hold an EntityHandle rather than a position.
+ *
+ * Per-entity storage is chunked and copy-on-write, so copying a Scene
+ * (e.g. the Play-mode snapshot) is O(chunk count) and only the chunks
+ * written afterwards get duplicated. Read through the const accessors and
+ * request mutable access only when actually writing.
+ *
+ * Entities may be parented. The hierarchy is flattened into depth-first
+ * order (every parent precedes its descendants and each subtree is a
+ * contiguous range), so UpdateTransforms() computes world matrices in one
+ * linear pass and re-propagates only the subtrees that were written.
+ */
+class Scene {
+public:
+    Scene() = default;
+
+    /**
+     * @brief Add an entity and return its handle
+     * @return Null handle if the slot table is exhausted
+     */
+    EntityHandle CreateEntity(const SceneObject& object);
+
+    /**
+     * @brief Remove an entity, moving the last dense object into its place
+     * @return false if the handle is stale or null
+     */
+    bool DestroyEntity(EntityHandle handle);
+
+    /**
+     * @brief Bring a destroyed entity back under its original handle
+     *
+     * Used by undo/redo so that commands recorded against the handle keep
+     * working. Fails if the slot is currently occupied by another entity.
+     * The slot's generation counter never moves backwards: destroying the
+     * revived entity moves the slot to a generation no handle has had, so
+     * handles issued while the slot was reused stay invalid.
+     */
+    bool RestoreEntity(EntityHandle handle, const SceneObject& object);
+
+    /**
+     * @brief Remove several entities in one compaction pass
+     *
+     * Unlike repeated DestroyEntity() calls, the surviving entities keep
+     * their relative dense (draw) order. Stale, null and repeated handles
+     * are skipped.
+     * @return Number of entities removed
+     */
+    size_t DestroyEntities(std::span<const EntityHandle> handles);
+
+    /**
+     * @brief RestoreEntity() for a batch; @p objects is parallel to @p handles
+     * @return Number of entities restored
+     */
+    size_t RestoreEntities(std::span<const EntityHandle> handles, std::span<const SceneObject> objects);
+
+    bool IsValid(EntityHandle handle) const;
+
+    const SceneObject* TryGet(EntityHandle handle) const;
+
+    /**
+     * @brief Writable lookup; duplicates the entity's chunk if it is shared with a snapshot
+     */
+    SceneObject* TryGetMutable(EntityHandle handle);
+
+    /**
+     * @brief Change an entity's name, keeping the name index in sync
+     *
+     * Names must be changed through here rather than by writing
+     * SceneObject::name directly, or FindEntityByName will miss them.
+     */
+    bool RenameEntity(EntityHandle handle, InternedString name);
+
+    /**
+     * @brief O(1) lookup by interned name
+     * @return First matching entity, or a null handle
+     */
+    EntityHandle FindEntityByName(InternedString name) const;
+
+    /**
+     * @brief Lookup by plain string; a name never interned is a miss and is not added to the StringTable
+     */
+    EntityHandle FindEntityByName(std::string_view name) const;
+    EntityHandle FindEntityByName(const char* name) const { return FindEntityByName(std::string_view(name)); }
+    EntityHandle FindEntityByName(const std::string& name) const { return FindEntityByName(std::string_view(name)); }
+
+    /**
+     * @brief Attach @p child under @p parent, or make it a root if @p parent is null
+     *
+     * The child's local transform is kept as-is.
+     * @return false if a handle is stale or the link would create a cycle
+     */
+    bool SetParent(EntityHandle child, EntityHandle parent);
+
+    /**
+     * @brief Live parent of an entity, or a null handle for roots
+     */
+    EntityHandle GetParent(EntityHandle handle) const;
+
+    /**
+     * @brief Re-flatten the hierarchy if needed and recompute dirty world transforms
+     *
+     * Call once per frame before reading world transforms or the
+     * hierarchy order. Cheap when nothing changed.
+     */
+    void UpdateTransforms();
+
+    /**
+     * @brief World matrix as of the last UpdateTransforms(); identity for unknown handles
+     */
+    const glm::mat4& GetWorldTransform(EntityHandle handle) const;
+
+    /**
+     * @brief Depth-first hierarchy order, valid after UpdateTransforms()
+     *
+     * The subtree rooted at position i spans [i, GetSubtreeEndAt(i)).
+     */
+    size_t GetHierarchySize() const { return m_Hierarchy->order.size(); }
+    EntityHandle GetHierarchyHandleAt(size_t position) const { return m_Hierarchy->order[position]; }
+    uint32_t GetHierarchyDepthAt(size_t position) const { return m_Hierarchy->depth[position]; }
+    size_t GetSubtreeEndAt(size_t position) const { return m_Hierarchy->subtreeEnd[position]; }
+
+    static glm::mat4 ComputeLocalTransform(const SceneObject& object);
+
+    size_t Size() const { return m_Objects.Size(); }
+    bool Empty() const { return m_Objects.Empty(); }
+
+    /**
+     * @brief Dense access, in draw order
+     */
+    const SceneObject& GetAt(size_t denseIndex) const { return m_Objects[denseIndex]; }
+    SceneObject& GetMutableAt(size_t denseIndex);
+    EntityHandle GetHandleAt(size_t denseIndex) const { return m_Handles[denseIndex]; }
+
+    /**
+     * @brief Destroy every entity; outstanding handles become stale
+     */
+    void Clear();
+
+    /**
+     * @brief Changes whenever the scene may have been written
+     *
+     * Bumped by every structural change and every mutable access, whether
+     * or not the caller then writes. Values come from a process-wide
+     * counter, so two scenes (or a scene and its restored snapshot) never
+     * share a revision unless one is an unmodified copy of the other.
+     * Lets caches such as the editor viewport skip work for unchanged scenes.
+     */
+    uint64_t GetRevision() const { return m_Revision; }
+
+private:
+    static constexpr uint32_t InvalidDenseIndex = 0xFFFFFFFFu;
+
+    struct Slot {
+        uint32_t denseIndex = InvalidDenseIndex;
+        uint32_t generation = 0;
+        uint32_t nextGeneration = 1;  // Given out on the next release; past every generation issued so far
+        bool queued = false;  // Present in m_FreeSlots (possibly while alive again)
+    };
+
+    uint32_t AcquireFreeSlot();
+    void ReleaseSlot(uint32_t slotIndex);
+    void Insert(uint32_t slotIndex, const SceneObject& object);
+    void RemoveFromNameIndex(InternedString name, EntityHandle handle);
+
+    using NameIndex = std::unordered_multimap<InternedString, EntityHandle>;
+
+    /**
+     * Flattened hierarchy; immutable once built so snapshots can share it.
+     */
+    struct HierarchyLayout {
+        std::vector<EntityHandle> order;
+        std::vector<uint32_t> parentPosition;  // InvalidDenseIndex for roots
+        std::vector<uint32_t> subtreeEnd;
+        std::vector<uint32_t> depth;
+        std::vector<uint32_t> positionBySlot;
+    };
+
+    NameIndex& MutableNameIndex();
+    void Touch();
+    void MarkTransformDirty(EntityHandle handle);
+    void RebuildHierarchy();
+    void PropagateTransforms(uint32_t begin, uint32_t end);
+
+    CowChunkedArray<SceneObject> m_Objects;
+    CowChunkedArray<EntityHandle> m_Handles;
+    CowChunkedArray<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+    Ref<NameIndex> m_NameIndex = CreateRef<NameIndex>();
+
+    Ref<const HierarchyLayout> m_Hierarchy = CreateRef<HierarchyLayout>();
+    CowChunkedArray<glm::mat4> m_WorldTransforms;  // Indexed by hierarchy position
+    std::vector<EntityHandle> m_DirtyTransforms;
+    bool m_HierarchyDirty = false;
+    uint64_t m_Revision = 0;
+};
+
+}  // namespace Vest
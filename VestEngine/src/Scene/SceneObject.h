@@ -1,21 +1,27 @@
 #pragma once
 
-#include <string>
-
 #include <glm/glm.hpp>
 
+#include "Core/StringTable.h"
+#include <Scene/EntityHandle.h>
+
 namespace Vest {
 
 struct SceneObject {
     enum class MeshType { Triangle = 0, Quad };
 
-    std::string name;
+    InternedString name;
     glm::vec3 position = glm::vec3(0.0f);
     glm::vec3 scale = glm::vec3(1.0f);
     glm::vec3 rotation = glm::vec3(0.0f);
     glm::vec4 color = glm::vec4(1.0f);
     bool textured = false;
     MeshType mesh = MeshType::Triangle;
+
+    // Transform values above are relative to the parent. Change through
+    // Scene::SetParent so the hierarchy is re-flattened; a stale handle
+    // (parent destroyed) makes this object a root until the parent is restored.
+    EntityHandle parent;
 };
 
 }  // namespace Vest
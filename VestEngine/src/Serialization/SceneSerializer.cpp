@@ -2,17 +2,18 @@
 
 #include <fstream>
 #include <filesystem>
+#include <unordered_map>
 
 #include "Core/Log.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Profiler.h"
 #include <Scene/SceneObject.h>
 
 namespace Vest {
 
 static constexpr const char* SCENE_VERSION = "1.0";
 
-bool SceneSerializer::Serialize(const std::string& filepath, const std::vector<SceneObject>& objects) {
-    VEST_CORE_INFO("Serializing scene to: {0}", filepath);
-    
+static bool WriteSceneFile(const std::string& filepath, const nlohmann::json& json) {
     // Create backup if file exists
     if (std::filesystem::exists(filepath)) {
         std::string backupPath = filepath + ".bak";
@@ -23,22 +24,6 @@ bool SceneSerializer::Serialize(const std::string& filepath, const std::vector<S
             VEST_CORE_WARN("Failed to create backup: {0}", e.what());
         }
     }
-    
-    nlohmann::json json;
-    json["version"] = SCENE_VERSION;
-    json["objects"] = nlohmann::json::array();
-    
-    for (const auto& obj : objects) {
-        nlohmann::json entry;
-        entry["name"] = obj.name;
-        entry["position"] = {obj.position.x, obj.position.y, obj.position.z};
-        entry["rotation"] = {obj.rotation.x, obj.rotation.y, obj.rotation.z};
-        entry["scale"] = {obj.scale.x, obj.scale.y, obj.scale.z};
-        entry["color"] = {obj.color.r, obj.color.g, obj.color.b, obj.color.a};
-        entry["textured"] = obj.textured;
-        entry["mesh"] = static_cast<int>(obj.mesh);
-        json["objects"].push_back(entry);
-    }
 
     std::ofstream out(filepath);
     if (!out.is_open()) {
@@ -47,20 +32,16 @@ bool SceneSerializer::Serialize(const std::string& filepath, const std::vector<S
     }
     
     out << json.dump(4);
-    VEST_CORE_INFO("Scene serialized successfully: {0} objects", objects.size());
     return true;
 }
 
-bool SceneSerializer::Deserialize(const std::string& filepath, std::vector<SceneObject>& outObjects) {
-    VEST_CORE_INFO("Deserializing scene from: {0}", filepath);
-    
+static bool ReadSceneFile(const std::string& filepath, nlohmann::json& json) {
     std::ifstream in(filepath);
     if (!in.is_open()) {
         VEST_CORE_ERROR("Failed to open file for reading: {0}", filepath);
         return false;
     }
 
-    nlohmann::json json;
     try {
         in >> json;
     } catch (const nlohmann::json::exception& e) {
@@ -88,54 +69,101 @@ bool SceneSerializer::Deserialize(const std::string& filepath, std::vector<Scene
         VEST_CORE_ERROR("Invalid scene file: 'objects' is not an array");
         return false;
     }
+    return true;
+}
+
+static nlohmann::json SerializeObject(const SceneObject& obj) {
+    nlohmann::json entry;
+    entry["name"] = obj.name.Str();
+    entry["position"] = {obj.position.x, obj.position.y, obj.position.z};
+    entry["rotation"] = {obj.rotation.x, obj.rotation.y, obj.rotation.z};
+    entry["scale"] = {obj.scale.x, obj.scale.y, obj.scale.z};
+    entry["color"] = {obj.color.r, obj.color.g, obj.color.b, obj.color.a};
+    entry["textured"] = obj.textured;
+    entry["mesh"] = static_cast<int>(obj.mesh);
+    return entry;
+}
+
+static SceneObject DeserializeObject(const nlohmann::json& entry) {
+    SceneObject obj;
+    obj.name = entry.value("name", "Entity");
+    
+    // Validate and parse position
+    if (!entry.contains("position") || !entry["position"].is_array() || entry["position"].size() != 3) {
+        VEST_CORE_WARN("Invalid position data for object '{0}', using default", obj.name.View());
+        obj.position = glm::vec3(0.0f);
+    } else {
+        auto pos = entry["position"];
+        obj.position = {pos[0].get<float>(), pos[1].get<float>(), pos[2].get<float>()};
+    }
+    
+    // Validate and parse rotation
+    if (!entry.contains("rotation") || !entry["rotation"].is_array() || entry["rotation"].size() != 3) {
+        VEST_CORE_WARN("Invalid rotation data for object '{0}', using default", obj.name.View());
+        obj.rotation = glm::vec3(0.0f);
+    } else {
+        auto rot = entry["rotation"];
+        obj.rotation = {rot[0].get<float>(), rot[1].get<float>(), rot[2].get<float>()};
+    }
+    
+    // Validate and parse scale
+    if (!entry.contains("scale") || !entry["scale"].is_array() || entry["scale"].size() != 3) {
+        VEST_CORE_WARN("Invalid scale data for object '{0}', using default", obj.name.View());
+        obj.scale = glm::vec3(1.0f);
+    } else {
+        auto scale = entry["scale"];
+        obj.scale = {scale[0].get<float>(), scale[1].get<float>(), scale[2].get<float>()};
+    }
+    
+    // Validate and parse color
+    if (!entry.contains("color") || !entry["color"].is_array() || entry["color"].size() != 4) {
+        VEST_CORE_WARN("Invalid color data for object '{0}', using default", obj.name.View());
+        obj.color = glm::vec4(1.0f);
+    } else {
+        auto color = entry["color"];
+        obj.color = {color[0].get<float>(), color[1].get<float>(), color[2].get<float>(), color[3].get<float>()};
+    }
+    
+    obj.textured = entry.value("textured", false);
+    obj.mesh = static_cast<SceneObject::MeshType>(entry.value("mesh", 0));
+    return obj;
+}
+
+bool SceneSerializer::Serialize(const std::string& filepath, const std::vector<SceneObject>& objects) {
+    VEST_PROFILE_FUNCTION();
+    VEST_MEMORY_TAG(Serialization);
+    VEST_CORE_INFO("Serializing scene to: {0}", filepath);
+    
+    nlohmann::json json;
+    json["version"] = SCENE_VERSION;
+    json["objects"] = nlohmann::json::array();
+    
+    for (const auto& obj : objects) {
+        json["objects"].push_back(SerializeObject(obj));
+    }
+
+    if (!WriteSceneFile(filepath, json)) {
+        return false;
+    }
+    VEST_CORE_INFO("Scene serialized successfully: {0} objects", objects.size());
+    return true;
+}
+
+bool SceneSerializer::Deserialize(const std::string& filepath, std::vector<SceneObject>& outObjects) {
+    VEST_PROFILE_FUNCTION();
+    VEST_MEMORY_TAG(Serialization);
+    VEST_CORE_INFO("Deserializing scene from: {0}", filepath);
+    
+    nlohmann::json json;
+    if (!ReadSceneFile(filepath, json)) {
+        return false;
+    }
 
     outObjects.clear();
     
     for (const auto& entry : json["objects"]) {
         try {
-            SceneObject obj;
-            obj.name = entry.value("name", "Entity");
-            
-            // Validate and parse position
-            if (!entry.contains("position") || !entry["position"].is_array() || entry["position"].size() != 3) {
-                VEST_CORE_WARN("Invalid position data for object '{0}', using default", obj.name);
-                obj.position = glm::vec3(0.0f);
-            } else {
-                auto pos = entry["position"];
-                obj.position = {pos[0].get<float>(), pos[1].get<float>(), pos[2].get<float>()};
-            }
-            
-            // Validate and parse rotation
-            if (!entry.contains("rotation") || !entry["rotation"].is_array() || entry["rotation"].size() != 3) {
-                VEST_CORE_WARN("Invalid rotation data for object '{0}', using default", obj.name);
-                obj.rotation = glm::vec3(0.0f);
-            } else {
-                auto rot = entry["rotation"];
-                obj.rotation = {rot[0].get<float>(), rot[1].get<float>(), rot[2].get<float>()};
-            }
-            
-            // Validate and parse scale
-            if (!entry.contains("scale") || !entry["scale"].is_array() || entry["scale"].size() != 3) {
-                VEST_CORE_WARN("Invalid scale data for object '{0}', using default", obj.name);
-                obj.scale = glm::vec3(1.0f);
-            } else {
-                auto scale = entry["scale"];
-                obj.scale = {scale[0].get<float>(), scale[1].get<float>(), scale[2].get<float>()};
-            }
-            
-            // Validate and parse color
-            if (!entry.contains("color") || !entry["color"].is_array() || entry["color"].size() != 4) {
-                VEST_CORE_WARN("Invalid color data for object '{0}', using default", obj.name);
-                obj.color = glm::vec4(1.0f);
-            } else {
-                auto color = entry["color"];
-                obj.color = {color[0].get<float>(), color[1].get<float>(), color[2].get<float>(), color[3].get<float>()};
-            }
-            
-            obj.textured = entry.value("textured", false);
-            obj.mesh = static_cast<SceneObject::MeshType>(entry.value("mesh", 0));
-            
-            outObjects.push_back(obj);
+            outObjects.push_back(DeserializeObject(entry));
         } catch (const std::exception& e) {
             VEST_CORE_ERROR("Failed to deserialize object: {0}", e.what());
             continue;  // Skip invalid objects
@@ -146,4 +174,77 @@ bool SceneSerializer::Deserialize(const std::string& filepath, std::vector<Scene
     return true;
 }
 
+bool SceneSerializer::Serialize(const std::string& filepath, const Scene& scene) {
+    VEST_PROFILE_FUNCTION();
+    VEST_MEMORY_TAG(Serialization);
+    VEST_CORE_INFO("Serializing scene to: {0}", filepath);
+
+    nlohmann::json json;
+    json["version"] = SCENE_VERSION;
+    json["objects"] = nlohmann::json::array();
+
+    // Parent links are written as the parent's index in the objects array
+    // (-1 for roots). Live parents of an entity are always scene members,
+    // so every referenced index resolves.
+    std::unordered_map<EntityHandle, int> fileIndex;
+    fileIndex.reserve(scene.Size());
+    for (size_t i = 0; i < scene.Size(); ++i) {
+        fileIndex.emplace(scene.GetHandleAt(i), static_cast<int>(i));
+    }
+
+    for (size_t i = 0; i < scene.Size(); ++i) {
+        nlohmann::json entry = SerializeObject(scene.GetAt(i));
+        EntityHandle parent = scene.GetParent(scene.GetHandleAt(i));
+        entry["parent"] = parent.IsNull() ? -1 : fileIndex.at(parent);
+        json["objects"].push_back(entry);
+    }
+
+    if (!WriteSceneFile(filepath, json)) {
+        return false;
+    }
+    VEST_CORE_INFO("Scene serialized successfully: {0} objects", scene.Size());
+    return true;
+}
+
+bool SceneSerializer::Deserialize(const std::string& filepath, Scene& outScene) {
+    VEST_PROFILE_FUNCTION();
+    VEST_MEMORY_TAG(Serialization);
+    VEST_CORE_INFO("Deserializing scene from: {0}", filepath);
+
+    nlohmann::json json;
+    if (!ReadSceneFile(filepath, json)) {
+        return false;
+    }
+
+    outScene.Clear();
+
+    // Handles by file index; skipped objects leave a null entry so that
+    // later parent indices still line up.
+    std::vector<EntityHandle> handles;
+    std::vector<int> parents;
+    for (const auto& entry : json["objects"]) {
+        try {
+            handles.push_back(outScene.CreateEntity(DeserializeObject(entry)));
+            parents.push_back(entry.value("parent", -1));
+        } catch (const std::exception& e) {
+            VEST_CORE_ERROR("Failed to deserialize object: {0}", e.what());
+            handles.emplace_back();
+            parents.push_back(-1);
+        }
+    }
+
+    for (size_t i = 0; i < handles.size(); ++i) {
+        const int parent = parents[i];
+        if (parent < 0 || handles[i].IsNull()) {
+            continue;
+        }
+        if (static_cast<size_t>(parent) >= handles.size() || !outScene.SetParent(handles[i], handles[parent])) {
+            VEST_CORE_WARN("Invalid parent {0} for object {1}, keeping it at the root", parent, i);
+        }
+    }
+
+    VEST_CORE_INFO("Scene deserialized successfully: {0} objects", outScene.Size());
+    return true;
+}
+
 }  // namespace Vest
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <nlohmann/json.hpp>
+#include <Scene/Scene.h>
 #include <Scene/SceneObject.h>
 
 namespace Vest {
@@ -12,6 +13,9 @@ class SceneSerializer {
 public:
     static bool Serialize(const std::string& filepath, const std::vector<SceneObject>& objects);
     static bool Deserialize(const std::string& filepath, std::vector<SceneObject>& outObjects);
+
+    static bool Serialize(const std::string& filepath, const Scene& scene);
+    static bool Deserialize(const std::string& filepath, Scene& outScene);
 };
 
 }  // namespace Vest